@@ -0,0 +1,415 @@
+#include "AuditTrail.h"
+#include "Exceptions.h"
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+    // sequence, timestamp, employee, entity id, action, entity, text lengths
+    const size_t HEADER_BYTES = 8 + 8 + 4 + 4 + 1 + 1 + 2 + 2;
+    const size_t HASH_BYTES = 32;
+    const size_t MAX_TEXT = 0xFFFF;
+
+    // ==================== SHA-256 ====================
+    const uint32_t ROUND_CONSTANTS[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    class Sha256 {
+    private:
+        uint32_t state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+        uint8_t block[64];
+        size_t blockUsed = 0;
+        unsigned long long totalBytes = 0;
+
+        static uint32_t rotate(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+        void compress(const uint8_t* data) {
+            uint32_t w[64];
+            for (int i = 0; i < 16; i++) {
+                w[i] = (uint32_t(data[i * 4]) << 24) | (uint32_t(data[i * 4 + 1]) << 16) |
+                       (uint32_t(data[i * 4 + 2]) << 8) | uint32_t(data[i * 4 + 3]);
+            }
+            for (int i = 16; i < 64; i++) {
+                uint32_t s0 = rotate(w[i - 15], 7) ^ rotate(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                uint32_t s1 = rotate(w[i - 2], 17) ^ rotate(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+            uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+            uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+            for (int i = 0; i < 64; i++) {
+                uint32_t t1 = h + (rotate(e, 6) ^ rotate(e, 11) ^ rotate(e, 25)) + ((e & f) ^ (~e & g)) +
+                              ROUND_CONSTANTS[i] + w[i];
+                uint32_t t2 = (rotate(a, 2) ^ rotate(a, 13) ^ rotate(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+                h = g; g = f; f = e; e = d + t1;
+                d = c; c = b; b = a; a = t1 + t2;
+            }
+            state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+            state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+        }
+
+    public:
+        void update(const void* data, size_t length) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            totalBytes += length;
+            while (length > 0) {
+                size_t take = min(length, sizeof(block) - blockUsed);
+                memcpy(block + blockUsed, bytes, take);
+                blockUsed += take;
+                bytes += take;
+                length -= take;
+                if (blockUsed == sizeof(block)) {
+                    compress(block);
+                    blockUsed = 0;
+                }
+            }
+        }
+
+        AuditHash finish() {
+            unsigned long long bits = totalBytes * 8;
+            uint8_t pad = 0x80;
+            update(&pad, 1);
+            pad = 0;
+            while (blockUsed != 56) update(&pad, 1);
+            uint8_t length[8];
+            for (int i = 0; i < 8; i++) length[i] = uint8_t(bits >> (56 - i * 8));
+            update(length, 8);
+
+            AuditHash hash;
+            for (int i = 0; i < 8; i++) {
+                for (int j = 0; j < 4; j++) hash[i * 4 + j] = uint8_t(state[i] >> (24 - j * 8));
+            }
+            return hash;
+        }
+    };
+
+    // ==================== RECORD LAYOUT ====================
+    // Little-endian header, then before and after text, then the chain hash
+    void putBytes(string& out, unsigned long long value, int bytes) {
+        for (int i = 0; i < bytes; i++) out += char((value >> (i * 8)) & 0xFF);
+    }
+
+    unsigned long long getBytes(const char* in, int bytes) {
+        unsigned long long value = 0;
+        for (int i = 0; i < bytes; i++) value |= (unsigned long long)(uint8_t)in[i] << (i * 8);
+        return value;
+    }
+
+    string encodeBody(const AuditEntry& entry) {
+        string out;
+        out.reserve(HEADER_BYTES + entry.before.size() + entry.after.size() + HASH_BYTES);
+        putBytes(out, entry.sequence, 8);
+        putBytes(out, static_cast<unsigned long long>(entry.timestamp), 8);
+        putBytes(out, static_cast<uint32_t>(entry.employeeId), 4);
+        putBytes(out, static_cast<uint32_t>(entry.entityId), 4);
+        putBytes(out, entry.action, 1);
+        putBytes(out, entry.entity, 1);
+        putBytes(out, entry.before.size(), 2);
+        putBytes(out, entry.after.size(), 2);
+        out += entry.before;
+        out += entry.after;
+        return out;
+    }
+
+    // Fills everything but the texts; returns their combined length
+    size_t decodeHeader(const char* header, AuditEntry& entry) {
+        entry.sequence = getBytes(header, 8);
+        entry.timestamp = static_cast<long long>(getBytes(header + 8, 8));
+        entry.employeeId = static_cast<int>(static_cast<uint32_t>(getBytes(header + 16, 4)));
+        entry.entityId = static_cast<int>(static_cast<uint32_t>(getBytes(header + 20, 4)));
+        entry.action = static_cast<AuditAction>(getBytes(header + 24, 1));
+        entry.entity = static_cast<AuditEntity>(getBytes(header + 25, 1));
+        entry.before.resize(getBytes(header + 26, 2));
+        entry.after.resize(getBytes(header + 28, 2));
+        return entry.before.size() + entry.after.size();
+    }
+
+    // Reads one whole entry; false at the end of the file or a cut-off entry
+    bool readEntry(istream& in, AuditEntry& entry, string& body) {
+        char header[HEADER_BYTES];
+        if (!in.read(header, HEADER_BYTES)) return false;
+        size_t textBytes = decodeHeader(header, entry);
+        body.assign(header, HEADER_BYTES);
+        body.resize(HEADER_BYTES + textBytes);
+        if (!in.read(&body[HEADER_BYTES], textBytes)) return false;
+        if (!in.read(reinterpret_cast<char*>(entry.hash.data()), HASH_BYTES)) return false;
+        entry.before.assign(body, HEADER_BYTES, entry.before.size());
+        entry.after.assign(body, HEADER_BYTES + entry.before.size(), entry.after.size());
+        return true;
+    }
+
+    AuditHash chainHash(const AuditHash& previous, const string& body) {
+        Sha256 sha;
+        sha.update(previous.data(), previous.size());
+        sha.update(body.data(), body.size());
+        return sha.finish();
+    }
+
+    unsigned long long entityKey(AuditEntity entity, int entityId) {
+        return (static_cast<unsigned long long>(entity) << 32) | static_cast<uint32_t>(entityId);
+    }
+}
+
+// ==================== CONSTRUCTOR / DESTRUCTOR ====================
+AuditTrail::AuditTrail(const string& path)
+    : path(path), nextSequence(1), lastWritten(0), stopping(false), head{}, fileSize(0) {
+    load();
+    file.open(path, ios::binary | ios::app);
+    if (!file.is_open()) throw LoggingException("Open audit trail", path);
+    writer = thread(&AuditTrail::run, this);
+}
+
+AuditTrail::~AuditTrail() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    writer.join();
+}
+
+shared_ptr<AuditTrail> AuditTrail::open(const string& path) {
+    static mutex registryMutex;
+    static unordered_map<string, weak_ptr<AuditTrail>> registry;
+    lock_guard<mutex> lock(registryMutex);
+    shared_ptr<AuditTrail> trail = registry[path].lock();
+    if (!trail) {
+        trail.reset(new AuditTrail(path));
+        registry[path] = trail;
+    }
+    return trail;
+}
+
+// Indexes the headers, seeking over the texts. An entry cut off by a crash
+// is removed so new entries chain on from the last whole one.
+void AuditTrail::load() {
+    ifstream in(path, ios::binary);
+    if (!in.is_open()) return;
+
+    unsigned long long offset = 0;
+    char header[HEADER_BYTES];
+    AuditEntry entry;
+    while (in.read(header, HEADER_BYTES)) {
+        size_t textBytes = decodeHeader(header, entry);
+        in.seekg(static_cast<streamoff>(textBytes), ios::cur);
+        if (!in.read(reinterpret_cast<char*>(entry.hash.data()), HASH_BYTES)) break;
+        index(entry, offset);
+        head = entry.hash;
+        nextSequence = entry.sequence + 1;
+        offset += HEADER_BYTES + textBytes + HASH_BYTES;
+    }
+    in.close();
+
+    lastWritten = nextSequence - 1;
+    fileSize = offset;
+    error_code error;
+    unsigned long long onDisk = filesystem::file_size(path, error);
+    if (!error && onDisk > offset) {
+        filesystem::resize_file(path, offset, error);
+        HLOG_WARNING("audit.truncate path={} bytes={}", path, onDisk - offset);
+    }
+}
+
+void AuditTrail::index(const AuditEntry& entry, unsigned long long offset) {
+    byEntity[entityKey(entry.entity, entry.entityId)].push_back(offset);
+    byEmployee[entry.employeeId].emplace_back(entry.timestamp, offset);
+}
+
+// ==================== WRITER ====================
+// Hashes and appends whatever is queued, then indexes it
+void AuditTrail::run() {
+    unique_lock<mutex> lock(queueMutex);
+    while (true) {
+        wake.wait(lock, [this]() { return stopping || !queue.empty(); });
+        if (queue.empty()) break;
+        deque<AuditEntry> batch;
+        batch.swap(queue);
+        lock.unlock();
+
+        string out;
+        vector<unsigned long long> offsets;
+        AuditHash chain = head;
+        unsigned long long offset = fileSize;
+        for (auto& entry : batch) {
+            string body = encodeBody(entry);
+            entry.hash = chainHash(chain, body);
+            chain = entry.hash;
+            offsets.push_back(offset);
+            out += body;
+            out.append(reinterpret_cast<const char*>(entry.hash.data()), HASH_BYTES);
+            offset += body.size() + HASH_BYTES;
+        }
+        file.write(out.data(), static_cast<streamsize>(out.size()));
+        file.flush();
+        if (!file) HLOG_ERROR("audit.write failed path={} entries={}", path, batch.size());
+
+        {
+            lock_guard<mutex> indexLock(indexMutex);
+            for (size_t i = 0; i < batch.size(); i++) index(batch[i], offsets[i]);
+            head = chain;
+            fileSize = offset;
+        }
+
+        lock.lock();
+        lastWritten = batch.back().sequence;
+        written.notify_all();
+    }
+}
+
+void AuditTrail::record(int employeeId, AuditAction action, AuditEntity entity, int entityId,
+                        const string& before, const string& after) {
+    AuditEntry entry;
+    entry.employeeId = employeeId;
+    entry.action = action;
+    entry.entity = entity;
+    entry.entityId = entityId;
+    entry.before = before.substr(0, MAX_TEXT);
+    entry.after = after.substr(0, MAX_TEXT);
+    {
+        // Stamped under the lock so times follow the sequence
+        lock_guard<mutex> lock(queueMutex);
+        entry.timestamp = chrono::duration_cast<chrono::microseconds>(
+            chrono::system_clock::now().time_since_epoch()).count();
+        entry.sequence = nextSequence++;
+        queue.push_back(std::move(entry));
+    }
+    wake.notify_one();
+}
+
+void AuditTrail::flush() {
+    unique_lock<mutex> lock(queueMutex);
+    unsigned long long target = nextSequence - 1;
+    written.wait(lock, [&]() { return lastWritten >= target; });
+}
+
+// ==================== READER ====================
+vector<AuditEntry> AuditTrail::readAt(const vector<unsigned long long>& offsets) const {
+    vector<AuditEntry> result;
+    ifstream in(path, ios::binary);
+    if (!in.is_open()) throw FileReadException(path);
+    string body;
+    for (unsigned long long offset : offsets) {
+        AuditEntry entry;
+        in.seekg(static_cast<streamoff>(offset));
+        if (!readEntry(in, entry, body)) throw FileCorruptedException(path, "entry at " + to_string(offset));
+        result.push_back(std::move(entry));
+    }
+    return result;
+}
+
+vector<AuditEntry> AuditTrail::findByEntity(AuditEntity entity, int entityId) {
+    flush();
+    vector<unsigned long long> offsets;
+    {
+        lock_guard<mutex> lock(indexMutex);
+        auto it = byEntity.find(entityKey(entity, entityId));
+        if (it != byEntity.end()) offsets = it->second;
+    }
+    return readAt(offsets);
+}
+
+// Entries are stamped in sequence order, so each employee's list is sorted
+// by time and the range is found by binary search
+vector<AuditEntry> AuditTrail::findByEmployee(int employeeId, time_t from, time_t to) {
+    flush();
+    vector<unsigned long long> offsets;
+    {
+        lock_guard<mutex> lock(indexMutex);
+        auto it = byEmployee.find(employeeId);
+        if (it != byEmployee.end()) {
+            const auto& entries = it->second;
+            long long start = static_cast<long long>(from) * 1000000;
+            long long end = static_cast<long long>(to) * 1000000;
+            auto first = lower_bound(entries.begin(), entries.end(), make_pair(start, 0ULL));
+            for (auto entry = first; entry != entries.end() && entry->first < end; ++entry) {
+                offsets.push_back(entry->second);
+            }
+        }
+    }
+    return readAt(offsets);
+}
+
+// Replays the chain from the start. Entries missing from the end are caught
+// by comparing with what this process knows it has written.
+AuditVerification AuditTrail::verify() {
+    flush();
+    AuditVerification result;
+    ifstream in(path, ios::binary);
+    AuditHash chain{};
+    AuditEntry entry;
+    string body;
+    while (in.is_open() && readEntry(in, entry, body)) {
+        if (entry.sequence != result.entries + 1 || chainHash(chain, body) != entry.hash) {
+            result.intact = false;
+            result.firstBroken = result.entries + 1;
+            return result;
+        }
+        chain = entry.hash;
+        result.entries++;
+    }
+
+    lock_guard<mutex> lock(queueMutex);
+    if (result.entries < lastWritten) {
+        result.intact = false;
+        result.firstBroken = result.entries + 1;
+    }
+    return result;
+}
+
+AuditHash AuditTrail::getHead() {
+    flush();
+    lock_guard<mutex> lock(indexMutex);
+    return head;
+}
+
+unsigned long long AuditTrail::size() {
+    lock_guard<mutex> lock(queueMutex);
+    return nextSequence - 1;
+}
+
+string AuditTrail::getPath() const {
+    return path;
+}
+
+// ==================== NAMES ====================
+string AuditTrail::actionToString(AuditAction action) {
+    switch (action) {
+        case AUDIT_PAYMENT: return "Payment";
+        case AUDIT_CANCELLATION: return "Cancellation";
+        case AUDIT_PASSWORD_CHANGE: return "Password Change";
+        case AUDIT_RATE_CHANGE: return "Rate Change";
+        case AUDIT_PRICE_CHANGE: return "Price Change";
+        default: return "Unknown";
+    }
+}
+
+string AuditTrail::entityToString(AuditEntity entity) {
+    switch (entity) {
+        case AUDIT_BILL: return "Bill";
+        case AUDIT_RESERVATION: return "Reservation";
+        case AUDIT_EMPLOYEE: return "Employee";
+        case AUDIT_ROOM: return "Room";
+        case AUDIT_ROOM_TYPE: return "Room Type";
+        default: return "Unknown";
+    }
+}
+
+string AuditTrail::hashToHex(const AuditHash& hash) {
+    static const char digits[] = "0123456789abcdef";
+    string hex;
+    for (uint8_t byte : hash) {
+        hex += digits[byte >> 4];
+        hex += digits[byte & 0x0F];
+    }
+    return hex;
+}
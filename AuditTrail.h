@@ -0,0 +1,118 @@
+#ifndef AUDITTRAIL_H
+#define AUDITTRAIL_H
+
+#include <string>
+#include <vector>
+#include <array>
+#include <deque>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <fstream>
+#include <cstdint>
+#include <ctime>
+
+using namespace std;
+
+enum AuditAction {
+    AUDIT_PAYMENT = 1,
+    AUDIT_CANCELLATION = 2,
+    AUDIT_PASSWORD_CHANGE = 3,
+    AUDIT_RATE_CHANGE = 4,      // Seasonal or per-room rates set or cleared
+    AUDIT_PRICE_CHANGE = 5      // A room's base price
+};
+
+enum AuditEntity {
+    AUDIT_BILL = 1,
+    AUDIT_RESERVATION = 2,
+    AUDIT_EMPLOYEE = 3,
+    AUDIT_ROOM = 4,
+    AUDIT_ROOM_TYPE = 5
+};
+
+typedef array<uint8_t, 32> AuditHash;   // SHA-256
+
+struct AuditEntry {
+    unsigned long long sequence = 0;    // From 1, in file order
+    long long timestamp = 0;            // Microseconds since the epoch
+    int employeeId = 0;                 // 0 when no employee was logged in
+    AuditAction action = AUDIT_PAYMENT;
+    AuditEntity entity = AUDIT_BILL;
+    int entityId = 0;
+    string before;
+    string after;
+    AuditHash hash{};                   // Chain value up to and including this entry
+};
+
+struct AuditVerification {
+    unsigned long long entries = 0;     // Entries checked
+    bool intact = true;
+    unsigned long long firstBroken = 0; // Sequence where the chain stops matching
+};
+
+// Append-only binary log of who changed what. Each entry's hash is
+// SHA-256(previous hash + entry), so editing, removing or reordering any
+// entry breaks every hash after it; verify() replays the chain.
+//
+// record() only queues the entry; a background thread hashes and appends
+// it. The reader answers by entity and by employee from in-memory indexes
+// of file offsets, built from the entry headers when the file is opened,
+// and reads just the matching entries.
+class AuditTrail {
+private:
+    string path;
+    ofstream file;
+
+    mutable mutex queueMutex;
+    condition_variable wake;
+    condition_variable written;
+    deque<AuditEntry> queue;
+    unsigned long long nextSequence;
+    unsigned long long lastWritten;     // Highest sequence in the file
+    bool stopping;
+
+    mutable mutex indexMutex;
+    AuditHash head;                     // Hash of the last entry written
+    unsigned long long fileSize;
+    unordered_map<unsigned long long, vector<unsigned long long>> byEntity;   // Entity key -> offsets
+    unordered_map<int, vector<pair<long long, unsigned long long>>> byEmployee; // Timestamp, offset
+
+    thread writer;
+
+    explicit AuditTrail(const string& path);
+
+    void run();
+    void load();
+    void index(const AuditEntry& entry, unsigned long long offset);
+    vector<AuditEntry> readAt(const vector<unsigned long long>& offsets) const;
+
+public:
+    // One trail per file in the process, shared by every Database using it.
+    // Throws LoggingException if the file cannot be opened.
+    static shared_ptr<AuditTrail> open(const string& path);
+    ~AuditTrail();
+
+    AuditTrail(const AuditTrail&) = delete;
+    AuditTrail& operator=(const AuditTrail&) = delete;
+
+    void record(int employeeId, AuditAction action, AuditEntity entity, int entityId,
+                const string& before, const string& after);
+    void flush();                       // Returns once every recorded entry is in the file
+
+    // Oldest first; both include entries still queued
+    vector<AuditEntry> findByEntity(AuditEntity entity, int entityId);
+    vector<AuditEntry> findByEmployee(int employeeId, time_t from, time_t to);
+
+    AuditVerification verify();         // Reads the whole file
+    AuditHash getHead();
+    unsigned long long size();
+    string getPath() const;
+
+    static string actionToString(AuditAction action);
+    static string entityToString(AuditEntity entity);
+    static string hashToHex(const AuditHash& hash);
+};
+
+#endif // AUDITTRAIL_H
@@ -1,14 +1,64 @@
 #include "Bill.h"
+#include "Constants.h"
+#include <cstring>
+#include <cstdio>
+#include <unordered_set>
+
+// ==================== DESCRIPTION POOL ====================
+namespace {
+    const vector<string>& pooledDescriptions() {
+        static const vector<string> pool = [] {
+            vector<string> names;
+            names.push_back("Room Charge");
+            for (int nights = 1; nights <= HotelConstants::MAX_STAY_DAYS; nights++) {
+                names.push_back("Room Charge (" + to_string(nights) + " nights)");
+            }
+            for (const auto& entry : HotelConstants::FOOD_ITEMS) {
+                string name = entry.substr(0, entry.find(':'));
+                names.push_back(name);
+                names.push_back("Food - " + name);
+            }
+            for (const auto& entry : HotelConstants::SERVICES) {
+                string name = entry.substr(0, entry.find(':'));
+                names.push_back(name);
+                names.push_back("Service - " + name);
+            }
+            sort(names.begin(), names.end());
+            names.erase(unique(names.begin(), names.end()), names.end());
+            return names;
+        }();
+        return pool;
+    }
+    
+    const unordered_set<string_view>& pooledIndex() {
+        static const unordered_set<string_view> index(pooledDescriptions().begin(),
+                                                      pooledDescriptions().end());
+        return index;
+    }
+}
+
+string_view DescriptionPool::find(string_view description) {
+    const unordered_set<string_view>& index = pooledIndex();
+    auto it = index.find(description);
+    return it != index.end() ? *it : string_view();
+}
+
+size_t DescriptionPool::size() {
+    return pooledDescriptions().size();
+}
 
 // ==================== BILLITEM IMPLEMENTATION ====================
-BillItem::BillItem(const string& desc, double amt, int qty)
+BillItem::BillItem(Key, string_view desc, double amt, int qty)
     : description(desc), amount(amt), quantity(qty) {
     if (desc.empty()) throw ValidationException("Description cannot be empty");
     if (amt <= 0) throw ValidationException("Amount must be positive");
     if (qty <= 0) throw ValidationException("Quantity must be positive");
 }
 
-string BillItem::getDescription() const { return description; }
+BillItem::BillItem() : amount(0.0), quantity(0) {}
+
+string BillItem::getDescription() const { return string(description); }
+string_view BillItem::getDescriptionView() const { return description; }
 double BillItem::getAmount() const { return amount; }
 int BillItem::getQuantity() const { return quantity; }
 
@@ -24,12 +74,17 @@ void BillItem::display() const {
 }
 
 // ==================== BILL IMPLEMENTATION ====================
-Bill::Bill() : billId(0), reservationId(0), taxRate(0.10), discount(0.0),
-               isPaid(false), paymentDate(0) {}
+Bill::ItemStore::ItemStore()
+    : arena(initialBuffer, sizeof(initialBuffer)), items(&arena) {
+    items.reserve(8);
+}
+
+Bill::Bill() : billId(0), reservationId(0), store(make_unique<ItemStore>()),
+               taxRate(0.10), discount(0.0), isPaid(false), paymentDate(0) {}
 
 Bill::Bill(int id, int resId, double tax, double disc)
-    : billId(id), reservationId(resId), taxRate(tax), discount(disc),
-      isPaid(false), paymentDate(0) {
+    : billId(id), reservationId(resId), store(make_unique<ItemStore>()),
+      taxRate(tax), discount(disc), isPaid(false), paymentDate(0) {
     
     if (id <= 0) throw ValidationException("Bill ID must be positive");
     if (resId <= 0) throw ValidationException("Reservation ID must be positive");
@@ -37,6 +92,53 @@ Bill::Bill(int id, int resId, double tax, double disc)
     if (disc < 0 || disc > 1) throw ValidationException("Discount must be between 0 and 1");
 }
 
+// Copies get their own arena; interned descriptions are shared, the rest re-stored
+Bill::Bill(const Bill& other)
+    : billId(other.billId), reservationId(other.reservationId),
+      store(make_unique<ItemStore>()), taxRate(other.taxRate),
+      discount(other.discount), paymentMethod(other.paymentMethod),
+      paymentDate(other.paymentDate), isPaid(other.isPaid) {
+    store->items.reserve(other.store->items.size());
+    for (const auto& item : other.store->items) {
+        store->items.emplace_back(BillItem::Key(), storeDescription(item.getDescriptionView()),
+                                  item.getAmount(), item.getQuantity());
+    }
+}
+
+// The items move with the arena; the moved-from bill gets an empty store of
+// its own so it stays usable
+Bill::Bill(Bill&& other) noexcept
+    : billId(other.billId), reservationId(other.reservationId),
+      store(make_unique<ItemStore>()), taxRate(other.taxRate),
+      discount(other.discount), paymentMethod(std::move(other.paymentMethod)),
+      paymentDate(other.paymentDate), isPaid(other.isPaid) {
+    store.swap(other.store);
+}
+
+Bill& Bill::operator=(const Bill& other) {
+    if (this != &other) {
+        Bill copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// Swapping hands other this bill's old arena, emptied, instead of allocating
+Bill& Bill::operator=(Bill&& other) noexcept {
+    if (this != &other) {
+        billId = other.billId;
+        reservationId = other.reservationId;
+        taxRate = other.taxRate;
+        discount = other.discount;
+        paymentMethod = std::move(other.paymentMethod);
+        paymentDate = other.paymentDate;
+        isPaid = other.isPaid;
+        store.swap(other.store);
+        other.store->items.clear();
+    }
+    return *this;
+}
+
 // ==================== GETTERS ====================
 int Bill::getBillId() const { return billId; }
 int Bill::getReservationId() const { return reservationId; }
@@ -46,46 +148,72 @@ string Bill::getPaymentMethod() const { return paymentMethod; }
 
 string Bill::getPaymentDate() const {
     if (paymentDate == 0) return "Not paid";
-    return Utils::formatDate(paymentDate);
+    return Utils::formatLocalDate(paymentDate);
 }
 
+time_t Bill::getRawPaymentDate() const { return paymentDate; }
+
 bool Bill::getIsPaid() const { return isPaid; }
+const pmr::vector<BillItem>& Bill::getItems() const { return store->items; }
 
 // ==================== BILL ITEMS MANAGEMENT ====================
-void Bill::addItem(const string& description, double amount, int quantity) {
-    items.push_back(BillItem(description, amount, quantity));
+void Bill::addItem(string_view description, double amount, int quantity) {
+    store->items.emplace_back(BillItem::Key(), storeDescription(description), amount, quantity);
 }
 
 void Bill::addRoomCharge(double amount, int nights) {
-    string desc = "Room Charge (" + to_string(nights) + " nights)";
-    addItem(desc, amount, nights);
+    char desc[48];
+    int length = snprintf(desc, sizeof(desc), "Room Charge (%d nights)", nights);
+    store->items.emplace_back(BillItem::Key(), storeDescription(string_view(desc, length)), amount, nights);
 }
 
-void Bill::addFoodCharge(const string& item, double amount, int quantity) {
-    string desc = "Food - " + item;
-    addItem(desc, amount, quantity);
+void Bill::addFoodCharge(string_view item, double amount, int quantity) {
+    store->items.emplace_back(BillItem::Key(), storeDescription("Food - ", item), amount, quantity);
 }
 
-void Bill::addServiceCharge(const string& service, double amount) {
-    string desc = "Service - " + service;
-    addItem(desc, amount);
+void Bill::addServiceCharge(string_view service, double amount) {
+    store->items.emplace_back(BillItem::Key(), storeDescription("Service - ", service), amount, 1);
 }
 
 void Bill::removeItem(int index) {
-    if (index < 0 || index >= (int)items.size()) {
+    if (index < 0 || index >= (int)store->items.size()) {
         throw ValidationException("Invalid item index");
     }
-    items.erase(items.begin() + index);
+    store->items.erase(store->items.begin() + index);
 }
 
 void Bill::clearItems() {
-    items.clear();
+    store->items.clear();
+}
+
+string_view Bill::storeDescription(string_view description) {
+    string_view interned = DescriptionPool::find(description);
+    if (!interned.empty() || description.empty()) {
+        return interned;
+    }
+    char* copy = static_cast<char*>(store->arena.allocate(description.size(), 1));
+    memcpy(copy, description.data(), description.size());
+    return string_view(copy, description.size());
+}
+
+string_view Bill::storeDescription(string_view prefix, string_view text) {
+    char buffer[128];
+    size_t length = prefix.size() + text.size();
+    if (length > sizeof(buffer)) {
+        char* joined = static_cast<char*>(store->arena.allocate(length, 1));
+        memcpy(joined, prefix.data(), prefix.size());
+        memcpy(joined + prefix.size(), text.data(), text.size());
+        return string_view(joined, length);
+    }
+    memcpy(buffer, prefix.data(), prefix.size());
+    memcpy(buffer + prefix.size(), text.data(), text.size());
+    return storeDescription(string_view(buffer, length));
 }
 
 // ==================== CALCULATIONS ====================
 double Bill::calculateSubtotal() const {
     double subtotal = 0.0;
-    for (const auto& item : items) {
+    for (const auto& item : store->items) {
         subtotal += item.getTotal();
     }
     return subtotal;
@@ -156,12 +284,12 @@ void Bill::display() const {
 void Bill::displayDetailed() const {
     display();
     
-    if (!items.empty()) {
+    if (!store->items.empty()) {
         cout << "\n══════════════════════════════════════════════\n";
         cout << "              ITEMIZED BREAKDOWN\n";
         cout << "══════════════════════════════════════════════\n";
         
-        for (const auto& item : items) {
+        for (const auto& item : store->items) {
             item.display();
         }
         
@@ -173,47 +301,62 @@ void Bill::displayDetailed() const {
 void Bill::saveToFile(ofstream& file) const {
     if (!file.is_open()) throw FileException("File is not open for writing");
     
-    file << billId << " "
-         << reservationId << " "
-         << taxRate << " "
-         << discount << " "
-         << isPaid << " "
-         << paymentMethod << " "
-         << paymentDate << " "
-         << items.size() << "\n";
-    
-    for (const auto& item : items) {
-        file << item.getDescription() << "|"
-             << item.getAmount() << "|"
-             << item.getQuantity() << "\n";
+    string block;
+    Serialization::appendText(block, *this);
+    block += to_string(store->items.size());
+    block.push_back('\n');
+    for (const auto& item : store->items) {
+        Serialization::appendText(block, item);
     }
+    file.write(block.data(), static_cast<streamsize>(block.size()));
 }
 
 void Bill::loadFromFile(ifstream& file) {
     if (!file.is_open()) throw FileException("File is not open for reading");
     
-    int itemCount;
-    file >> billId >> reservationId >> taxRate >> discount 
-         >> isPaid >> paymentMethod >> paymentDate >> itemCount;
+    Serialization::TextReader reader;
+    if (!Serialization::readText(file, *this, reader)) {
+        throw FileReadException("bills", "unexpected end of file");
+    }
+    
+    int itemCount = 0;
+    if (!getline(file, reader.line) || !Serialization::detail::parseScalar(string_view(reader.line), itemCount)) {
+        throw FileCorruptedException("bills", "bad item count for bill " + to_string(billId));
+    }
+    loadItems(file, itemCount, reader);
+}
+
+// id reservation tax discount paid method... paymentDate itemCount, then the
+// items as today. Unpaid bills have no method word.
+void Bill::loadLegacyFromFile(ifstream& file) {
+    vector<string> words;
+    if (!Serialization::readLegacyWords(file, words)) throw FileReadException("bills", "unexpected end of file");
+    if (words.size() < 7) throw FileCorruptedException("bills", "short legacy record");
+    
+    size_t last = words.size();
+    billId = Serialization::legacyValue<int>(words[0], "bills");
+    reservationId = Serialization::legacyValue<int>(words[1], "bills");
+    taxRate = Serialization::legacyValue<double>(words[2], "bills");
+    discount = Serialization::legacyValue<double>(words[3], "bills");
+    isPaid = Serialization::legacyValue<bool>(words[4], "bills");
+    paymentMethod = Serialization::joinWords(words, 5, last - 2);
+    paymentDate = Serialization::legacyValue<time_t>(words[last - 2], "bills");
+    int itemCount = Serialization::legacyValue<int>(words[last - 1], "bills");
     
-    items.clear();
+    Serialization::TextReader reader;
+    loadItems(file, itemCount, reader);
+}
+
+void Bill::loadItems(ifstream& file, int itemCount, Serialization::TextReader& reader) {
+    store->items.clear();
+    store->items.reserve(itemCount);
+    BillItem item;
     for (int i = 0; i < itemCount; i++) {
-        string line;
-        getline(file, line);
-        
-        if (!line.empty()) {
-            stringstream ss(line);
-            string desc, amountStr, qtyStr;
-            
-            getline(ss, desc, '|');
-            getline(ss, amountStr, '|');
-            getline(ss, qtyStr, '|');
-            
-            double amount = stod(amountStr);
-            int quantity = stoi(qtyStr);
-            
-            items.push_back(BillItem(desc, amount, quantity));
+        if (!Serialization::readText(file, item, reader)) {
+            throw FileReadException("bills", "missing items for bill " + to_string(billId));
         }
+        // The view points into reader scratch; addItem copies it into the arena
+        addItem(item.description, item.amount, item.quantity);
     }
 }
 
@@ -4,41 +4,91 @@
 #include "Utils.h"
 #include "Reservation.h"
 #include <vector>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+
+// Immutable table of frequently posted descriptions: "Room Charge" variants
+// and the FOOD_ITEMS / SERVICES names from Constants.h. Built on first use;
+// returned views stay valid for the lifetime of the program.
+class DescriptionPool {
+public:
+    // Interned copy of the description, or an empty view if it is not pooled
+    static string_view find(string_view description);
+    static size_t size();
+};
 
 class BillItem {
+    template <class T> friend struct Schema;
+    friend class Bill;
+    
 private:
-    string description;
+    string_view description;  // Interned, or stored in the owning bill's arena
     double amount;
     int quantity;
     
 public:
-    BillItem(const string& desc, double amt, int qty = 1);
+    // Only a bill can make items: the description is not copied, so it must
+    // already be interned or stored in the bill's arena
+    class Key {
+        friend class Bill;
+        Key() {}
+    };
+    
+    BillItem(Key, string_view desc, double amt, int qty = 1);
+    // Items move with their bill's vector but are never copied out of it
+    BillItem(BillItem&& other) noexcept = default;
+    BillItem& operator=(BillItem&& other) noexcept = default;
+    BillItem(const BillItem&) = delete;
+    BillItem& operator=(const BillItem&) = delete;
     
     // Getters
     string getDescription() const;
+    string_view getDescriptionView() const;   // Valid while the owning bill is unchanged
     double getAmount() const;
     int getQuantity() const;
     double getTotal() const;
     
     // Display
     void display() const;
+    
+private:
+    BillItem();  // Only for deserialization
 };
 
 class Bill {
+    template <class T> friend struct Schema;
+    
 private:
+    // Items and their non-interned descriptions are carved from one monotonic
+    // arena per bill and released together when the bill is destroyed
+    struct ItemStore {
+        char initialBuffer[512];
+        pmr::monotonic_buffer_resource arena;
+        pmr::vector<BillItem> items;
+        
+        ItemStore();
+    };
+    
     int billId;
     int reservationId;
-    vector<BillItem> items;
+    unique_ptr<ItemStore> store;
     double taxRate;
     double discount;
     string paymentMethod;
     time_t paymentDate;
     bool isPaid;
     
+    void loadItems(ifstream& file, int itemCount, Serialization::TextReader& reader);
+    
 public:
     // Constructors
     Bill();
     Bill(int id, int resId, double tax = 0.10, double disc = 0.0);
+    Bill(const Bill& other);
+    Bill(Bill&& other) noexcept;              // Leaves other with no items
+    Bill& operator=(const Bill& other);
+    Bill& operator=(Bill&& other) noexcept;
     
     // Getters
     int getBillId() const;
@@ -47,13 +97,15 @@ public:
     double getDiscount() const;
     string getPaymentMethod() const;
     string getPaymentDate() const;
+    time_t getRawPaymentDate() const;
     bool getIsPaid() const;
+    const pmr::vector<BillItem>& getItems() const;
     
     // Bill items management
-    void addItem(const string& description, double amount, int quantity = 1);
+    void addItem(string_view description, double amount, int quantity = 1);
     void addRoomCharge(double amount, int nights);
-    void addFoodCharge(const string& item, double amount, int quantity = 1);
-    void addServiceCharge(const string& service, double amount);
+    void addFoodCharge(string_view item, double amount, int quantity = 1);
+    void addServiceCharge(string_view service, double amount);
     void removeItem(int index);
     void clearItems();
     
@@ -75,9 +127,35 @@ public:
     // File operations
     void saveToFile(ofstream& file) const;
     void loadFromFile(ifstream& file);
+    void loadLegacyFromFile(ifstream& file);   // Space-separated files from before the schema tables
     
     // Validation
     bool isValid() const;
+    
+private:
+    string_view storeDescription(string_view description);
+    string_view storeDescription(string_view prefix, string_view text);
+};
+
+template <>
+struct Schema<BillItem> {
+    static constexpr auto fields = make_tuple(
+        field("description", &BillItem::description),
+        field("amount", &BillItem::amount),
+        field("quantity", &BillItem::quantity));
+};
+
+// Items follow the bill record as a count line plus one BillItem record each
+template <>
+struct Schema<Bill> {
+    static constexpr auto fields = make_tuple(
+        field("billId", &Bill::billId),
+        field("reservationId", &Bill::reservationId),
+        field("taxRate", &Bill::taxRate),
+        field("discount", &Bill::discount),
+        field("isPaid", &Bill::isPaid),
+        field("paymentMethod", &Bill::paymentMethod),
+        field("paymentDate", &Bill::paymentDate, FieldKind::Timestamp));
 };
 
 #endif // BILL_H
\ No newline at end of file
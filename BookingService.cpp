@@ -0,0 +1,460 @@
+#include "BookingService.h"
+#include "Exceptions.h"
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+#include <deque>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <afunix.h>
+    #pragma comment(lib, "Ws2_32.lib")
+    typedef SOCKET SocketHandle;
+    static const SocketHandle NO_SOCKET = INVALID_SOCKET;
+    #define pollSockets WSAPoll
+    #define closeSocket closesocket
+    #define MSG_NOSIGNAL 0
+#else
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <poll.h>
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <cerrno>
+    #include <csignal>
+    typedef int SocketHandle;
+    static const SocketHandle NO_SOCKET = -1;
+    #define pollSockets poll
+    #define closeSocket close
+    #ifndef MSG_NOSIGNAL
+        #define MSG_NOSIGNAL 0
+    #endif
+#endif
+
+const char* const BookingService::DEFAULT_SOCKET = "hotel.sock";
+
+// ==================== SOCKET HELPERS ====================
+namespace {
+    const size_t MAX_LINE = 4096;       // Longer requests close the connection
+    const int POLL_INTERVAL_MS = 200;   // How soon the loop notices stop()
+
+    void startSockets() {
+        #ifdef _WIN32
+            static bool started = false;
+            static mutex startMutex;
+            lock_guard<mutex> lock(startMutex);
+            if (!started) {
+                WSADATA data;
+                if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+                    throw SystemException("Sockets", "WSAStartup failed");
+                }
+                started = true;
+            }
+        #else
+            // A client that hangs up mid-reply must not stop the process
+            signal(SIGPIPE, SIG_IGN);
+        #endif
+    }
+
+    sockaddr_un socketAddress(const string& path) {
+        sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+            throw SystemException("Booking service", "Socket path must be 1-" +
+                                  to_string(sizeof(address.sun_path) - 1) + " characters");
+        }
+        memcpy(address.sun_path, path.c_str(), path.size());
+        return address;
+    }
+
+    void setNonBlocking(SocketHandle socket) {
+        #ifdef _WIN32
+            u_long on = 1;
+            ioctlsocket(socket, FIONBIO, &on);
+        #else
+            fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK);
+        #endif
+    }
+
+    bool wouldBlock() {
+        #ifdef _WIN32
+            return WSAGetLastError() == WSAEWOULDBLOCK;
+        #else
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        #endif
+    }
+
+    SocketHandle connectTo(const string& path) {
+        startSockets();
+        sockaddr_un address = socketAddress(path);
+        SocketHandle socket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socket == NO_SOCKET) throw SystemException("Booking client", "Cannot create socket");
+        if (connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            closeSocket(socket);
+            throw SystemException("Booking client", "Cannot connect to " + path);
+        }
+        return socket;
+    }
+}
+
+// Per-client state, touched only by the loop thread
+struct BookingService::Connection {
+    long long id = 0;
+    SocketHandle socket = NO_SOCKET;
+    string input;
+    string output;
+    deque<string> pending;      // Complete lines not yet handed to a worker
+    bool busy = false;          // A worker has this connection's request
+    bool closing = false;       // Drop once the output is written
+};
+
+// ==================== CONSTRUCTOR ====================
+BookingService::BookingService(Database& database, const string& socketPath, unsigned workerThreads)
+    : commands(database), socketPath(socketPath), workers(workerThreads), stopping(false),
+      connectionCount(0), running(0), wakeSocket(static_cast<intptr_t>(NO_SOCKET)) {}
+
+// ==================== PROTOCOL ====================
+string BookingService::handle(const string& request) {
+    return commands.handle(request);
+}
+
+// ==================== EVENT LOOP ====================
+void BookingService::dispatch(Connection& connection) {
+    if (connection.busy || connection.pending.empty()) return;
+    string line = move(connection.pending.front());
+    connection.pending.pop_front();
+    connection.busy = true;
+
+    long long id = connection.id;
+    running++;
+    workers.submit([this, id, line]() {
+        string reply = handle(line);
+        {
+            lock_guard<mutex> lock(finishedMutex);
+            finished.emplace_back(id, move(reply));
+        }
+        wake();
+        running--;
+    });
+}
+
+void BookingService::wake() {
+    char signal = 1;
+    // A full wake socket already has a wake-up waiting
+    send(static_cast<SocketHandle>(wakeSocket), &signal, 1, MSG_NOSIGNAL);
+}
+
+void BookingService::stop() {
+    stopping = true;
+}
+
+void BookingService::run() {
+    startSockets();
+    sockaddr_un address = socketAddress(socketPath);
+    remove(socketPath.c_str());     // Left behind by a process that did not shut down
+
+    SocketHandle listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener == NO_SOCKET) throw SystemException("Booking service", "Cannot create socket");
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listener, SOMAXCONN) != 0) {
+        closeSocket(listener);
+        throw SystemException("Booking service", "Cannot listen on " + socketPath);
+    }
+
+    // Workers wake the loop by writing to a connection the loop opens to itself,
+    // which works on every platform poll() does
+    SocketHandle wakeWriter = NO_SOCKET, wakeReader = NO_SOCKET;
+    try {
+        wakeWriter = connectTo(socketPath);
+    } catch (const HotelException&) {
+        closeSocket(listener);
+        throw;
+    }
+    wakeReader = accept(listener, nullptr, nullptr);
+    setNonBlocking(listener);
+    setNonBlocking(wakeReader);
+    setNonBlocking(wakeWriter);
+    wakeSocket = static_cast<intptr_t>(wakeWriter);
+
+    unordered_map<long long, unique_ptr<Connection>> connections;
+    long long nextConnectionId = 1;
+    vector<pollfd> polled;
+    vector<long long> polledIds;
+    char buffer[8192];
+
+    auto flush = [&](Connection& connection) {
+        while (!connection.output.empty()) {
+            int sent = static_cast<int>(send(connection.socket, connection.output.data(),
+                                             static_cast<int>(connection.output.size()), MSG_NOSIGNAL));
+            if (sent <= 0) {
+                if (sent < 0 && wouldBlock()) return;
+                connection.output.clear();
+                connection.closing = true;
+                return;
+            }
+            connection.output.erase(0, sent);
+        }
+    };
+
+    while (!stopping) {
+        polled.clear();
+        polledIds.clear();
+        polled.push_back({listener, POLLIN, 0});
+        polled.push_back({wakeReader, POLLIN, 0});
+        for (const auto& entry : connections) {
+            const Connection& connection = *entry.second;
+            short events = connection.closing ? 0 : POLLIN;
+            if (!connection.output.empty()) events |= POLLOUT;
+            polled.push_back({connection.socket, events, 0});
+            polledIds.push_back(entry.first);
+        }
+
+        int ready = pollSockets(polled.data(), static_cast<unsigned long>(polled.size()), POLL_INTERVAL_MS);
+        if (ready < 0 && !wouldBlock()) break;
+
+        // Replies first, so their connections can take the next line
+        if (polled[1].revents & POLLIN) {
+            while (recv(wakeReader, buffer, sizeof(buffer), 0) > 0) {}
+        }
+        vector<pair<long long, string>> replies;
+        {
+            lock_guard<mutex> lock(finishedMutex);
+            replies.swap(finished);
+        }
+        for (auto& reply : replies) {
+            auto found = connections.find(reply.first);
+            if (found == connections.end()) continue;     // Client left while its request ran
+            Connection& connection = *found->second;
+            connection.busy = false;
+            connection.output += reply.second;
+            connection.output += '\n';
+            flush(connection);
+            dispatch(connection);
+        }
+
+        for (size_t i = 2; i < polled.size(); i++) {
+            auto found = connections.find(polledIds[i - 2]);
+            if (found == connections.end()) continue;
+            Connection& connection = *found->second;
+            short events = polled[i].revents;
+
+            if (events & POLLOUT) flush(connection);
+            if (events & (POLLIN | POLLHUP | POLLERR)) {
+                int received = static_cast<int>(recv(connection.socket, buffer, sizeof(buffer), 0));
+                if (received <= 0) {
+                    if (received < 0 && wouldBlock()) continue;
+                    connection.closing = true;
+                    connection.output.clear();
+                    continue;
+                }
+                connection.input.append(buffer, received);
+
+                size_t start = 0, end;
+                while ((end = connection.input.find('\n', start)) != string::npos) {
+                    string line = connection.input.substr(start, end - start);
+                    start = end + 1;
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    string command = Utils::trim(line);
+                    transform(command.begin(), command.end(), command.begin(), ::toupper);
+                    if (command == "QUIT") {
+                        connection.closing = true;
+                        connection.pending.clear();
+                        break;
+                    }
+                    if (!command.empty()) connection.pending.push_back(line);
+                }
+                connection.input.erase(0, start);
+                if (connection.input.size() > MAX_LINE) {
+                    connection.output += "ERR Request too long\n";
+                    connection.closing = true;
+                    connection.pending.clear();
+                    flush(connection);
+                }
+                dispatch(connection);
+            }
+        }
+
+        // Close connections that are done, once their in-flight reply has come back
+        for (auto entry = connections.begin(); entry != connections.end();) {
+            Connection& connection = *entry->second;
+            if (connection.closing && !connection.busy && connection.output.empty()) {
+                closeSocket(connection.socket);
+                entry = connections.erase(entry);
+            } else {
+                ++entry;
+            }
+        }
+
+        if (polled[0].revents & POLLIN) {
+            SocketHandle client;
+            while ((client = accept(listener, nullptr, nullptr)) != NO_SOCKET) {
+                setNonBlocking(client);
+                auto connection = make_unique<Connection>();
+                connection->id = nextConnectionId++;
+                connection->socket = client;
+                connections[connection->id] = move(connection);
+                connectionCount++;
+            }
+        }
+    }
+
+    // Requests already running finish against the Database before it is released
+    while (running > 0) this_thread::sleep_for(chrono::milliseconds(1));
+    for (auto& entry : connections) closeSocket(entry.second->socket);
+    closeSocket(wakeReader);
+    closeSocket(wakeWriter);
+    closeSocket(listener);
+    wakeSocket = static_cast<intptr_t>(NO_SOCKET);
+    {
+        lock_guard<mutex> lock(finishedMutex);
+        finished.clear();
+    }
+    remove(socketPath.c_str());
+}
+
+ServiceStats BookingService::getStats() const {
+    ServiceStats stats;
+    stats.connections = connectionCount;
+    stats.requests = commands.getRequestCount();
+    stats.errors = commands.getErrorCount();
+    return stats;
+}
+
+// ==================== CLIENT ====================
+BookingClient::BookingClient(const string& socketPath)
+    : socket(static_cast<intptr_t>(connectTo(socketPath))) {}
+
+BookingClient::~BookingClient() {
+    closeSocket(static_cast<SocketHandle>(socket));
+}
+
+string BookingClient::request(const string& line) {
+    SocketHandle handle = static_cast<SocketHandle>(socket);
+    string message = line + "\n";
+    size_t written = 0;
+    while (written < message.size()) {
+        int sent = static_cast<int>(send(handle, message.data() + written,
+                                         static_cast<int>(message.size() - written), MSG_NOSIGNAL));
+        if (sent <= 0) throw SystemException("Booking client", "Connection lost");
+        written += sent;
+    }
+
+    size_t end;
+    char chunk[4096];
+    while ((end = buffer.find('\n')) == string::npos) {
+        int received = static_cast<int>(recv(handle, chunk, sizeof(chunk), 0));
+        if (received <= 0) throw SystemException("Booking client", "Connection lost");
+        buffer.append(chunk, received);
+    }
+    string reply = buffer.substr(0, end);
+    buffer.erase(0, end + 1);
+    return reply;
+}
+
+// ==================== LOAD GENERATOR ====================
+LoadReport runLoadGenerator(const string& socketPath, int clients, int requestsPerClient) {
+    if (clients <= 0 || requestsPerClient <= 0) {
+        throw ValidationException("Clients and requests per client must be positive");
+    }
+
+    // Rooms come from the service itself, so any data directory works
+    vector<int> rooms;
+    int today = Utils::getTodayEpochDay();
+    {
+        BookingClient probe(socketPath);
+        string far = Utils::formatDate(Calendar::fromEpochDay(today + 360));
+        string farEnd = Utils::formatDate(Calendar::fromEpochDay(today + 361));
+        for (int type = STANDARD; type <= PRESIDENTIAL; type++) {
+            istringstream reply(probe.request("AVAIL " + to_string(type) + " " + far + " " + farEnd + " 1 100"));
+            string word;
+            reply >> word;
+            while (reply >> word) rooms.push_back(stoi(word.substr(0, word.find(':'))));
+        }
+    }
+    if (rooms.empty()) throw ValidationException("The service has no rooms to book");
+
+    vector<vector<long long>> latencies(clients);
+    vector<long long> errors(clients, 0);
+    vector<thread> threads;
+
+    auto start = chrono::steady_clock::now();
+    for (int c = 0; c < clients; c++) {
+        threads.emplace_back([&, c]() {
+            mt19937 rng(1000 + c);
+            BookingClient client(socketPath);
+            vector<long long>& timings = latencies[c];
+            timings.reserve(requestsPerClient);
+
+            // Each client walks its own guest through a stay between lookups
+            static const char* const STAY[] = {"BOOK", "CHECKIN", "CHARGE", "PAY", "CHECKOUT"};
+            int step = 0, reservation = 0;
+            vector<int> booked;
+            for (int i = 0; i < requestsPerClient; i++) {
+                string line;
+                int roll = static_cast<int>(rng() % 100);
+                int room = rooms[rng() % rooms.size()];
+                bool staying = false;
+                if (roll < 40) {
+                    line = "ROOM " + to_string(room);
+                } else if (roll < 55 && !booked.empty()) {
+                    line = "RES " + to_string(booked[rng() % booked.size()]);
+                } else if (roll < 70) {
+                    int first = today + 1 + static_cast<int>(rng() % 300);
+                    line = "AVAIL " + to_string(STANDARD + rng() % 4) + " " +
+                           Utils::formatDate(Calendar::fromEpochDay(first)) + " " +
+                           Utils::formatDate(Calendar::fromEpochDay(first + 1 + rng() % 5)) + " 1";
+                } else if (step == 0) {
+                    staying = true;
+                    line = "BOOK 1001 " + to_string(room) + " " + Utils::formatDate(Calendar::fromEpochDay(today)) +
+                           " " + Utils::formatDate(Calendar::fromEpochDay(today + 1 + rng() % 3)) + " 1";
+                } else {
+                    staying = true;
+                    line = string(STAY[step]) + " " + to_string(reservation);
+                    if (step == 2) line += " 25.50 Minibar";
+                    if (step == 3) line += " Card";
+                }
+
+                auto sent = chrono::steady_clock::now();
+                string reply = client.request(line);
+                timings.push_back(chrono::duration_cast<chrono::microseconds>(
+                    chrono::steady_clock::now() - sent).count());
+
+                if (reply.compare(0, 2, "OK") != 0) {
+                    // A room someone else holds is a normal refusal, not a failure
+                    if (!staying || step != 0) errors[c]++;
+                    if (staying) step = 0;
+                } else if (staying) {
+                    if (step == 0) {
+                        reservation = stoi(reply.substr(3));
+                        booked.push_back(reservation);
+                    }
+                    step = (step + 1) % 5;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    vector<long long> all;
+    LoadReport report;
+    for (int c = 0; c < clients; c++) {
+        all.insert(all.end(), latencies[c].begin(), latencies[c].end());
+        report.errors += errors[c];
+    }
+    sort(all.begin(), all.end());
+    report.clients = clients;
+    report.requests = static_cast<long long>(all.size());
+    report.seconds = seconds;
+    report.requestsPerSecond = seconds > 0 ? report.requests / seconds : 0.0;
+    report.p50Micros = static_cast<double>(all[all.size() / 2]);
+    report.p99Micros = static_cast<double>(all[min(all.size() - 1, all.size() * 99 / 100)]);
+    report.maxMicros = static_cast<double>(all.back());
+    return report;
+}
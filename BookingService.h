@@ -0,0 +1,95 @@
+#ifndef BOOKING_SERVICE_H
+#define BOOKING_SERVICE_H
+
+#include "CommandProcessor.h"
+#include "ThreadPool.h"
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <memory>
+
+struct ServiceStats {
+    long long connections = 0;
+    long long requests = 0;
+    long long errors = 0;       // Requests answered with ERR
+};
+
+// Headless front end: one process owns the Database and serves front-desk
+// clients over a local Unix domain socket, speaking the CommandProcessor
+// protocol (QUIT closes the connection).
+//
+// One thread runs a poll() loop over the listening socket and every client;
+// complete lines go to a worker pool, one request per connection at a time so
+// replies keep their order. Workers call the Database concurrently, so
+// lookups run side by side and only writes to the same tables wait.
+class BookingService {
+public:
+    struct Connection;
+
+private:
+    CommandProcessor commands;
+    string socketPath;
+    ThreadPool workers;
+    atomic<bool> stopping;
+    atomic<long long> connectionCount;
+    atomic<int> running;            // Requests handed to workers and not yet answered
+
+    // Replies finished by workers, picked up by the loop
+    mutex finishedMutex;
+    vector<pair<long long, string>> finished;
+    intptr_t wakeSocket;
+
+    void dispatch(Connection& connection);
+    void wake();
+
+public:
+    static const char* const DEFAULT_SOCKET;
+
+    // workerThreads = 0 uses one worker per hardware thread
+    BookingService(Database& database, const string& socketPath, unsigned workerThreads = 0);
+
+    BookingService(const BookingService&) = delete;
+    BookingService& operator=(const BookingService&) = delete;
+
+    // One request line without its newline. Safe to call from any thread.
+    string handle(const string& request);
+
+    // Serves until stop(); throws SystemException if the socket cannot be set up
+    void run();
+    void stop();   // Only sets a flag, so it is safe from a signal handler
+    ServiceStats getStats() const;
+};
+
+// Blocking client for one connection, used by the load generator and tests
+class BookingClient {
+private:
+    intptr_t socket;
+    string buffer;
+
+public:
+    explicit BookingClient(const string& socketPath);
+    ~BookingClient();
+
+    BookingClient(const BookingClient&) = delete;
+    BookingClient& operator=(const BookingClient&) = delete;
+
+    string request(const string& line);   // Throws SystemException if the service goes away
+};
+
+struct LoadReport {
+    int clients = 0;
+    long long requests = 0;
+    long long errors = 0;
+    double seconds = 0.0;
+    double requestsPerSecond = 0.0;
+    double p50Micros = 0.0;
+    double p99Micros = 0.0;
+    double maxMicros = 0.0;
+};
+
+// Each client runs a mix of lookups and full stays (book, check in, charge,
+// pay, check out) against the rooms the service reports. It changes the
+// data, so point it at a scratch data directory.
+LoadReport runLoadGenerator(const string& socketPath, int clients, int requestsPerClient);
+
+#endif // BOOKING_SERVICE_H
@@ -0,0 +1,121 @@
+#ifndef CALENDAR_H
+#define CALENDAR_H
+
+#include <cstddef>
+#include <ctime>
+
+// Civil-date arithmetic on the proleptic Gregorian calendar.
+// Days are counted from 1970-01-01 (epoch day 0). Nothing here allocates,
+// touches the C library time zone state or keeps statics, so every function
+// is safe to call from any thread and usable in constant expressions.
+namespace Calendar {
+    const int SECONDS_PER_DAY = 86400;
+    const size_t DATE_LENGTH = 10;  // "YYYY-MM-DD"
+
+    struct CivilDate {
+        int year;
+        int month;  // 1-12
+        int day;    // 1-31
+    };
+
+    constexpr bool isLeapYear(int year) {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    constexpr int daysInMonth(int year, int month) {
+        return month == 2 ? (isLeapYear(year) ? 29 : 28)
+                          : (month == 4 || month == 6 || month == 9 || month == 11) ? 30 : 31;
+    }
+
+    // Floor division, so instants before the epoch land on the right day
+    constexpr long long floorDiv(long long value, long long divisor) {
+        return value / divisor - ((value % divisor != 0) && ((value < 0) != (divisor < 0)) ? 1 : 0);
+    }
+
+    // Days since 1970-01-01 for a civil date (H. Hinnant's days_from_civil)
+    constexpr int daysFromCivil(int year, int month, int day) {
+        const int y = year - (month <= 2 ? 1 : 0);
+        const int era = (y >= 0 ? y : y - 399) / 400;
+        const int yoe = y - era * 400;                                   // [0, 399]
+        const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;  // [0, 365]
+        const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;           // [0, 146096]
+        return era * 146097 + doe - 719468;
+    }
+
+    constexpr CivilDate civilFromDays(int days) {
+        const int z = days + 719468;
+        const int era = (z >= 0 ? z : z - 146096) / 146097;
+        const int doe = z - era * 146097;                                // [0, 146096]
+        const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);         // [0, 365]
+        const int mp = (5 * doy + 2) / 153;                              // [0, 11]
+        const int day = doy - (153 * mp + 2) / 5 + 1;
+        const int month = mp < 10 ? mp + 3 : mp - 9;
+        return CivilDate{yoe + era * 400 + (month <= 2 ? 1 : 0), month, day};
+    }
+
+    // 0 = Sunday ... 6 = Saturday
+    constexpr int weekday(int days) {
+        return days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6;
+    }
+
+    // Date values (check-in, check-out) are stored as the UTC midnight of the
+    // civil day, so converting between the two never depends on DST rules.
+    constexpr int toEpochDay(time_t t) {
+        return static_cast<int>(floorDiv(static_cast<long long>(t), SECONDS_PER_DAY));
+    }
+
+    constexpr time_t fromEpochDay(int days) {
+        return static_cast<time_t>(days) * SECONDS_PER_DAY;
+    }
+
+    // Parses exactly "YYYY-MM-DD". Returns false on a malformed string or an
+    // impossible date (e.g. 2023-02-30) and leaves epochDay untouched.
+    constexpr bool parse(const char* text, size_t length, int& epochDay) {
+        if (text == nullptr || length != DATE_LENGTH) return false;
+        if (text[4] != '-' || text[7] != '-') return false;
+
+        int fields[3] = {0, 0, 0};
+        const size_t starts[3] = {0, 5, 8};
+        const size_t widths[3] = {4, 2, 2};
+        for (int f = 0; f < 3; f++) {
+            for (size_t i = 0; i < widths[f]; i++) {
+                const char c = text[starts[f] + i];
+                if (c < '0' || c > '9') return false;
+                fields[f] = fields[f] * 10 + (c - '0');
+            }
+        }
+
+        const int year = fields[0], month = fields[1], day = fields[2];
+        if (month < 1 || month > 12) return false;
+        if (day < 1 || day > daysInMonth(year, month)) return false;
+
+        epochDay = daysFromCivil(year, month, day);
+        return true;
+    }
+
+    // Writes "YYYY-MM-DD" into out[0..9] without a terminator.
+    // Years outside 0000-9999 are clamped to keep the fixed width.
+    constexpr void format(int epochDay, char* out) {
+        const CivilDate date = civilFromDays(epochDay);
+        int year = date.year < 0 ? 0 : (date.year > 9999 ? 9999 : date.year);
+        for (int i = 3; i >= 0; i--) {
+            out[i] = static_cast<char>('0' + year % 10);
+            year /= 10;
+        }
+        out[4] = '-';
+        out[5] = static_cast<char>('0' + date.month / 10);
+        out[6] = static_cast<char>('0' + date.month % 10);
+        out[7] = '-';
+        out[8] = static_cast<char>('0' + date.day / 10);
+        out[9] = static_cast<char>('0' + date.day % 10);
+    }
+
+    static_assert(daysFromCivil(1970, 1, 1) == 0, "epoch must be day 0");
+    static_assert(daysFromCivil(2000, 3, 1) == 11017, "leap-century handling");
+    static_assert(civilFromDays(19783).year == 2024 && civilFromDays(19783).month == 3 &&
+                  civilFromDays(19783).day == 1, "round trip through a leap February");
+    static_assert(weekday(0) == 4, "1970-01-01 was a Thursday");
+}
+
+#endif // CALENDAR_H
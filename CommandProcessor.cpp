@@ -0,0 +1,169 @@
+#include "CommandProcessor.h"
+#include "Exceptions.h"
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+namespace {
+    string money(double amount) {
+        ostringstream out;
+        out << fixed << setprecision(2) << amount;
+        return out.str();
+    }
+
+    int number(const string& word) {
+        size_t used = 0;
+        int value = stoi(word, &used);
+        if (used != word.size()) throw ValidationException("'" + word + "' is not a number");
+        return value;
+    }
+
+    const int MAX_LISTED = 100;     // AVAIL never lists more rooms than this
+
+    time_t date(const string& word) {
+        if (!Utils::isValidDate(word)) throw InvalidDateException(word, "YYYY-MM-DD");
+        return Utils::parseDate(word);
+    }
+}
+
+// ==================== CONSTRUCTOR ====================
+CommandProcessor::CommandProcessor(Database& database)
+    : database(database), requestCount(0), errorCount(0) {}
+
+// ==================== COMMANDS ====================
+string CommandProcessor::handle(const string& request) {
+    istringstream in(request);
+    vector<string> words;
+    string word;
+    while (in >> word) words.push_back(word);
+
+    requestCount++;
+    string reply;
+    try {
+        if (words.empty()) throw ValidationException("Empty request");
+        reply = execute(words);
+    } catch (const HotelException& e) {
+        reply = string("ERR ") + e.what();
+    } catch (const exception&) {
+        reply = "ERR Malformed request";
+    }
+    if (reply.compare(0, 3, "ERR") == 0) errorCount++;
+    return reply;
+}
+
+string CommandProcessor::execute(const vector<string>& words) {
+    string command = words[0];
+    transform(command.begin(), command.end(), command.begin(), ::toupper);
+    auto need = [&](size_t count) {
+        if (words.size() < count + 1) {
+            throw ValidationException(command + " takes " + to_string(count) + " arguments");
+        }
+    };
+
+    if (command == "PING") return "OK PONG";
+    if (command == "ROOM") {
+        need(1);
+        optional<Room> room = database.getRoom(number(words[1]));
+        if (!room) throw RoomNotFoundException(number(words[1]));
+        return "OK " + to_string(room->getRoomNumber()) + " " + to_string(room->getType()) + " " +
+               to_string(room->getStatus()) + " " + money(room->getPricePerNight()) + " " +
+               to_string(room->getCapacity());
+    }
+    if (command == "RES") {
+        need(1);
+        optional<Reservation> reservation = database.getReservation(number(words[1]));
+        if (!reservation) throw ValidationException("No reservation " + words[1]);
+        return "OK " + to_string(reservation->getReservationId()) + " " +
+               to_string(reservation->getCustomerId()) + " " + to_string(reservation->getRoomNumber()) + " " +
+               Utils::formatDate(reservation->getRawCheckIn()) + " " +
+               Utils::formatDate(reservation->getRawCheckOut()) + " " +
+               to_string(reservation->getStatus()) + " " + money(reservation->getTotalAmount());
+    }
+    if (command == "AVAIL") {
+        need(4);
+        int type = number(words[1]);
+        if (type < STANDARD || type > PRESIDENTIAL) throw ValidationException("Room type must be 1-4");
+        int limit = clamp(words.size() > 5 ? number(words[5]) : 5, 0, MAX_LISTED);
+        string reply = "OK";
+        for (const auto& room : database.findCheapestRooms(static_cast<RoomType>(type), date(words[2]),
+                                                           date(words[3]), number(words[4]), limit)) {
+            reply += " " + to_string(room.roomNumber) + ":" + money(room.total);
+        }
+        return reply;
+    }
+    if (command == "BOOK") {
+        need(5);
+        int id = database.makeReservation(number(words[1]), number(words[2]), date(words[3]),
+                                          date(words[4]), number(words[5]));
+        return "OK " + to_string(id);
+    }
+    if (command == "CANCEL" || command == "CHECKIN" || command == "CHECKOUT") {
+        need(1);
+        int id = number(words[1]);
+        bool done = command == "CANCEL" ? database.cancelReservation(id)
+                  : command == "CHECKIN" ? database.checkIn(id)
+                  : database.checkOut(id);
+        if (!done) throw ValidationException("Reservation " + words[1] + " cannot be changed that way");
+        return "OK";
+    }
+    if (command == "CHARGE") {
+        need(3);
+        int reservationId = number(words[1]);
+        double amount = stod(words[2]);
+        string description = words[3];
+        for (size_t i = 4; i < words.size(); i++) description += " " + words[i];
+
+        int billId = database.getOrCreateBill(reservationId);
+        if (!database.addBillItem(billId, description, amount)) {
+            throw ValidationException("Cannot charge bill " + to_string(billId));
+        }
+        return "OK " + to_string(billId);
+    }
+    if (command == "PAY") {
+        need(2);
+        optional<Bill> bill = database.getBillForReservation(number(words[1]));
+        if (!bill) throw ValidationException("No bill for reservation " + words[1]);
+        double total = bill->getBalanceDue();
+        database.processPayment(bill->getBillId(), words[2]);
+        return "OK " + money(total);
+    }
+    if (command == "ADDROOM") {
+        need(3);
+        int type = number(words[1]);
+        if (type < STANDARD || type > PRESIDENTIAL) throw ValidationException("Room type must be 1-4");
+        return "OK " + to_string(database.addRoom(static_cast<RoomType>(type), stod(words[2]), number(words[3])));
+    }
+    if (command == "STATUS") {
+        need(2);
+        int status = number(words[2]);
+        if (status < AVAILABLE || status > MAINTENANCE) throw ValidationException("Room status must be 1-4");
+        if (!database.updateRoomStatus(number(words[1]), static_cast<RoomStatus>(status))) {
+            throw RoomNotFoundException(number(words[1]));
+        }
+        return "OK";
+    }
+    if (command == "PRICE") {
+        need(2);
+        optional<Room> room = database.getRoom(number(words[1]));
+        if (!room) throw RoomNotFoundException(number(words[1]));
+        database.modifyRoom(room->getRoomNumber(), stod(words[2]), room->getFeatures());
+        return "OK";
+    }
+    if (command == "RELEASEBLOCKS") return "OK " + to_string(database.releaseExpiredBlocks());
+    if (command == "NOSHOWS") return "OK " + to_string(database.markNoShows());
+    if (command == "AUDIT") {
+        NightAuditReport audit = database.runNightAudit();
+        return "OK " + Utils::formatDate(Calendar::fromEpochDay(audit.businessDay)) + " " +
+               to_string(audit.chargesPosted) + " " + money(audit.roomCharges);
+    }
+    if (command == "EXPORT") return "OK " + to_string(database.exportAll(EXPORT_CSV).size());
+    throw ValidationException("Unknown command " + command);
+}
+
+long long CommandProcessor::getRequestCount() const {
+    return requestCount;
+}
+
+long long CommandProcessor::getErrorCount() const {
+    return errorCount;
+}
@@ -0,0 +1,46 @@
+#ifndef COMMAND_PROCESSOR_H
+#define COMMAND_PROCESSOR_H
+
+#include "Database.h"
+#include <string>
+#include <atomic>
+
+// Compact text commands over the Database API, shared by the booking service
+// and scripts. One line per request and one line per response, "OK ..." or
+// "ERR <reason>"; dates are YYYY-MM-DD and types and statuses are their enum
+// values.
+//
+//   PING                                        OK PONG
+//   ROOM <room>                                 OK <room> <type> <status> <price> <capacity>
+//   RES <reservation>                           OK <id> <customer> <room> <in> <out> <status> <total>
+//   AVAIL <type 1-4> <in> <out> <guests> [n]    OK <room>:<total> ... cheapest first, n (5, 100 max)
+//   BOOK <customer> <room> <in> <out> <guests>  OK <reservation>
+//   CANCEL | CHECKIN | CHECKOUT <reservation>   OK
+//   CHARGE <reservation> <amount> <description> OK <bill>, opening the bill if needed
+//   PAY <reservation> <method>                  OK <amount paid>
+//   ADDROOM <type 1-4> <price> <capacity>       OK <room>
+//   STATUS <room> <status 1-4>                  OK
+//   PRICE <room> <price>                        OK
+//   RELEASEBLOCKS                               OK <rooms put back on sale>
+//   NOSHOWS                                     OK <bookings marked no-show>
+//   AUDIT                                       OK <night audited> <charges posted> <room charges>
+//   EXPORT                                      OK <files written>, all reports as CSV
+class CommandProcessor {
+private:
+    Database& database;
+    atomic<long long> requestCount;
+    atomic<long long> errorCount;
+
+    string execute(const vector<string>& words);
+
+public:
+    explicit CommandProcessor(Database& database);
+
+    // One request line without its newline. Safe to call from any thread.
+    string handle(const string& request);
+
+    long long getRequestCount() const;
+    long long getErrorCount() const;      // Requests answered with ERR
+};
+
+#endif // COMMAND_PROCESSOR_H
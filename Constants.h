@@ -56,6 +56,7 @@ namespace HotelConstants {
     const double MONTHLY_DISCOUNT = 0.20;  // 20% off for 30+ days
     const double CORPORATE_DISCOUNT = 0.15; // 15% corporate discount
     const double LOYALTY_DISCOUNT = 0.05;  // 5% loyalty discount
+    const int LOYALTY_MIN_VISITS = 5;      // Visits before the loyalty discount applies
     
     // Payment Constants
     const std::string CURRENCY = "USD";
@@ -147,6 +148,7 @@ namespace HotelConstants {
     const int AUTO_BACKUP_HOURS = 24;
     const int AUTO_SAVE_MINUTES = 5;
     const int SESSION_TIMEOUT_MINUTES = 30;
+    const int NO_SHOW_CHECK_MINUTES = 60;
     const int MAX_LOGIN_ATTEMPTS = 3;
     
     // Report Constants
@@ -26,7 +26,7 @@ string Customer::getAddress() const { return address; }
 string Customer::getIdProof() const { return idProof; }
 
 string Customer::getRegistrationDate() const {
-    return Utils::formatDate(registrationDate);
+    return Utils::formatLocalDate(registrationDate);
 }
 
 int Customer::getTotalVisits() const { return totalVisits; }
@@ -101,29 +101,36 @@ void Customer::displayBrief() const {
 // ==================== FILE OPERATIONS ====================
 void Customer::saveToFile(ofstream& file) const {
     if (!file.is_open()) throw FileException("File is not open for writing");
-    
-    file << customerId << " "
-         << name << " "
-         << email << " "
-         << phone << " "
-         << address << " "
-         << idProof << " "
-         << registrationDate << " "
-         << totalVisits << " "
-         << totalSpent << "\n";
+    Serialization::writeText(file, *this);
 }
 
 void Customer::loadFromFile(ifstream& file) {
     if (!file.is_open()) throw FileException("File is not open for reading");
+    if (!Serialization::readText(file, *this)) {
+        throw FileReadException("customers", "unexpected end of file");
+    }
+}
+
+// id name... email phone address... idProof registrationDate visits spent.
+// The email is the word with '@'; the name is before it, the address
+// between the phone and the ID proof.
+void Customer::loadLegacyFromFile(ifstream& file) {
+    vector<string> words;
+    if (!Serialization::readLegacyWords(file, words)) throw FileReadException("customers", "unexpected end of file");
+    size_t at = 2;
+    while (at < words.size() && words[at].find('@') == string::npos) at++;
+    if (words.size() < 8 || at + 6 > words.size()) throw FileCorruptedException("customers", "short legacy record");
     
-    file >> customerId;
-    file.ignore();
-    getline(file, name, '|');
-    getline(file, email, '|');
-    getline(file, phone, '|');
-    getline(file, address, '|');
-    getline(file, idProof, '|');
-    file >> registrationDate >> totalVisits >> totalSpent;
+    size_t last = words.size();
+    customerId = Serialization::legacyValue<int>(words[0], "customers");
+    name = Serialization::joinWords(words, 1, at);
+    email = words[at];
+    phone = words[at + 1];
+    address = Serialization::joinWords(words, at + 2, last - 4);
+    idProof = words[last - 4];
+    registrationDate = Serialization::legacyValue<time_t>(words[last - 3], "customers");
+    totalVisits = Serialization::legacyValue<int>(words[last - 2], "customers");
+    totalSpent = Serialization::legacyValue<double>(words[last - 1], "customers");
 }
 
 // ==================== VALIDATION ====================
@@ -2,8 +2,11 @@
 #define CUSTOMER_H
 
 #include "Utils.h"
+#include "Serialization.h"
 
 class Customer {
+    template <class T> friend struct Schema;
+    
 private:
     int customerId;
     string name;
@@ -51,9 +54,24 @@ public:
     // File operations
     void saveToFile(ofstream& file) const;
     void loadFromFile(ifstream& file);
+    void loadLegacyFromFile(ifstream& file);   // Space-separated files from before the schema tables
     
     // Validation
     bool isValid() const;
 };
 
+template <>
+struct Schema<Customer> {
+    static constexpr auto fields = make_tuple(
+        field("customerId", &Customer::customerId),
+        field("name", &Customer::name),
+        field("email", &Customer::email),
+        field("phone", &Customer::phone),
+        field("address", &Customer::address),
+        field("idProof", &Customer::idProof),
+        field("registrationDate", &Customer::registrationDate, FieldKind::Timestamp),
+        field("totalVisits", &Customer::totalVisits),
+        field("totalSpent", &Customer::totalSpent));
+};
+
 #endif // CUSTOMER_H
\ No newline at end of file
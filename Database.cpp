@@ -1,21 +1,64 @@
 #include "Database.h"
+#include "ScanEngine.h"
+#include "Constants.h"
+#include "ThreadPool.h"
+#include "Logger.h"
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <ctime>
+#include <chrono>
 #include <vector>
+#include <unordered_set>
+#include <functional>
+#include <limits>
+
+namespace {
+    // Tables for TableLock, in lock order. Derived state lives with the table
+    // whose writes maintain it.
+    enum DatabaseTable : unsigned {
+        TABLE_RATES = 1u << 0,          // Rate periods and the rate calendar
+        TABLE_ROOMS = 1u << 1,          // Rooms, status counters, room types
+        TABLE_CUSTOMERS = 1u << 2,
+        TABLE_RESERVATIONS = 1u << 3,   // Reservations, arrival/departure counters, popularity
+        TABLE_BLOCKS = 1u << 4,
+        TABLE_WAITLIST = 1u << 5,
+        TABLE_BILLS = 1u << 6,          // Bills and the revenue ledger
+        TABLE_EMPLOYEES = 1u << 7,
+        TABLE_STATS = 1u << 8,          // KPI cube and the active-today count, fed by several tables
+        ALL_TABLES = (1u << 9) - 1
+    };
+    
+    // One '|'-separated record per line
+    template <class T>
+    void readRecord(T& record, ifstream& file) {
+        if (!Serialization::readText(file, record)) throw FileReadException("record", "unexpected end of file");
+    }
+    
+    string formatFactor(double factor) {
+        ostringstream out;
+        out << fixed << setprecision(2) << factor;
+        return out.str();
+    }
+}
 
-
-Database::Database() : nextRoomNumber(101), nextCustomerId(1001), 
+Database::Database() : statsDay(0), activeToday(0), bookingRetries(0), batchDepth(0),
+                      unsavedTables(0), legacyTables(0), unreadableTables(0), businessDay(0), actingEmployee(0),
+                      nextRoomNumber(101), nextCustomerId(1001), 
                       nextReservationId(10001), nextEmployeeId(201), 
-                      nextBillId(5001) {
+                      nextBillId(5001), nextBlockId(1), nextWaitlistId(1) {
+    rebuildStats();
     createDataDirectory();
+    Utils::createDirectory(HotelConstants::LOG_DIR);
+    auditTrail = AuditTrail::open(HotelConstants::LOG_DIR + HotelConstants::AUDIT_FILE);
     loadAllData();
-    if (rooms.empty() && customers.empty() && employees.empty()) {
+    if (rooms.empty() && customers.empty() && employees.empty() && unreadableTables == 0) {
         initializeSampleData();
     }
 }
 
 Database::~Database() {
+    batchDepth = 0;     // An unfinished batch is still written
     saveAllData();
 }
 
@@ -25,10 +68,13 @@ void Database::createDataDirectory() {
 
 // ==================== ROOM OPERATIONS ====================
 int Database::addRoom(RoomType type, double price, int capacity, const vector<string>& features) {
+    TableLock lock(tableLocks, 0, TABLE_ROOMS | TABLE_STATS);
     try {
         Room newRoom(nextRoomNumber++, type, price, capacity, features);
         rooms.push_back(newRoom);
+        trackRoom(newRoom, 1);
         saveRooms();
+        HLOG_INFO("room.add room={} type={} price={} capacity={}", newRoom.getRoomNumber(), type, price, capacity);
         return newRoom.getRoomNumber();
     } catch (const HotelException&) {
         throw;
@@ -36,6 +82,7 @@ int Database::addRoom(RoomType type, double price, int capacity, const vector<st
 }
 
 Room* Database::findRoom(int roomNumber) {
+    TableLock lock(tableLocks, TABLE_ROOMS);
     for (auto& room : rooms) {
         if (room.getRoomNumber() == roomNumber) {
             return &room;
@@ -44,8 +91,17 @@ Room* Database::findRoom(int roomNumber) {
     return nullptr;
 }
 
+optional<Room> Database::getRoom(int roomNumber) const {
+    TableLock lock(tableLocks, TABLE_ROOMS);
+    for (const auto& room : rooms) {
+        if (room.getRoomNumber() == roomNumber) return room;
+    }
+    return nullopt;
+}
+
 // Correct implementation should match header declaration
 std::vector<Room*> Database::findAvailableRooms(RoomType type, int capacity) {
+    TableLock lock(tableLocks, TABLE_ROOMS);
     std::vector<Room*> availableRooms;
     
     // Use traditional for loop instead of range-based
@@ -60,22 +116,33 @@ std::vector<Room*> Database::findAvailableRooms(RoomType type, int capacity) {
     return availableRooms;
 }
 bool Database::updateRoomStatus(int roomNumber, RoomStatus status) {
+    TableLock lock(tableLocks, 0, TABLE_ROOMS | TABLE_STATS);
     Room* room = findRoom(roomNumber);
     if (room) {
+        trackRoom(*room, -1);
         room->setStatus(status);
+        trackRoom(*room, 1);
         saveRooms();
+        HLOG_INFO("room.status room={} status={}", roomNumber, status);
         return true;
     }
     return false;
 }
 
 bool Database::modifyRoom(int roomNumber, double newPrice, const vector<string>& newFeatures) {
+    TableLock lock(tableLocks, 0, TABLE_ROOMS);
     Room* room = findRoom(roomNumber);
     if (room) {
         try {
+            double oldPrice = room->getPricePerNight();
             room->setPrice(newPrice);
             room->setFeatures(newFeatures);
             saveRooms();
+            HLOG_INFO("room.modify room={} price={}", roomNumber, newPrice);
+            if (newPrice != oldPrice) {
+                audit(AUDIT_PRICE_CHANGE, AUDIT_ROOM, roomNumber, "price=" + Utils::formatCurrency(oldPrice),
+                      "price=" + Utils::formatCurrency(newPrice));
+            }
             return true;
         } catch (const HotelException& e) {
             throw;
@@ -85,6 +152,7 @@ bool Database::modifyRoom(int roomNumber, double newPrice, const vector<string>&
 }
 
 void Database::displayAllRooms() const {
+    TableLock lock(tableLocks, TABLE_ROOMS);
     if (rooms.empty()) {
         cout << "\nNo rooms available.\n";
         return;
@@ -100,7 +168,13 @@ void Database::displayAllRooms() const {
 }
 
 void Database::displayAvailableRooms() const {
-    auto available = const_cast<Database*>(this)->findAvailableRooms(RoomType::STANDARD, 2);  
+    TableLock lock(tableLocks, TABLE_ROOMS);
+    vector<const Room*> available;
+    for (const auto& room : rooms) {
+        if (room.getType() == STANDARD && room.getCapacity() >= 2 && room.isAvailable()) {
+            available.push_back(&room);
+        }
+    }
     
     if (available.empty()) {
         cout << "\nNo available rooms at the moment.\n";
@@ -117,24 +191,24 @@ void Database::displayAvailableRooms() const {
 }
 
 int Database::getRoomCount() const {
+    TableLock lock(tableLocks, TABLE_ROOMS);
     return rooms.size();
 }
 
 int Database::getAvailableRoomCount() const {
-    int count = 0;
-    for (const auto& room : rooms) {
-        if (room.isAvailable()) count++;
-    }
-    return count;
+    TableLock lock(tableLocks, TABLE_ROOMS);
+    return roomsByStatus[AVAILABLE];
 }
 
 // ==================== CUSTOMER OPERATIONS ====================
 int Database::addCustomer(const string& name, const string& email, const string& phone,
                          const string& address, const string& idProof) {
+    TableLock lock(tableLocks, 0, TABLE_CUSTOMERS);
     try {
         Customer newCustomer(nextCustomerId++, name, email, phone, address, idProof);
         customers.push_back(newCustomer);
         saveCustomers();
+        HLOG_INFO("customer.add customer={}", newCustomer.getCustomerId());
         return newCustomer.getCustomerId();
     } catch (const HotelException& e) {
         throw;
@@ -142,6 +216,7 @@ int Database::addCustomer(const string& name, const string& email, const string&
 }
 
 Customer* Database::findCustomer(int customerId) {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
     for (auto& customer : customers) {
         if (customer.getCustomerId() == customerId) {
             return &customer;
@@ -150,7 +225,16 @@ Customer* Database::findCustomer(int customerId) {
     return nullptr;
 }
 
+optional<Customer> Database::getCustomer(int customerId) const {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
+    for (const auto& customer : customers) {
+        if (customer.getCustomerId() == customerId) return customer;
+    }
+    return nullopt;
+}
+
 Customer* Database::findCustomerByName(const string& name) {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
     string searchName = Utils::toLower(name);
     for (auto& customer : customers) {
         if (Utils::toLower(customer.getName()).find(searchName) != string::npos) {
@@ -160,7 +244,17 @@ Customer* Database::findCustomerByName(const string& name) {
     return nullptr;
 }
 
+optional<Customer> Database::getCustomerByName(const string& name) const {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
+    string searchName = Utils::toLower(name);
+    for (const auto& customer : customers) {
+        if (Utils::toLower(customer.getName()).find(searchName) != string::npos) return customer;
+    }
+    return nullopt;
+}
+
 vector<Customer*> Database::findCustomersByPhone(const string& phone) {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
     vector<Customer*> result;
     for (auto& customer : customers) {
         if (customer.getPhone().find(phone) != string::npos) {
@@ -170,7 +264,17 @@ vector<Customer*> Database::findCustomersByPhone(const string& phone) {
     return result;
 }
 
+vector<Customer> Database::getCustomersByPhone(const string& phone) const {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
+    vector<Customer> result;
+    for (const auto& customer : customers) {
+        if (customer.getPhone().find(phone) != string::npos) result.push_back(customer);
+    }
+    return result;
+}
+
 void Database::displayAllCustomers() const {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
     if (customers.empty()) {
         cout << "\nNo customers registered.\n";
         return;
@@ -187,11 +291,13 @@ void Database::displayAllCustomers() const {
 
 bool Database::updateCustomerInfo(int customerId, const string& phone,
                                  const string& email, const string& address) {
+    TableLock lock(tableLocks, 0, TABLE_CUSTOMERS);
     Customer* customer = findCustomer(customerId);
     if (customer) {
         try {
             customer->updateInfo(phone, email, address);
             saveCustomers();
+            HLOG_INFO("customer.update customer={}", customerId);
             return true;
         } catch (const HotelException& e) {
             throw;
@@ -201,22 +307,63 @@ bool Database::updateCustomerInfo(int customerId, const string& phone,
 }
 
 int Database::getCustomerCount() const {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
     return customers.size();
 }
 
 // ==================== RESERVATION OPERATIONS ====================
+// Bookings are optimistic: the checks and the quote run under shared locks,
+// and the commit takes the exclusive ones only to confirm that the room and
+// the blocks are as they were seen and that no stay has taken the nights. A booking that loses that race this many
+// times runs once more with the exclusive locks held throughout.
+static const int OPTIMISTIC_BOOKING_ATTEMPTS = 4;
+
 int Database::makeReservation(int customerId, int roomNumber, time_t checkIn,
-                             time_t checkOut, int guests, const string& requests) {
+                             time_t checkOut, int guests, const string& requests,
+                             bool corporate) {
+    for (int attempt = 0; attempt < OPTIMISTIC_BOOKING_ATTEMPTS; attempt++) {
+        unsigned long long seenRoom, seenBlocks;
+        double roomRate;
+        {
+            TableLock lock(tableLocks, TABLE_RATES | TABLE_ROOMS | TABLE_CUSTOMERS |
+                                       TABLE_RESERVATIONS | TABLE_BLOCKS | TABLE_STATS);
+            roomRate = priceBooking(customerId, roomNumber, checkIn, checkOut, guests, corporate);
+            seenRoom = roomVersion(roomNumber);
+            seenBlocks = tableLocks.version(TABLE_BLOCKS);
+        }
+        
+        TableLock lock(tableLocks, TABLE_BLOCKS, TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_STATS);
+        if (roomVersion(roomNumber) == seenRoom && tableLocks.version(TABLE_BLOCKS) == seenBlocks) {
+            // The version covers the room's status, not its nights
+            if (roomBooked(roomNumber, Utils::toEpochDay(checkIn), Utils::toEpochDay(checkOut))) {
+                throw RoomException("Room is not available", "booked for some of those nights");
+            }
+            return commitBooking(customerId, roomNumber, checkIn, checkOut, guests, roomRate, requests);
+        }
+        bookingRetries++;
+        HLOG_DEBUG("reservation.retry room={} attempt={}", roomNumber, attempt + 1);
+    }
+    
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_CUSTOMERS | TABLE_BLOCKS,
+                   TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_STATS);
+    double roomRate = priceBooking(customerId, roomNumber, checkIn, checkOut, guests, corporate);
+    return commitBooking(customerId, roomNumber, checkIn, checkOut, guests, roomRate, requests);
+}
+
+// Throws unless the room can be booked; returns the nightly rate
+double Database::priceBooking(int customerId, int roomNumber, time_t checkIn, time_t checkOut,
+                              int guests, bool corporate) const {
     try {
         // Check if customer exists
-        Customer* customer = findCustomer(customerId);
-        if (!customer) {
+        if (none_of(customers.begin(), customers.end(),
+                    [customerId](const Customer& c) { return c.getCustomerId() == customerId; })) {
             throw ValidationException("Customer not found");
         }
         
         // Check if room exists and is available
-        Room* room = findRoom(roomNumber);
-        if (!room) {
+        auto room = find_if(rooms.begin(), rooms.end(),
+                            [roomNumber](const Room& r) { return r.getRoomNumber() == roomNumber; });
+        if (room == rooms.end()) {
             throw ValidationException("Room not found");
         }
         if (!room->isAvailable()) {
@@ -225,34 +372,64 @@ int Database::makeReservation(int customerId, int roomNumber, time_t checkIn,
         if (!room->canAccommodate(guests)) {
             throw ValidationException("Room cannot accommodate " + to_string(guests) + " guests");
         }
-        
-        // Calculate room rate
-        double roomRate = room->getPricePerNight();
-        
-        // Create reservation
-        Reservation newReservation(nextReservationId++, customerId, roomNumber, 
-                                  checkIn, checkOut, guests, roomRate);
-        
-        if (!requests.empty()) {
-            newReservation.setSpecialRequests(requests);
+        unordered_set<int> held;
+        addHeldRooms(held, Utils::toEpochDay(checkIn), Utils::toEpochDay(checkOut));
+        if (held.count(roomNumber)) {
+            throw RoomException("Room is not available", "held for a group block");
+        }
+        if (roomBooked(roomNumber, Utils::toEpochDay(checkIn), Utils::toEpochDay(checkOut))) {
+            throw RoomException("Room is not available", "booked for some of those nights");
         }
         
-        // Update room status
-        room->setStatus(RESERVED);
-        
-        // Save changes
-        reservations.push_back(newReservation);
-        saveReservations();
-        saveRooms();
-        
-        return newReservation.getReservationId();
+        // Calculate room rate: the quote's average night, to the cent
+        RateQuote quote = quoteStay(roomNumber, checkIn, checkOut, customerId, corporate);
+        return round(quote.averageRate() * 100.0) / 100.0;
         
     } catch (const HotelException& e) {
         throw;
     }
 }
 
+int Database::commitBooking(int customerId, int roomNumber, time_t checkIn, time_t checkOut,
+                            int guests, double roomRate, const string& requests) {
+    Room* room = findRoom(roomNumber);
+    
+    // Create reservation
+    Reservation newReservation(nextReservationId++, customerId, roomNumber, 
+                              checkIn, checkOut, guests, roomRate);
+    
+    if (!requests.empty()) {
+        newReservation.setSpecialRequests(requests);
+    }
+    
+    // Update room status
+    trackRoom(*room, -1);
+    room->setStatus(RESERVED);
+    trackRoom(*room, 1);
+    
+    // Save changes
+    reservations.push_back(newReservation);
+    trackReservation(newReservation, 1);
+    saveReservations();
+    saveRooms();
+    
+    HLOG_INFO("reservation.book reservation={} customer={} room={} nights={} rate={}",
+              newReservation.getReservationId(), customerId, roomNumber,
+              newReservation.calculateNights(), roomRate);
+    return newReservation.getReservationId();
+}
+
+unsigned long long Database::roomVersion(int roomNumber) const {
+    auto version = roomVersions.find(roomNumber);
+    return version == roomVersions.end() ? 0 : version->second;
+}
+
+long long Database::getBookingRetries() const {
+    return bookingRetries;
+}
+
 Reservation* Database::findReservation(int reservationId) {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
     for (auto& reservation : reservations) {
         if (reservation.getReservationId() == reservationId) {
             return &reservation;
@@ -261,7 +438,16 @@ Reservation* Database::findReservation(int reservationId) {
     return nullptr;
 }
 
+optional<Reservation> Database::getReservation(int reservationId) const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
+    for (const auto& reservation : reservations) {
+        if (reservation.getReservationId() == reservationId) return reservation;
+    }
+    return nullopt;
+}
+
 vector<Reservation*> Database::findReservationsByCustomer(int customerId) {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
     vector<Reservation*> result;
     for (auto& reservation : reservations) {
         if (reservation.getCustomerId() == customerId) {
@@ -271,49 +457,78 @@ vector<Reservation*> Database::findReservationsByCustomer(int customerId) {
     return result;
 }
 
-vector<Reservation*> Database::findActiveReservations() const {
-    vector<Reservation*> result;
+vector<Reservation> Database::getReservationsByCustomer(int customerId) const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
+    vector<Reservation> result;
+    for (const auto& reservation : reservations) {
+        if (reservation.getCustomerId() == customerId) result.push_back(reservation);
+    }
+    return result;
+}
+
+vector<Reservation> Database::findActiveReservations() const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
+    vector<Reservation> result;
     for (const auto& reservation : reservations) {
         if (reservation.isActive()) {
-            result.push_back(const_cast<Reservation*>(&reservation));
+            result.push_back(reservation);
         }
     }
     return result;
 }
 
-vector<Reservation*> Database::findTodayCheckIns() const {
-    vector<Reservation*> result;
-    time_t today = Utils::parseDate(Utils::getCurrentDate());
+vector<Reservation> Database::findTodayCheckIns() const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
+    vector<Reservation> result;
+    int today = Utils::getTodayEpochDay();
     
     for (const auto& reservation : reservations) {
         if (reservation.getStatus() == CONFIRMED && 
-            Utils::daysBetween(today, reservation.getRawCheckIn()) == 0) {
-            result.push_back(const_cast<Reservation*>(&reservation));
+            Utils::toEpochDay(reservation.getRawCheckIn()) == today) {
+            result.push_back(reservation);
         }
     }
     return result;
 }
 
-vector<Reservation*> Database::findTodayCheckOuts() const {
-    vector<Reservation*> result;
-    time_t today = Utils::parseDate(Utils::getCurrentDate());
+vector<Reservation> Database::findTodayCheckOuts() const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
+    vector<Reservation> result;
+    int today = Utils::getTodayEpochDay();
     
     for (const auto& reservation : reservations) {
         if (reservation.getStatus() == CHECKED_IN && 
-            Utils::daysBetween(today, reservation.getRawCheckOut()) == 0) {
-            result.push_back(const_cast<Reservation*>(&reservation));
+            Utils::toEpochDay(reservation.getRawCheckOut()) == today) {
+            result.push_back(reservation);
         }
     }
     return result;
 }
 
 bool Database::cancelReservation(int reservationId) {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_CUSTOMERS | TABLE_BLOCKS,
+                   TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_WAITLIST | TABLE_STATS);
     Reservation* reservation = findReservation(reservationId);
-    if (reservation && reservation->cancel()) {
-        // Free the room
+    if (!reservation) return false;
+    
+    string before = "status=" + reservation->getStatusString() + " room=" + to_string(reservation->getRoomNumber()) +
+                    " stay=" + reservation->getCheckInDate() + ".." + reservation->getCheckOutDate();
+    trackReservation(*reservation, -1);
+    bool cancelled = reservation->cancel();
+    trackReservation(*reservation, 1);
+    
+    if (cancelled) {
+        HLOG_INFO("reservation.cancel reservation={} room={}", reservationId, reservation->getRoomNumber());
+        audit(AUDIT_CANCELLATION, AUDIT_RESERVATION, reservationId, before,
+              "status=" + reservation->getStatusString());
+        // Free the room unless another booking still holds it
         Room* room = findRoom(reservation->getRoomNumber());
         if (room) {
-            room->setStatus(AVAILABLE);
+            settleRoomStatus(*room);
+            if (fillFromWaitlist(*room, Utils::toEpochDay(reservation->getRawCheckIn()),
+                                 Utils::toEpochDay(reservation->getRawCheckOut())) != 0) {
+                return true;   // Saved with the new booking
+            }
             saveRooms();
         }
         saveReservations();
@@ -323,11 +538,21 @@ bool Database::cancelReservation(int reservationId) {
 }
 
 bool Database::checkIn(int reservationId) {
+    TableLock lock(tableLocks, 0, TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_STATS);
     Reservation* reservation = findReservation(reservationId);
-    if (reservation && reservation->checkIn()) {
+    if (!reservation) return false;
+    
+    trackReservation(*reservation, -1);
+    bool checkedIn = reservation->checkIn();
+    trackReservation(*reservation, 1);
+    
+    if (checkedIn) {
+        HLOG_INFO("reservation.checkin reservation={} room={}", reservationId, reservation->getRoomNumber());
         Room* room = findRoom(reservation->getRoomNumber());
         if (room) {
+            trackRoom(*room, -1);
             room->setStatus(OCCUPIED);
+            trackRoom(*room, 1);
             saveRooms();
         }
         saveReservations();
@@ -337,11 +562,26 @@ bool Database::checkIn(int reservationId) {
 }
 
 bool Database::checkOut(int reservationId) {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_CUSTOMERS | TABLE_BLOCKS,
+                   TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_WAITLIST | TABLE_STATS);
     Reservation* reservation = findReservation(reservationId);
-    if (reservation && reservation->checkOut()) {
+    if (!reservation) return false;
+    
+    trackReservation(*reservation, -1);
+    bool checkedOut = reservation->checkOut();
+    trackReservation(*reservation, 1);
+    
+    if (checkedOut) {
+        HLOG_INFO("reservation.checkout reservation={} room={}", reservationId, reservation->getRoomNumber());
         Room* room = findRoom(reservation->getRoomNumber());
         if (room) {
-            room->setStatus(AVAILABLE);
+            settleRoomStatus(*room);
+            // Leaving early frees the nights that were left
+            int today = Utils::getTodayEpochDay();
+            int checkOutDay = Utils::toEpochDay(reservation->getRawCheckOut());
+            if (today < checkOutDay && fillFromWaitlist(*room, today, checkOutDay) != 0) {
+                return true;
+            }
             saveRooms();
         }
         saveReservations();
@@ -350,23 +590,697 @@ bool Database::checkOut(int reservationId) {
     return false;
 }
 
+// A confirmed booking whose arrival day has passed without a check-in is a
+// no-show; its room goes back on sale if the booking was holding it.
+int Database::markNoShows() {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_CUSTOMERS | TABLE_BLOCKS,
+                   TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_WAITLIST | TABLE_STATS);
+    int today = Utils::getTodayEpochDay();
+    vector<pair<int, int>> freed;    // Room and check-out day of each no-show
+    for (auto& reservation : reservations) {
+        if (reservation.getStatus() != CONFIRMED ||
+            Utils::toEpochDay(reservation.getRawCheckIn()) >= today) continue;
+        
+        trackReservation(reservation, -1);
+        reservation.markNoShow();
+        trackReservation(reservation, 1);
+        freed.emplace_back(reservation.getRoomNumber(), Utils::toEpochDay(reservation.getRawCheckOut()));
+        HLOG_DEBUG("reservation.noshow reservation={} room={}", reservation.getReservationId(),
+                   reservation.getRoomNumber());
+    }
+    if (freed.empty()) return 0;
+    
+    // A room is free again only once no other booking still holds it
+    unordered_set<int> vacated;
+    for (const auto& noShow : freed) vacated.insert(noShow.first);
+    for (const auto& reservation : reservations) {
+        if (reservation.getStatus() == CONFIRMED || reservation.getStatus() == CHECKED_IN) {
+            vacated.erase(reservation.getRoomNumber());
+        }
+    }
+    for (int roomNumber : vacated) {
+        Room* room = findRoom(roomNumber);
+        if (room && room->getStatus() == RESERVED) {
+            trackRoom(*room, -1);
+            room->setStatus(AVAILABLE);
+            trackRoom(*room, 1);
+        }
+    }
+    
+    // The nights left of each stay go to the waitlist, as on a cancellation
+    for (const auto& noShow : freed) {
+        Room* room = findRoom(noShow.first);
+        if (room && today < noShow.second) fillFromWaitlist(*room, today, noShow.second);
+    }
+    
+    saveRooms();
+    saveReservations();
+    HLOG_INFO("reservation.noshows marked={}", freed.size());
+    return static_cast<int>(freed.size());
+}
+
+bool Database::changeReservationDates(int reservationId, time_t checkIn, time_t checkOut) {
+    TableLock lock(tableLocks, TABLE_ROOMS, TABLE_RESERVATIONS | TABLE_STATS);
+    Reservation* reservation = findReservation(reservationId);
+    if (!reservation) return false;
+    
+    trackReservation(*reservation, -1);
+    try {
+        if (reservation->getStatus() == CONFIRMED &&
+            roomBooked(reservation->getRoomNumber(), Utils::toEpochDay(checkIn), Utils::toEpochDay(checkOut))) {
+            throw RoomException("Room is not available", "booked for some of those nights");
+        }
+        reservation->setDates(checkIn, checkOut);
+    } catch (const HotelException&) {
+        trackReservation(*reservation, 1);
+        throw;
+    }
+    trackReservation(*reservation, 1);
+    saveReservations();
+    HLOG_INFO("reservation.dates reservation={} in={} out={}", reservationId,
+              Utils::formatDate(checkIn), Utils::formatDate(checkOut));
+    return true;
+}
+
+bool Database::modifyReservation(int reservationId, int guests, const string& specialRequests) {
+    TableLock lock(tableLocks, TABLE_ROOMS, TABLE_RESERVATIONS);
+    Reservation* reservation = findReservation(reservationId);
+    if (!reservation) return false;
+    
+    if (reservation->getStatus() != CONFIRMED) {
+        throw ValidationException("Only confirmed reservations can be modified");
+    }
+    Room* room = findRoom(reservation->getRoomNumber());
+    if (room && guests > room->getCapacity()) {
+        throw ValidationException("Room cannot accommodate " + to_string(guests) + " guests");
+    }
+    reservation->setGuests(guests);
+    reservation->setSpecialRequests(specialRequests);
+    saveReservations();
+    HLOG_INFO("reservation.modify reservation={} guests={}", reservationId, guests);
+    return true;
+}
+
+bool Database::setRoomPinned(int reservationId, bool pinned) {
+    TableLock lock(tableLocks, 0, TABLE_RESERVATIONS);
+    Reservation* reservation = findReservation(reservationId);
+    if (!reservation) return false;
+    
+    reservation->setRoomPinned(pinned);
+    saveReservations();
+    HLOG_INFO("reservation.pin reservation={} pinned={}", reservationId, pinned);
+    return true;
+}
+
+AssignmentPlan Database::planRoomAssignments(int days) const {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_BLOCKS);
+    if (days <= 0) throw ValidationException("Planning horizon must be positive");
+    int today = Utils::getTodayEpochDay();
+    
+    // Rooms held for a block are left out: nothing moves in or out of them
+    unordered_set<int> held;
+    addHeldRooms(held, numeric_limits<int>::min(), numeric_limits<int>::max());
+    if (held.empty()) return RoomAssigner::plan(rooms, reservations, today, today + days - 1);
+    vector<Room> open;
+    for (const auto& room : rooms) {
+        if (!held.count(room.getRoomNumber())) open.push_back(room);
+    }
+    return RoomAssigner::plan(open, reservations, today, today + days - 1);
+}
+
+// A move is skipped if the reservation changed since the plan was made
+int Database::applyRoomAssignments(const AssignmentPlan& plan) {
+    TableLock lock(tableLocks, 0, TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_STATS);
+    int applied = 0;
+    unordered_set<int> touched;
+    for (const auto& move : plan.moves) {
+        Reservation* reservation = findReservation(move.reservationId);
+        if (!reservation || reservation->getStatus() != CONFIRMED || reservation->isRoomPinned() ||
+            reservation->getRoomNumber() != move.fromRoom) continue;
+        Room* source = findRoom(move.fromRoom);
+        Room* target = findRoom(move.toRoom);
+        if (!source || !target || target->getType() != source->getType()) continue;
+        
+        trackReservation(*reservation, -1);
+        reservation->setRoomNumber(move.toRoom);
+        trackReservation(*reservation, 1);
+        touched.insert(move.fromRoom);
+        touched.insert(move.toRoom);
+        applied++;
+    }
+    
+    // Both ends of each move take their status from the stays they now have
+    for (int roomNumber : touched) {
+        Room* room = findRoom(roomNumber);
+        if (room) settleRoomStatus(*room);
+    }
+    
+    if (applied > 0) {
+        saveReservations();
+        saveRooms();
+        HLOG_INFO("reservation.assign moves={}", applied);
+    }
+    return applied;
+}
+
 int Database::getReservationCount() const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
     return reservations.size();
 }
 
 int Database::getActiveReservationCount() const {
-    return findActiveReservations().size();
+    TableLock lock(tableLocks, TABLE_RESERVATIONS | TABLE_STATS);
+    int day, active;
+    rollStatsDay(day, active);
+    return active;
+}
+
+// ==================== PRICING ====================
+vector<int> Database::soldByNight(RoomType type, time_t checkIn, time_t checkOut) const {
+    int first = Utils::toEpochDay(checkIn);
+    int end = Utils::toEpochDay(checkOut);
+    vector<int> sold(max(end - first, 0));
+    for (int night = first; night < end; night++) {
+        sold[night - first] = static_cast<int>(kpiCube.getRoomsSold(type, night));
+    }
+    return sold;
+}
+
+CustomerTier Database::customerTier(int customerId, bool corporate) const {
+    for (const auto& customer : customers) {
+        if (customer.getCustomerId() == customerId) {
+            return pricing.tierOf(customer, corporate);
+        }
+    }
+    return corporate ? TIER_CORPORATE : TIER_STANDARD;
+}
+
+RateQuote Database::quoteStay(int roomNumber, time_t checkIn, time_t checkOut,
+                              int customerId, bool corporate) const {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_ROOMS | TABLE_CUSTOMERS | TABLE_STATS);
+    if (checkIn >= checkOut) throw ValidationException("Check-out must be after check-in");
+    for (const auto& room : rooms) {
+        if (room.getRoomNumber() == roomNumber) {
+            int first = Utils::toEpochDay(checkIn);
+            int end = Utils::toEpochDay(checkOut);
+            return pricing.quote(room, soldByNight(room.getType(), checkIn, checkOut),
+                                 kpiCube.getInventory(room.getType()), customerTier(customerId, corporate),
+                                 rateCalendar.nightlyFactors(room, first, end));
+        }
+    }
+    throw ValidationException("Room not found");
+}
+
+vector<RateQuote> Database::quoteRoomType(RoomType type, time_t checkIn, time_t checkOut,
+                                          int customerId, bool corporate) const {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_ROOMS | TABLE_CUSTOMERS | TABLE_STATS);
+    if (checkIn >= checkOut) throw ValidationException("Check-out must be after check-in");
+    int first = Utils::toEpochDay(checkIn);
+    int end = Utils::toEpochDay(checkOut);
+    vector<int> sold = soldByNight(type, checkIn, checkOut);
+    int inventory = kpiCube.getInventory(type);
+    CustomerTier tier = customerTier(customerId, corporate);
+    
+    // Rooms on the type calendar share one pass over the nights
+    vector<const Room*> seasonal;
+    vector<RateQuote> quotes;
+    for (const auto& room : rooms) {
+        if (room.getType() != type) continue;
+        if (rateCalendar.hasRoomRates(room.getRoomNumber())) {
+            quotes.push_back(pricing.quote(room, sold, inventory, tier,
+                                           rateCalendar.nightlyFactors(room, first, end)));
+        } else {
+            seasonal.push_back(&room);
+        }
+    }
+    vector<RateQuote> shared = pricing.quoteRooms(seasonal, sold, inventory, tier,
+                                                  rateCalendar.nightlyFactors(type, first, end));
+    quotes.insert(quotes.end(), shared.begin(), shared.end());
+    return quotes;
+}
+
+const PricingEngine& Database::getPricingEngine() const {
+    return pricing;
+}
+
+void Database::setSeasonalRate(RoomType type, time_t from, time_t to, double factor) {
+    TableLock lock(tableLocks, 0, TABLE_RATES);
+    RatePeriod period;
+    period.type = type;
+    period.fromDate = from;
+    period.toDate = to;
+    period.value = factor;
+    string nights = Utils::formatDate(from) + ".." + Utils::formatDate(to);
+    string before = "factor=" + formatFactor(rateCalendar.getTypeFactor(type, Utils::toEpochDay(from))) +
+                    " from=" + Utils::formatDate(from);
+    rateCalendar.setTypeFactor(type, Utils::toEpochDay(from), Utils::toEpochDay(to), factor);
+    ratePeriods.push_back(period);
+    saveRates();
+    HLOG_INFO("rates.seasonal type={} from={} to={} factor={}", type, Utils::formatDate(from),
+              Utils::formatDate(to), factor);
+    audit(AUDIT_RATE_CHANGE, AUDIT_ROOM_TYPE, type, before, "factor=" + formatFactor(factor) + " nights=" + nights);
+}
+
+void Database::setRoomRate(int roomNumber, time_t from, time_t to, double price) {
+    TableLock lock(tableLocks, TABLE_ROOMS, TABLE_RATES);
+    Room* room = findRoom(roomNumber);
+    if (!room) throw ValidationException("Room not found");
+    
+    RatePeriod period;
+    period.roomNumber = roomNumber;
+    period.type = room->getType();
+    period.fromDate = from;
+    period.toDate = to;
+    period.value = price;
+    string before = "rate=" + Utils::formatCurrency(rateCalendar.getNightlyRate(*room, Utils::toEpochDay(from))) +
+                    " from=" + Utils::formatDate(from);
+    rateCalendar.setRoomRate(*room, Utils::toEpochDay(from), Utils::toEpochDay(to), price);
+    ratePeriods.push_back(period);
+    saveRates();
+    HLOG_INFO("rates.room room={} from={} to={} price={}", roomNumber, Utils::formatDate(from),
+              Utils::formatDate(to), price);
+    audit(AUDIT_RATE_CHANGE, AUDIT_ROOM, roomNumber, before,
+          "rate=" + Utils::formatCurrency(price) + " nights=" + Utils::formatDate(from) + ".." + Utils::formatDate(to));
+}
+
+void Database::clearRoomRates(int roomNumber) {
+    TableLock lock(tableLocks, 0, TABLE_RATES);
+    size_t periods = ratePeriods.size();
+    ratePeriods.erase(remove_if(ratePeriods.begin(), ratePeriods.end(),
+                                [roomNumber](const RatePeriod& period) { return period.roomNumber == roomNumber; }),
+                      ratePeriods.end());
+    rateCalendar.clearRoomRates(roomNumber);
+    saveRates();
+    HLOG_INFO("rates.clear room={}", roomNumber);
+    audit(AUDIT_RATE_CHANGE, AUDIT_ROOM, roomNumber, "periods=" + to_string(periods - ratePeriods.size()), "periods=0");
+}
+
+void Database::clearSeasonalRates(RoomType type) {
+    TableLock lock(tableLocks, TABLE_ROOMS, TABLE_RATES);
+    size_t periods = ratePeriods.size();
+    ratePeriods.erase(remove_if(ratePeriods.begin(), ratePeriods.end(),
+                                [type](const RatePeriod& period) {
+                                    return period.roomNumber == 0 && period.type == type;
+                                }),
+                      ratePeriods.end());
+    rebuildRates();
+    saveRates();
+    HLOG_INFO("rates.clear type={}", type);
+    audit(AUDIT_RATE_CHANGE, AUDIT_ROOM_TYPE, type, "periods=" + to_string(periods - ratePeriods.size()), "periods=0");
+}
+
+const RateCalendar& Database::getRateCalendar() const {
+    return rateCalendar;
+}
+
+// Horizon covers a month back and every bookable night ahead
+void Database::rebuildRates() {
+    int today = Utils::getTodayEpochDay();
+    const int HISTORY_DAYS = 30;
+    rateCalendar.reset(today - HISTORY_DAYS,
+                       HISTORY_DAYS + HotelConstants::MAX_ADVANCE_BOOKING + HotelConstants::MAX_STAY_DAYS + 1);
+    
+    for (const auto& period : ratePeriods) {
+        int from = Utils::toEpochDay(period.fromDate);
+        int to = Utils::toEpochDay(period.toDate);
+        if (period.roomNumber == 0) {
+            rateCalendar.setTypeFactor(period.type, from, to, period.value);
+            continue;
+        }
+        for (const auto& room : rooms) {
+            if (room.getRoomNumber() == period.roomNumber) {
+                rateCalendar.setRoomRate(room, from, to, period.value);
+                break;
+            }
+        }
+    }
+}
+
+vector<RoomStayCost> Database::findCheapestRooms(time_t checkIn, time_t checkOut, int guests, int count) const {
+    return rankFreeRooms(checkIn, checkOut, guests, count, nullopt);
+}
+
+vector<RoomStayCost> Database::findCheapestRooms(RoomType type, time_t checkIn, time_t checkOut,
+                                                 int guests, int count) const {
+    return rankFreeRooms(checkIn, checkOut, guests, count, type);
+}
+
+vector<RoomStayCost> Database::rankFreeRooms(time_t checkIn, time_t checkOut, int guests, int count,
+                                             optional<RoomType> type) const {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_BLOCKS);
+    if (checkIn >= checkOut) throw ValidationException("Check-out must be after check-in");
+    int first = Utils::toEpochDay(checkIn);
+    int end = Utils::toEpochDay(checkOut);
+    
+    unordered_set<int> booked;
+    for (const auto& reservation : reservations) {
+        if (reservation.isVoid() || reservation.getStatus() == CHECKED_OUT) continue;
+        if (Utils::toEpochDay(reservation.getRawCheckIn()) < end &&
+            first < Utils::toEpochDay(reservation.getRawCheckOut())) {
+            booked.insert(reservation.getRoomNumber());
+        }
+    }
+    addHeldRooms(booked, first, end);
+    
+    vector<RoomStayCost> candidates;
+    for (const auto& room : rooms) {
+        if (room.getStatus() == MAINTENANCE || !room.canAccommodate(guests)) continue;
+        if ((type && room.getType() != *type) || booked.count(room.getRoomNumber())) continue;
+        candidates.push_back({room.getRoomNumber(), room.getType(), rateCalendar.stayCost(room, first, end)});
+    }
+    
+    size_t keep = min(candidates.size(), static_cast<size_t>(max(count, 0)));
+    partial_sort(candidates.begin(), candidates.begin() + keep, candidates.end(),
+                 [](const RoomStayCost& a, const RoomStayCost& b) {
+                     return a.total != b.total ? a.total < b.total : a.roomNumber < b.roomNumber;
+                 });
+    candidates.resize(keep);
+    return candidates;
+}
+
+// ==================== GROUP BOOKINGS ====================
+void Database::addHeldRooms(unordered_set<int>& taken, int firstDay, int endDay) const {
+    for (const auto& block : blocks) {
+        if (block.getStatus() != BLOCK_OPEN) continue;
+        if (Utils::toEpochDay(block.getRawCheckIn()) >= endDay ||
+            firstDay >= Utils::toEpochDay(block.getRawCheckOut())) continue;
+        for (const auto& room : block.getRooms()) {
+            if (room.reservationId == 0) taken.insert(room.roomNumber);
+        }
+    }
+}
+
+// One pass over bookings and blocks finds every room taken on any night of
+// the stay; each line of the request then gets the cheapest free rooms.
+// Throws before anything changes if a line cannot be filled.
+vector<int> Database::pickGroupRooms(const vector<GroupRoomRequest>& request, int firstDay, int endDay) const {
+    if (request.empty()) throw ValidationException("Group request has no rooms");
+    
+    unordered_set<int> taken;
+    for (const auto& reservation : reservations) {
+        if (reservation.isVoid() || reservation.getStatus() == CHECKED_OUT) continue;
+        if (Utils::toEpochDay(reservation.getRawCheckIn()) < endDay &&
+            firstDay < Utils::toEpochDay(reservation.getRawCheckOut())) {
+            taken.insert(reservation.getRoomNumber());
+        }
+    }
+    addHeldRooms(taken, firstDay, endDay);
+    
+    vector<int> picked;
+    for (const auto& wanted : request) {
+        if (wanted.rooms <= 0) throw ValidationException("Number of rooms must be positive");
+        if (wanted.guestsPerRoom <= 0) throw ValidationException("Number of guests must be positive");
+        
+        vector<RoomStayCost> free;
+        for (const auto& room : rooms) {
+            if (room.getType() != wanted.type || room.getStatus() == MAINTENANCE) continue;
+            if (!room.canAccommodate(wanted.guestsPerRoom) || taken.count(room.getRoomNumber())) continue;
+            free.push_back({room.getRoomNumber(), room.getType(), rateCalendar.stayCost(room, firstDay, endDay)});
+        }
+        if (static_cast<int>(free.size()) < wanted.rooms) {
+            throw RoomException("Group booking failed",
+                                to_string(wanted.rooms) + " " + Utils::roomTypeToString(wanted.type) +
+                                " rooms requested, " + to_string(free.size()) + " free");
+        }
+        
+        partial_sort(free.begin(), free.begin() + wanted.rooms, free.end(),
+                     [](const RoomStayCost& a, const RoomStayCost& b) {
+                         return a.total != b.total ? a.total < b.total : a.roomNumber < b.roomNumber;
+                     });
+        for (int i = 0; i < wanted.rooms; i++) {
+            picked.push_back(free[i].roomNumber);
+            taken.insert(free[i].roomNumber);
+        }
+    }
+    return picked;
+}
+
+// Appends reservations built against the current state: one pass of counter
+// and room updates, then one write of each file
+void Database::commitReservations(const vector<Reservation>& batch) {
+    reservations.reserve(reservations.size() + batch.size());
+    for (const auto& reservation : batch) {
+        // A room with a guest in it now keeps its status until check-out
+        Room* room = findRoom(reservation.getRoomNumber());
+        if (room && room->getStatus() == AVAILABLE) {
+            trackRoom(*room, -1);
+            room->setStatus(RESERVED);
+            trackRoom(*room, 1);
+        }
+        reservations.push_back(reservation);
+        trackReservation(reservation, 1);
+    }
+    nextReservationId += static_cast<int>(batch.size());
+    saveReservations();
+    saveRooms();
+}
+
+vector<int> Database::makeGroupReservation(int customerId, const vector<GroupRoomRequest>& request,
+                                           time_t checkIn, time_t checkOut, const string& requests,
+                                           bool corporate) {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_CUSTOMERS | TABLE_BLOCKS,
+                   TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_STATS);
+    try {
+        if (!findCustomer(customerId)) throw ValidationException("Customer not found");
+        if (checkIn >= checkOut) throw ValidationException("Check-out must be after check-in");
+        vector<int> picked = pickGroupRooms(request, Utils::toEpochDay(checkIn), Utils::toEpochDay(checkOut));
+        
+        // Every reservation is built before any state changes
+        vector<Reservation> batch;
+        batch.reserve(picked.size());
+        size_t next = 0;
+        for (const auto& wanted : request) {
+            for (int i = 0; i < wanted.rooms; i++, next++) {
+                RateQuote quote = quoteStay(picked[next], checkIn, checkOut, customerId, corporate);
+                batch.emplace_back(nextReservationId + static_cast<int>(batch.size()), customerId, picked[next],
+                                   checkIn, checkOut, wanted.guestsPerRoom,
+                                   round(quote.averageRate() * 100.0) / 100.0);
+                if (!requests.empty()) batch.back().setSpecialRequests(requests);
+            }
+        }
+        
+        commitReservations(batch);
+        vector<int> ids;
+        ids.reserve(batch.size());
+        for (const auto& reservation : batch) ids.push_back(reservation.getReservationId());
+        HLOG_INFO("reservation.group customer={} rooms={} first={}", customerId, ids.size(), ids.front());
+        return ids;
+    } catch (const HotelException&) {
+        throw;
+    }
+}
+
+int Database::createRoomBlock(int customerId, const string& groupName, const vector<GroupRoomRequest>& request,
+                              time_t checkIn, time_t checkOut, time_t releaseDate, bool corporate) {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_ROOMS | TABLE_CUSTOMERS | TABLE_RESERVATIONS | TABLE_STATS,
+                   TABLE_BLOCKS);
+    try {
+        if (!findCustomer(customerId)) throw ValidationException("Customer not found");
+        RoomBlock block(nextBlockId, customerId, groupName, checkIn, checkOut, releaseDate);
+        for (int roomNumber : pickGroupRooms(request, Utils::toEpochDay(checkIn), Utils::toEpochDay(checkOut))) {
+            RateQuote quote = quoteStay(roomNumber, checkIn, checkOut, customerId, corporate);
+            block.hold(roomNumber, round(quote.averageRate() * 100.0) / 100.0);
+        }
+        
+        blocks.push_back(block);
+        nextBlockId++;
+        saveBlocks();
+        HLOG_INFO("block.create block={} customer={} rooms={}", block.getBlockId(), customerId,
+                  block.getRooms().size());
+        return block.getBlockId();
+    } catch (const HotelException&) {
+        throw;
+    }
+}
+
+int Database::pickUpFromBlock(int blockId, int customerId, RoomType type, int guests, const string& requests) {
+    TableLock lock(tableLocks, TABLE_RATES | TABLE_CUSTOMERS,
+                   TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_BLOCKS | TABLE_STATS);
+    try {
+        releaseExpiredBlocks();
+        RoomBlock* block = findBlock(blockId);
+        if (!block) throw ValidationException("Block not found");
+        if (block->getStatus() != BLOCK_OPEN) throw ValidationException("Block is " + block->getStatusString());
+        if (!findCustomer(customerId)) throw ValidationException("Customer not found");
+        
+        const BlockRoom* held = nullptr;
+        for (const auto& room : block->getRooms()) {
+            if (room.reservationId != 0) continue;
+            Room* candidate = findRoom(room.roomNumber);
+            if (candidate && candidate->getType() == type && candidate->canAccommodate(guests)) {
+                held = &room;
+                break;
+            }
+        }
+        if (!held) {
+            throw RoomException("Block pick-up failed",
+                                "no held " + Utils::roomTypeToString(type) + " room for " + to_string(guests) + " guests");
+        }
+        
+        Reservation reservation(nextReservationId, customerId, held->roomNumber, block->getRawCheckIn(),
+                                block->getRawCheckOut(), guests, held->rate);
+        if (!requests.empty()) reservation.setSpecialRequests(requests);
+        block->pickUp(held->roomNumber, reservation.getReservationId());
+        commitReservations({reservation});
+        saveBlocks();
+        HLOG_INFO("block.pickup block={} reservation={} room={}", blockId, reservation.getReservationId(),
+                  reservation.getRoomNumber());
+        return reservation.getReservationId();
+    } catch (const HotelException&) {
+        throw;
+    }
+}
+
+int Database::releaseBlock(int blockId) {
+    TableLock lock(tableLocks, 0, TABLE_BLOCKS);
+    RoomBlock* block = findBlock(blockId);
+    if (!block) return 0;
+    int released = static_cast<int>(block->release().size());
+    saveBlocks();
+    HLOG_INFO("block.release block={} rooms={}", blockId, released);
+    return released;
+}
+
+int Database::releaseExpiredBlocks() {
+    TableLock lock(tableLocks, 0, TABLE_BLOCKS);
+    int today = Utils::getTodayEpochDay();
+    int released = 0;
+    bool changed = false;
+    for (auto& block : blocks) {
+        if (block.isExpired(today)) {
+            released += static_cast<int>(block.release().size());
+            changed = true;
+        }
+    }
+    if (changed) {
+        saveBlocks();
+        HLOG_INFO("block.expire rooms={}", released);
+    }
+    return released;
+}
+
+RoomBlock* Database::findBlock(int blockId) {
+    TableLock lock(tableLocks, TABLE_BLOCKS);
+    for (auto& block : blocks) {
+        if (block.getBlockId() == blockId) return &block;
+    }
+    return nullptr;
+}
+
+vector<RoomBlock> Database::getBlocks() const {
+    TableLock lock(tableLocks, TABLE_BLOCKS);
+    return blocks;
+}
+
+// ==================== WAITLIST ====================
+int Database::joinWaitlist(int customerId, RoomType type, int guests, time_t checkIn, time_t checkOut) {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS, TABLE_WAITLIST);
+    if (!findCustomer(customerId)) throw ValidationException("Customer not found");
+    if (type < STANDARD || type > PRESIDENTIAL) throw ValidationException("Invalid room type");
+    if (guests <= 0) throw ValidationException("Number of guests must be positive");
+    if (checkIn >= checkOut) throw ValidationException("Check-out must be after check-in");
+    if (Utils::toEpochDay(checkIn) < Utils::getTodayEpochDay()) {
+        throw ValidationException("Check-in date is in the past");
+    }
+    
+    WaitlistRequest request;
+    request.requestId = nextWaitlistId++;
+    request.customerId = customerId;
+    request.type = type;
+    request.guests = guests;
+    request.checkInDate = checkIn;
+    request.checkOutDate = checkOut;
+    request.requestedAt = time(nullptr);
+    waitlist.add(request);
+    saveWaitlist();
+    HLOG_INFO("waitlist.join request={} customer={} type={}", request.requestId, customerId, type);
+    return request.requestId;
+}
+
+bool Database::withdrawFromWaitlist(int requestId) {
+    TableLock lock(tableLocks, 0, TABLE_WAITLIST);
+    if (!waitlist.withdraw(requestId)) return false;
+    saveWaitlist();
+    HLOG_INFO("waitlist.withdraw request={}", requestId);
+    return true;
+}
+
+const Waitlist& Database::getWaitlist() const {
+    return waitlist;
+}
+
+vector<WaitlistRequest> Database::getWaitingRequests() const {
+    TableLock lock(tableLocks, TABLE_WAITLIST);
+    vector<WaitlistRequest> result;
+    for (const auto& request : waitlist.getRequests()) {
+        if (request.status == WAITLIST_WAITING) result.push_back(request);
+    }
+    return result;
+}
+
+// Books the best waiting request into the room's freed nights [firstDay, endDay).
+// Returns the new reservation's ID, or 0 if nobody waiting fits; files are
+// only written when a request is filled.
+int Database::fillFromWaitlist(const Room& room, int firstDay, int endDay) {
+    if (room.getStatus() == MAINTENANCE || waitlist.getWaitingCount() == 0) return 0;
+    
+    // The room is free from the end of the stay before to the start of the next
+    int today = Utils::getTodayEpochDay();
+    int freeFrom = today;
+    int freeTo = numeric_limits<int>::max();
+    auto stays = staysByRoom.find(room.getRoomNumber());
+    if (stays != staysByRoom.end()) {
+        for (const auto& stay : stays->second) {
+            if (stay.endDay <= firstDay) freeFrom = max(freeFrom, stay.endDay);
+            else if (stay.firstDay >= endDay) freeTo = min(freeTo, stay.firstDay);
+            else return 0;   // Someone already has one of the nights
+        }
+    }
+    for (const auto& block : blocks) {
+        if (!block.holds(room.getRoomNumber(), numeric_limits<int>::min(), numeric_limits<int>::max())) continue;
+        int first = Utils::toEpochDay(block.getRawCheckIn());
+        int end = Utils::toEpochDay(block.getRawCheckOut());
+        if (end <= firstDay) freeFrom = max(freeFrom, end);
+        else if (first >= endDay) freeTo = min(freeTo, first);
+        else return 0;
+    }
+    
+    int requestId = waitlist.match(room.getType(), room.getCapacity(), freeFrom, freeTo, firstDay, endDay);
+    if (requestId == 0) return 0;
+    
+    // Checked as any booking is, whatever the room's status says
+    const WaitlistRequest* request = waitlist.find(requestId);
+    if (roomBooked(room.getRoomNumber(), Utils::toEpochDay(request->checkInDate),
+                   Utils::toEpochDay(request->checkOutDate))) return 0;
+    try {
+        RateQuote quote = quoteStay(room.getRoomNumber(), request->checkInDate, request->checkOutDate,
+                                    request->customerId);
+        Reservation reservation(nextReservationId, request->customerId, room.getRoomNumber(),
+                                request->checkInDate, request->checkOutDate, request->guests,
+                                round(quote.averageRate() * 100.0) / 100.0);
+        waitlist.markFilled(requestId, reservation.getReservationId());
+        commitReservations({reservation});
+        saveWaitlist();
+        HLOG_INFO("waitlist.fill request={} reservation={} room={}", requestId, reservation.getReservationId(),
+                  room.getRoomNumber());
+        return reservation.getReservationId();
+    } catch (const ValidationException&) {
+        // Customer no longer on file: leave the request for staff to look at
+        return 0;
+    }
 }
 
 // ==================== EMPLOYEE OPERATIONS ====================
 int Database::addEmployee(const string& name, const string& position, Department dept,
                          Shift shift, double salary, const string& contact,
                          const string& address, const string& joinDate) {
+    TableLock lock(tableLocks, 0, TABLE_EMPLOYEES);
     try {
         Employee newEmployee(nextEmployeeId++, name, position, dept, shift, 
                            salary, contact, address, joinDate);
         employees.push_back(newEmployee);
         saveEmployees();
+        HLOG_INFO("employee.add employee={}", newEmployee.getEmployeeId());
         return newEmployee.getEmployeeId();
     } catch (const HotelException& e) {
         throw;
@@ -374,6 +1288,7 @@ int Database::addEmployee(const string& name, const string& position, Department
 }
 
 Employee* Database::findEmployee(int employeeId) {
+    TableLock lock(tableLocks, TABLE_EMPLOYEES);
     for (auto& employee : employees) {
         if (employee.getEmployeeId() == employeeId) {
             return &employee;
@@ -382,16 +1297,28 @@ Employee* Database::findEmployee(int employeeId) {
     return nullptr;
 }
 
-Employee* Database::authenticateEmployee(const string& email, const string& password) {
-    for (auto& employee : employees) {
+optional<Employee> Database::getEmployee(int employeeId) const {
+    TableLock lock(tableLocks, TABLE_EMPLOYEES);
+    for (const auto& employee : employees) {
+        if (employee.getEmployeeId() == employeeId) return employee;
+    }
+    return nullopt;
+}
+
+optional<Employee> Database::authenticateEmployee(const string& email, const string& password) const {
+    TableLock lock(tableLocks, TABLE_EMPLOYEES);
+    for (const auto& employee : employees) {
         if (employee.getEmail() == email && employee.authenticate(password)) {
-            return &employee;
+            HLOG_INFO("employee.login employee={}", employee.getEmployeeId());
+            return employee;
         }
     }
-    return nullptr;
+    HLOG_WARNING("employee.login failed email={}", email);
+    return nullopt;
 }
 
 vector<Employee*> Database::findEmployeesByDepartment(Department dept) {
+    TableLock lock(tableLocks, TABLE_EMPLOYEES);
     vector<Employee*> result;
     for (auto& employee : employees) {
         if (employee.getDepartment() == dept) {
@@ -402,6 +1329,7 @@ vector<Employee*> Database::findEmployeesByDepartment(Department dept) {
 }
 
 void Database::displayAllEmployees() const {
+    TableLock lock(tableLocks, TABLE_EMPLOYEES);
     if (employees.empty()) {
         cout << "\nNo employees registered.\n";
         return;
@@ -418,6 +1346,7 @@ void Database::displayAllEmployees() const {
 
 bool Database::updateEmployeeInfo(int employeeId, const string& position,
                                  Department dept, Shift shift, double salary) {
+    TableLock lock(tableLocks, 0, TABLE_EMPLOYEES);
     Employee* employee = findEmployee(employeeId);
     if (employee) {
         try {
@@ -426,6 +1355,7 @@ bool Database::updateEmployeeInfo(int employeeId, const string& position,
             employee->setShift(shift);
             employee->setSalary(salary);
             saveEmployees();
+            HLOG_INFO("employee.update employee={}", employeeId);
             return true;
         } catch (const HotelException& e) {
             throw;
@@ -434,12 +1364,32 @@ bool Database::updateEmployeeInfo(int employeeId, const string& position,
     return false;
 }
 
+bool Database::changeEmployeePassword(int employeeId, const string& oldPassword,
+                                      const string& newPassword, const string& confirmPassword) {
+    TableLock lock(tableLocks, 0, TABLE_EMPLOYEES);
+    Employee* employee = findEmployee(employeeId);
+    if (!employee) return false;
+    if (!employee->authenticate(oldPassword)) {
+        HLOG_WARNING("employee.password failed employee={}", employeeId);
+        throw AuthenticationException(employee->getEmail(), "Old password is incorrect");
+    }
+    
+    employee->setPassword(newPassword, confirmPassword);
+    saveEmployees();
+    HLOG_INFO("employee.password employee={}", employeeId);
+    // The passwords themselves are never written to the trail
+    audit(AUDIT_PASSWORD_CHANGE, AUDIT_EMPLOYEE, employeeId, "password=set", "password=changed");
+    return true;
+}
+
 int Database::getEmployeeCount() const {
+    TableLock lock(tableLocks, TABLE_EMPLOYEES);
     return employees.size();
 }
 
 // ==================== BILLING OPERATIONS ====================
 int Database::createBill(int reservationId, double taxRate, double discount) {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS, TABLE_BILLS);
     try {
         Reservation* reservation = findReservation(reservationId);
         if (!reservation) {
@@ -447,15 +1397,26 @@ int Database::createBill(int reservationId, double taxRate, double discount) {
         }
         
         Bill newBill(nextBillId++, reservationId, taxRate, discount);
-        bills.push_back(newBill);
+        int billId = newBill.getBillId();
+        bills.push_back(std::move(newBill));
         saveBills();
-        return newBill.getBillId();
+        HLOG_INFO("bill.create bill={} reservation={}", billId, reservationId);
+        return billId;
     } catch (const HotelException& e) {
         throw;
     }
 }
 
+// Lookup and creation share one write lock, so two charges racing on a
+// reservation without a bill still open only one
+int Database::getOrCreateBill(int reservationId) {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS, TABLE_BILLS);
+    Bill* bill = findBillByReservation(reservationId);
+    return bill ? bill->getBillId() : createBill(reservationId);
+}
+
 Bill* Database::findBill(int billId) {
+    TableLock lock(tableLocks, TABLE_BILLS);
     for (auto& bill : bills) {
         if (bill.getBillId() == billId) {
             return &bill;
@@ -464,7 +1425,16 @@ Bill* Database::findBill(int billId) {
     return nullptr;
 }
 
+optional<Bill> Database::getBill(int billId) const {
+    TableLock lock(tableLocks, TABLE_BILLS);
+    for (const auto& bill : bills) {
+        if (bill.getBillId() == billId) return bill;
+    }
+    return nullopt;
+}
+
 Bill* Database::findBillByReservation(int reservationId) {
+    TableLock lock(tableLocks, TABLE_BILLS);
     for (auto& bill : bills) {
         if (bill.getReservationId() == reservationId) {
             return &bill;
@@ -473,12 +1443,25 @@ Bill* Database::findBillByReservation(int reservationId) {
     return nullptr;
 }
 
+optional<Bill> Database::getBillForReservation(int reservationId) const {
+    TableLock lock(tableLocks, TABLE_BILLS);
+    for (const auto& bill : bills) {
+        if (bill.getReservationId() == reservationId) return bill;
+    }
+    return nullopt;
+}
+
 bool Database::addBillItem(int billId, const string& description, double amount, int quantity) {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_RESERVATIONS, TABLE_BILLS | TABLE_STATS);
     Bill* bill = findBill(billId);
     if (bill) {
         try {
+            // The ledger and the cube took the total at payment; a later item would be in neither
+            if (bill->getIsPaid()) throw ValidationException("Bill " + to_string(billId) + " is already paid");
             bill->addItem(description, amount, quantity);
+            kpiCube.postCharge(billTypeSlot(*bill), RevenueLedger::categorize(description), amount * quantity);
             saveBills();
+            HLOG_INFO("bill.charge bill={} amount={} quantity={} item={}", billId, amount, quantity, description);
             return true;
         } catch (const HotelException& e) {
             throw;
@@ -488,11 +1471,21 @@ bool Database::addBillItem(int billId, const string& description, double amount,
 }
 
 bool Database::processPayment(int billId, const string& paymentMethod) {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_RESERVATIONS, TABLE_BILLS | TABLE_STATS);
     Bill* bill = findBill(billId);
     if (bill) {
         try {
+            string before = "paid=" + string(bill->getIsPaid() ? "true" : "false") +
+                            " total=" + Utils::formatCurrency(bill->calculateTotal());
             bill->processPayment(paymentMethod);
+            revenueLedger.recordPayment(*bill);
+            int typeSlot = billTypeSlot(*bill);
+            kpiCube.postCharges(*bill, typeSlot, -1);
+            kpiCube.recordPayment(*bill, typeSlot);
             saveBills();
+            HLOG_INFO("bill.pay bill={} total={} method={}", billId, bill->calculateTotal(), paymentMethod);
+            audit(AUDIT_PAYMENT, AUDIT_BILL, billId, before,
+                  "paid=true total=" + Utils::formatCurrency(bill->calculateTotal()) + " method=" + paymentMethod);
             return true;
         } catch (const HotelException& e) {
             throw;
@@ -502,6 +1495,7 @@ bool Database::processPayment(int billId, const string& paymentMethod) {
 }
 
 void Database::displayAllBills() const {
+    TableLock lock(tableLocks, TABLE_BILLS);
     if (bills.empty()) {
         cout << "\nNo bills available.\n";
         return;
@@ -511,25 +1505,23 @@ void Database::displayAllBills() const {
     cout << "                 ALL BILLS (" << bills.size() << ")\n";
     cout << "══════════════════════════════════════════════\n";
     
-    double totalRevenue = 0;
     for (const auto& bill : bills) {
         cout << "Bill ID: " << bill.getBillId() 
              << " | Reservation: " << bill.getReservationId()
              << " | Amount: " << Utils::formatCurrency(bill.calculateTotal())
              << " | Status: " << (bill.getIsPaid() ? "PAID" : "PENDING") << "\n";
-        totalRevenue += bill.calculateTotal();
     }
     
+    double totalRevenue = ScanEngine::aggregate(bills, 0.0,
+        [](double& total, const Bill& bill) { total += bill.calculateTotal(); },
+        [](double& total, double partial) { total += partial; });
+    
     cout << "\nTotal Revenue: " << Utils::formatCurrency(totalRevenue) << "\n";
 }
 
 void Database::displayUnpaidBills() const {
-    vector<Bill*> unpaid;
-    for (const auto& bill : bills) {
-        if (!bill.getIsPaid()) {
-            unpaid.push_back(const_cast<Bill*>(&bill));
-        }
-    }
+    TableLock lock(tableLocks, TABLE_BILLS);
+    vector<const Bill*> unpaid = ScanEngine::filter(bills, [](const Bill& bill) { return !bill.getIsPaid(); });
     
     if (unpaid.empty()) {
         cout << "\nNo unpaid bills.\n";
@@ -540,55 +1532,248 @@ void Database::displayUnpaidBills() const {
     cout << "              UNPAID BILLS (" << unpaid.size() << ")\n";
     cout << "══════════════════════════════════════════════\n";
     
-    double totalDue = 0;
     for (const auto& bill : unpaid) {
         cout << "Bill ID: " << bill->getBillId() 
              << " | Reservation: " << bill->getReservationId()
              << " | Due: " << Utils::formatCurrency(bill->getBalanceDue()) << "\n";
-        totalDue += bill->getBalanceDue();
     }
     
+    double totalDue = ScanEngine::aggregate(unpaid, 0.0,
+        [](double& total, const Bill* bill) { total += bill->getBalanceDue(); },
+        [](double& total, double partial) { total += partial; });
+    
     cout << "\nTotal Amount Due: " << Utils::formatCurrency(totalDue) << "\n";
 }
 
 double Database::calculateTotalRevenue() const {
-    double total = 0;
-    for (const auto& bill : bills) {
-        if (bill.getIsPaid()) {
-            total += bill.calculateTotal();
-        }
-    }
-    return total;
+    TableLock lock(tableLocks, TABLE_BILLS);
+    return revenueLedger.getAllTime().total();
 }
 
 double Database::calculateTodayRevenue() const {
-    double total = 0;
-    string today = Utils::getCurrentDate();
+    TableLock lock(tableLocks, TABLE_BILLS);
+    return revenueLedger.getDay(Utils::getTodayEpochDay()).total();
+}
+
+RevenueTotals Database::getRevenueForPeriod(time_t start, time_t end) const {
+    TableLock lock(tableLocks, TABLE_BILLS);
+    return revenueLedger.getPeriod(Utils::toEpochDay(start), Utils::toEpochDay(end));
+}
+
+const RevenueLedger& Database::getRevenueLedger() const {
+    return revenueLedger;
+}
+
+const KpiCube& Database::getKpiCube() const {
+    return kpiCube;
+}
+
+int Database::getBillCount() const {
+    TableLock lock(tableLocks, TABLE_BILLS);
+    return bills.size();
+}
+
+// ==================== NIGHT AUDIT ====================
+namespace {
+    const size_t AUDIT_SHARD_SIZE = 1024;   // Reservations per shard
     
-    // This is simplified - in real app, track payment dates
-    for (const auto& bill : bills) {
-        if (bill.getIsPaid()) {
-            total += bill.calculateTotal();
+    struct AuditPosting {
+        size_t reservation;     // Index into reservations
+        int bill;               // Index into bills; -1 until one is opened
+    };
+    
+    struct AuditShard {
+        vector<AuditPosting> postings;
+        double openCharges[ROOM_TYPE_SLOTS] = {};   // Posted to unpaid bills, by room type slot
+        double roomCharges = 0.0;
+        double tax = 0.0;
+        int settled = 0;
+    };
+}
+
+NightAuditReport Database::runNightAudit() {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_RESERVATIONS, TABLE_BILLS | TABLE_STATS);
+    auto start = chrono::high_resolution_clock::now();
+    int day = businessDay;
+    if (day > Utils::getTodayEpochDay()) {
+        throw ValidationException("Night audit for " + Utils::formatDate(Calendar::fromEpochDay(day - 1)) +
+                                  " has already run");
+    }
+    
+    // The bill each reservation's charges go to, as findBillByReservation finds it
+    unordered_map<int, int> billByReservation;
+    billByReservation.reserve(bills.size());
+    for (size_t i = 0; i < bills.size(); i++) {
+        billByReservation.emplace(bills[i].getReservationId(), static_cast<int>(i));
+    }
+    
+    // Pool workers cannot take table locks the caller holds, so shards read
+    // the tables directly and only collect what to post
+    ThreadPool& pool = ThreadPool::shared();
+    vector<AuditShard> shards((reservations.size() + AUDIT_SHARD_SIZE - 1) / AUDIT_SHARD_SIZE);
+    pool.parallelFor(reservations.size(), AUDIT_SHARD_SIZE, [&](size_t begin, size_t end) {
+        AuditShard& shard = shards[begin / AUDIT_SHARD_SIZE];
+        for (size_t i = begin; i < end; i++) {
+            const Reservation& reservation = reservations[i];
+            if (reservation.getStatus() != CHECKED_IN) continue;
+            if (day < Utils::toEpochDay(reservation.getRawCheckIn()) ||
+                day >= Utils::toEpochDay(reservation.getRawCheckOut())) continue;
+            auto bill = billByReservation.find(reservation.getReservationId());
+            // A paid bill has settled the stay; another night on it would go unpaid
+            if (bill != billByReservation.end() && bills[bill->second].getIsPaid()) {
+                shard.settled++;
+                continue;
+            }
+            shard.postings.push_back({i, bill != billByReservation.end() ? bill->second : -1});
+        }
+    });
+    
+    // Bills are opened in reservation order, so their ids do not depend on
+    // how the shards were scheduled
+    NightAuditReport report;
+    report.businessDay = day;
+    for (auto& shard : shards) {
+        for (auto& posting : shard.postings) {
+            if (posting.bill >= 0) continue;
+            posting.bill = static_cast<int>(bills.size());
+            bills.emplace_back(nextBillId++, reservations[posting.reservation].getReservationId());
+            report.billsOpened++;
         }
     }
-    return total * 0.1; // Assume 10% of total is today's revenue for demo
+    
+    // Every posting has a bill to itself, so shards post side by side
+    pool.parallelFor(shards.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t s = begin; s < end; s++) {
+            AuditShard& shard = shards[s];
+            for (const auto& posting : shard.postings) {
+                const Reservation& reservation = reservations[posting.reservation];
+                Bill& bill = bills[posting.bill];
+                double rate = reservation.getRoomRate();
+                bill.addItem("Room Charge", rate);
+                shard.roomCharges += rate;
+                shard.tax += rate * bill.getTaxRate();
+                shard.openCharges[roomTypeOf(reservation.getRoomNumber())] += rate;
+            }
+        }
+    });
+    
+    double openCharges[ROOM_TYPE_SLOTS] = {};
+    for (const auto& shard : shards) {
+        report.chargesPosted += static_cast<int>(shard.postings.size());
+        report.staysSettled += shard.settled;
+        report.roomCharges += shard.roomCharges;
+        report.tax += shard.tax;
+        for (int slot = 0; slot < ROOM_TYPE_SLOTS; slot++) openCharges[slot] += shard.openCharges[slot];
+    }
+    for (int slot = 0; slot < ROOM_TYPE_SLOTS; slot++) {
+        if (openCharges[slot] != 0.0) kpiCube.postCharge(slot, REVENUE_ROOM, openCharges[slot]);
+    }
+    
+    businessDay = day + 1;
+    if (report.chargesPosted > 0) saveBills();
+    saveBusinessDay();
+    
+    report.kpis = kpiCube.getDay(day);
+    report.seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+    HLOG_INFO("audit.night day={} charges={} bills_opened={} room_charges={} ms={}",
+              Utils::formatDate(Calendar::fromEpochDay(day)), report.chargesPosted, report.billsOpened,
+              report.roomCharges, report.seconds * 1000);
+    return report;
 }
 
-int Database::getBillCount() const {
-    return bills.size();
+int Database::getBusinessDay() const {
+    TableLock lock(tableLocks, TABLE_BILLS);
+    return businessDay;
+}
+
+// ==================== AUDIT TRAIL ====================
+void Database::setActingEmployee(int employeeId) {
+    actingEmployee = employeeId;
+}
+
+int Database::getActingEmployee() const {
+    return actingEmployee;
+}
+
+AuditTrail& Database::getAuditTrail() {
+    return *auditTrail;
+}
+
+// Queued under the caller's table lock, so entries on one record follow
+// the order its changes were made in
+void Database::audit(AuditAction action, AuditEntity entity, int entityId,
+                     const string& before, const string& after) {
+    auditTrail->record(actingEmployee, action, entity, entityId, before, after);
 }
 
 // ==================== FILE OPERATIONS ====================
 bool Database::saveAllData() {
+    TableLock lock(tableLocks, 0, ALL_TABLES);
     try {
-        return saveRooms() && saveCustomers() && saveReservations() &&
-               saveEmployees() && saveBills();
+        // Every file is attempted, so an unreadable one does not hold back the rest
+        bool success = true;
+        success = saveRooms() && success;
+        success = saveCustomers() && success;
+        success = saveReservations() && success;
+        success = saveEmployees() && success;
+        success = saveBills() && success;
+        success = saveRates() && success;
+        success = saveBlocks() && success;
+        success = saveWaitlist() && success;
+        success = saveBusinessDay() && success;
+        return success;
     } catch (const FileException& e) {
         throw;
     }
 }
 
+void Database::beginBatch() {
+    batchDepth++;
+}
+
+// Waits for writers in flight, so everything the batch changed is on disk
+// when it returns
+int Database::commitBatch() {
+    TableLock lock(tableLocks, ALL_TABLES);
+    if (batchDepth == 0) throw SystemException("Database", "commitBatch without beginBatch");
+    if (--batchDepth > 0) return 0;
+    
+    unsigned pending = unsavedTables.exchange(0);
+    try {
+        int written = saveTables(pending);
+        HLOG_DEBUG("data.commit files={}", written);
+        return written;
+    } catch (const FileException& e) {
+        // Files not yet written stay marked for the next commit or save
+        unsavedTables |= pending;
+        throw;
+    }
+}
+
+// Each table's bit is cleared once its file is written, so on a throw
+// `tables` holds the ones still unsaved
+int Database::saveTables(unsigned& tables) {
+    int written = 0;
+    if (tables & TABLE_ROOMS) { written += saveRooms(); tables &= ~TABLE_ROOMS; }
+    if (tables & TABLE_CUSTOMERS) { written += saveCustomers(); tables &= ~TABLE_CUSTOMERS; }
+    if (tables & TABLE_RESERVATIONS) { written += saveReservations(); tables &= ~TABLE_RESERVATIONS; }
+    if (tables & TABLE_EMPLOYEES) { written += saveEmployees(); tables &= ~TABLE_EMPLOYEES; }
+    if (tables & TABLE_BILLS) { written += saveBills() + saveBusinessDay(); tables &= ~TABLE_BILLS; }
+    if (tables & TABLE_RATES) { written += saveRates(); tables &= ~TABLE_RATES; }
+    if (tables & TABLE_BLOCKS) { written += saveBlocks(); tables &= ~TABLE_BLOCKS; }
+    if (tables & TABLE_WAITLIST) { written += saveWaitlist(); tables &= ~TABLE_WAITLIST; }
+    return written;
+}
+
+// Inside a batch a save only notes which file is out of date
+bool Database::deferSave(unsigned table) {
+    if (batchDepth == 0) return false;
+    unsavedTables |= table;
+    return true;
+}
+
 bool Database::loadAllData() {
+    TableLock lock(tableLocks, 0, ALL_TABLES);
     try {
         bool success = true;
         success = loadRooms() && success;
@@ -596,6 +1781,10 @@ bool Database::loadAllData() {
         success = loadReservations() && success;
         success = loadEmployees() && success;
         success = loadBills() && success;
+        loadRates();   // Optional: older data directories have no rates file
+        loadBlocks();  // Likewise for blocks and the waitlist
+        loadWaitlist();
+        loadBusinessDay();
         
         // Update ID counters
         if (!rooms.empty()) {
@@ -613,7 +1802,20 @@ bool Database::loadAllData() {
         if (!bills.empty()) {
             nextBillId = bills.back().getBillId() + 1;
         }
+        if (!blocks.empty()) {
+            nextBlockId = blocks.back().getBlockId() + 1;
+        }
+        if (!waitlist.getRequests().empty()) {
+            nextWaitlistId = waitlist.getRequests().back().requestId + 1;
+        }
         
+        rebuildStats();
+        rebuildRates();
+        releaseExpiredBlocks();
+        if (waitlist.expire(Utils::getTodayEpochDay()) > 0) saveWaitlist();
+        if (legacyTables != 0) saveTables(legacyTables);
+        HLOG_INFO("data.load rooms={} customers={} reservations={} bills={} complete={}", rooms.size(),
+                  customers.size(), reservations.size(), bills.size(), success);
         return success;
     } catch (const FileException& e) {
         throw;
@@ -621,12 +1823,14 @@ bool Database::loadAllData() {
 }
 
 bool Database::backupData() const {
+    TableLock lock(tableLocks, ALL_TABLES);
     // Simplified backup - just copy files
     try {
         time_t now = time(nullptr);
-        tm* localTime = localtime(&now);
+        tm localTime;
+        localtime_s(&localTime, &now);    // Runs on the scheduler thread too
         char timestamp[20];
-        strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", localTime);
+        strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", &localTime);
         
         string backupDir = "backup_" + string(timestamp);
         Utils::createDirectory(backupDir);
@@ -640,7 +1844,11 @@ bool Database::backupData() const {
             {CUSTOMERS_FILE, backupDir + "/customers.dat"},
             {RESERVATIONS_FILE, backupDir + "/reservations.dat"},
             {EMPLOYEES_FILE, backupDir + "/employees.dat"},
-            {BILLS_FILE, backupDir + "/bills.dat"}
+            {BILLS_FILE, backupDir + "/bills.dat"},
+            {RATES_FILE, backupDir + "/rates.dat"},
+            {BLOCKS_FILE, backupDir + "/blocks.dat"},
+            {WAITLIST_FILE, backupDir + "/waitlist.dat"},
+            {BUSINESS_DAY_FILE, backupDir + "/business_day.dat"}
         };
         
         for (const auto& file : files) {
@@ -651,8 +1859,10 @@ bool Database::backupData() const {
             dst.close();
         }
         
+        HLOG_INFO("data.backup dir={}", backupDir);
         return true;
     } catch (...) {
+        HLOG_ERROR("data.backup failed");
         return false;
     }
 }
@@ -664,6 +1874,8 @@ bool Database::restoreData(const string& backupDir) {
 
 // ==================== PRIVATE FILE OPERATIONS ====================
 bool Database::saveRooms() {
+    if (unreadableTables & TABLE_ROOMS) return false;
+    if (deferSave(TABLE_ROOMS)) return true;
     try {
         ofstream file(ROOMS_FILE);
         if (!file.is_open()) throw FileException("Cannot open rooms file");
@@ -681,6 +1893,8 @@ bool Database::saveRooms() {
 }
 
 bool Database::saveCustomers() {
+    if (unreadableTables & TABLE_CUSTOMERS) return false;
+    if (deferSave(TABLE_CUSTOMERS)) return true;
     try {
         ofstream file(CUSTOMERS_FILE);
         if (!file.is_open()) throw FileException("Cannot open customers file");
@@ -698,6 +1912,8 @@ bool Database::saveCustomers() {
 }
 
 bool Database::saveReservations() {
+    if (unreadableTables & TABLE_RESERVATIONS) return false;
+    if (deferSave(TABLE_RESERVATIONS)) return true;
     try {
         ofstream file(RESERVATIONS_FILE);
         if (!file.is_open()) throw FileException("Cannot open reservations file");
@@ -715,6 +1931,8 @@ bool Database::saveReservations() {
 }
 
 bool Database::saveEmployees() {
+    if (unreadableTables & TABLE_EMPLOYEES) return false;
+    if (deferSave(TABLE_EMPLOYEES)) return true;
     try {
         ofstream file(EMPLOYEES_FILE);
         if (!file.is_open()) throw FileException("Cannot open employees file");
@@ -732,6 +1950,8 @@ bool Database::saveEmployees() {
 }
 
 bool Database::saveBills() {
+    if (unreadableTables & TABLE_BILLS) return false;
+    if (deferSave(TABLE_BILLS)) return true;
     try {
         ofstream file(BILLS_FILE);
         if (!file.is_open()) throw FileException("Cannot open bills file");
@@ -748,113 +1968,179 @@ bool Database::saveBills() {
     }
 }
 
-bool Database::loadRooms() {
+bool Database::saveBusinessDay() {
+    if (deferSave(TABLE_BILLS)) return true;
     try {
-        ifstream file(ROOMS_FILE);
-        if (!file.is_open()) return false;
+        ofstream file(BUSINESS_DAY_FILE);
+        if (!file.is_open()) throw FileException("Cannot open business day file");
         
-        int count;
-        file >> count;
-        file.ignore();
-        
-        rooms.clear();
-        for (int i = 0; i < count; i++) {
-            Room room;
-            room.loadFromFile(file);
-            rooms.push_back(room);
-        }
+        file << Utils::formatDate(Calendar::fromEpochDay(businessDay)) << "\n";
         
         file.close();
         return true;
-    } catch (...) {
-        return false;
+    } catch (const FileException& e) {
+        throw;
     }
 }
 
-bool Database::loadCustomers() {
+bool Database::saveRates() {
+    if (unreadableTables & TABLE_RATES) return false;
+    if (deferSave(TABLE_RATES)) return true;
     try {
-        ifstream file(CUSTOMERS_FILE);
-        if (!file.is_open()) return false;
+        ofstream file(RATES_FILE);
+        if (!file.is_open()) throw FileException("Cannot open rates file");
         
-        int count;
-        file >> count;
-        file.ignore();
-        
-        customers.clear();
-        for (int i = 0; i < count; i++) {
-            Customer customer;
-            customer.loadFromFile(file);
-            customers.push_back(customer);
+        file << ratePeriods.size() << "\n";
+        for (const auto& period : ratePeriods) {
+            Serialization::writeText(file, period);
         }
         
         file.close();
         return true;
-    } catch (...) {
-        return false;
+    } catch (const FileException& e) {
+        throw;
     }
 }
 
-bool Database::loadReservations() {
+bool Database::saveBlocks() {
+    if (unreadableTables & TABLE_BLOCKS) return false;
+    if (deferSave(TABLE_BLOCKS)) return true;
     try {
-        ifstream file(RESERVATIONS_FILE);
-        if (!file.is_open()) return false;
+        ofstream file(BLOCKS_FILE);
+        if (!file.is_open()) throw FileException("Cannot open blocks file");
         
-        int count;
-        file >> count;
-        file.ignore();
-        
-        reservations.clear();
-        for (int i = 0; i < count; i++) {
-            Reservation reservation;
-            reservation.loadFromFile(file);
-            reservations.push_back(reservation);
+        file << blocks.size() << "\n";
+        for (const auto& block : blocks) {
+            block.saveToFile(file);
         }
         
         file.close();
         return true;
-    } catch (...) {
-        return false;
+    } catch (const FileException& e) {
+        throw;
     }
 }
 
-bool Database::loadEmployees() {
+bool Database::saveWaitlist() {
+    if (unreadableTables & TABLE_WAITLIST) return false;
+    if (deferSave(TABLE_WAITLIST)) return true;
     try {
-        ifstream file(EMPLOYEES_FILE);
-        if (!file.is_open()) return false;
+        ofstream file(WAITLIST_FILE);
+        if (!file.is_open()) throw FileException("Cannot open waitlist file");
         
-        int count;
-        file >> count;
-        file.ignore();
-        
-        employees.clear();
-        for (int i = 0; i < count; i++) {
-            Employee employee;
-            employee.loadFromFile(file);
-            employees.push_back(employee);
+        const vector<WaitlistRequest>& requests = waitlist.getRequests();
+        file << requests.size() << "\n";
+        for (const auto& request : requests) {
+            Serialization::writeText(file, request);
         }
         
         file.close();
         return true;
-    } catch (...) {
-        return false;
+    } catch (const FileException& e) {
+        throw;
+    }
+}
+
+// Current format first, then the space-separated one written before the
+// schema tables; a legacy file is rewritten in the current format once
+// everything has loaded. The table only changes when the whole file reads.
+// A file that reads neither way is left on disk as it is, and its table is
+// never saved over it.
+template <class T, class Read, class ReadLegacy>
+bool Database::loadTable(const string& path, unsigned table, vector<T>& rows, Read read, ReadLegacy readLegacy) {
+    auto readAll = [&path](auto reader) {
+        ifstream file(path);
+        int count = 0;
+        if (!(file >> count) || count < 0) throw FileCorruptedException(path, "bad record count");
+        file.ignore(numeric_limits<streamsize>::max(), '\n');
+        vector<T> records;
+        records.reserve(count);
+        for (int i = 0; i < count; i++) {
+            T record;
+            reader(record, file);
+            records.push_back(std::move(record));
+        }
+        return records;
+    };
+    
+    if (!ifstream(path).is_open()) return false;
+    try {
+        rows = readAll(read);
+        return true;
+    } catch (const HotelException& e) {
+        if constexpr (is_same_v<ReadLegacy, nullptr_t>) {
+            unreadableTables |= table;
+            HLOG_ERROR("data.load failed file={} {}", path, e.what());
+            return false;
+        }
+    }
+    if constexpr (!is_same_v<ReadLegacy, nullptr_t>) {
+        try {
+            rows = readAll(readLegacy);
+            legacyTables |= table;
+            HLOG_INFO("data.migrate file={} records={}", path, rows.size());
+            return true;
+        } catch (const HotelException& e) {
+            unreadableTables |= table;
+            HLOG_ERROR("data.load failed file={} {}", path, e.what());
+        }
     }
+    return false;
+}
+
+bool Database::loadRooms() {
+    return loadTable(ROOMS_FILE, TABLE_ROOMS, rooms, mem_fn(&Room::loadFromFile), mem_fn(&Room::loadLegacyFromFile));
+}
+
+bool Database::loadCustomers() {
+    return loadTable(CUSTOMERS_FILE, TABLE_CUSTOMERS, customers, mem_fn(&Customer::loadFromFile),
+                     mem_fn(&Customer::loadLegacyFromFile));
+}
+
+bool Database::loadReservations() {
+    return loadTable(RESERVATIONS_FILE, TABLE_RESERVATIONS, reservations, mem_fn(&Reservation::loadFromFile),
+                     mem_fn(&Reservation::loadLegacyFromFile));
+}
+
+// Employees were already written '|'-separated in the current field order
+bool Database::loadEmployees() {
+    return loadTable(EMPLOYEES_FILE, TABLE_EMPLOYEES, employees, mem_fn(&Employee::loadFromFile));
 }
 
 bool Database::loadBills() {
+    if (!loadTable(BILLS_FILE, TABLE_BILLS, bills, mem_fn(&Bill::loadFromFile), mem_fn(&Bill::loadLegacyFromFile))) {
+        return false;
+    }
+    revenueLedger.clear();
+    for (const auto& bill : bills) {
+        revenueLedger.recordPayment(bill);
+    }
+    return true;
+}
+
+bool Database::loadBlocks() {
+    return loadTable(BLOCKS_FILE, TABLE_BLOCKS, blocks, mem_fn(&RoomBlock::loadFromFile));
+}
+
+bool Database::loadWaitlist() {
+    vector<WaitlistRequest> requests;
+    if (!loadTable(WAITLIST_FILE, TABLE_WAITLIST, requests, readRecord<WaitlistRequest>)) return false;
+    waitlist.assign(requests);
+    return true;
+}
+
+// Without a business day file nothing has been audited yet, so tonight is next
+bool Database::loadBusinessDay() {
+    businessDay = Utils::getTodayEpochDay();
     try {
-        ifstream file(BILLS_FILE);
+        ifstream file(BUSINESS_DAY_FILE);
         if (!file.is_open()) return false;
         
-        int count;
-        file >> count;
-        file.ignore();
-        
-        bills.clear();
-        for (int i = 0; i < count; i++) {
-            Bill bill;
-            bill.loadFromFile(file);
-            bills.push_back(bill);
-        }
+        string date;
+        int day = 0;
+        file >> date;
+        if (!Calendar::parse(date.data(), date.size(), day)) return false;
+        businessDay = day;
         
         file.close();
         return true;
@@ -863,58 +2149,330 @@ bool Database::loadBills() {
     }
 }
 
+bool Database::loadRates() {
+    return loadTable(RATES_FILE, TABLE_RATES, ratePeriods, readRecord<RatePeriod>);
+}
+
 // ==================== STATISTICS ====================
+void Database::trackRoom(const Room& room, int delta) {
+    kpiCube.trackRoom(room.getType(), delta);
+    if (delta > 0) {
+        roomTypes[room.getRoomNumber()] = room.getType();
+        roomVersions[room.getRoomNumber()]++;
+    }
+    
+    RoomStatus status = room.getStatus();
+    if (status < AVAILABLE || status > MAINTENANCE) return;
+    roomsByStatus[status] += delta;
+}
+
+void Database::trackReservation(const Reservation& reservation, int delta) {
+    popularity.track(reservation, delta);
+    kpiCube.trackStay(reservation, roomTypeOf(reservation.getRoomNumber()), delta);
+    
+    ReservationStatus status = reservation.getStatus();
+    if (status != CONFIRMED && status != CHECKED_IN) return;
+    
+    int checkInDay = Utils::toEpochDay(reservation.getRawCheckIn());
+    int checkOutDay = Utils::toEpochDay(reservation.getRawCheckOut());
+    
+    if (status == CONFIRMED) {
+        if ((arrivalsByDay[checkInDay] += delta) == 0) arrivalsByDay.erase(checkInDay);
+    } else {
+        if ((departuresByDay[checkOutDay] += delta) == 0) departuresByDay.erase(checkOutDay);
+    }
+    
+    vector<RoomStay>& stays = staysByRoom[reservation.getRoomNumber()];
+    if (delta > 0) {
+        stays.push_back({checkInDay, checkOutDay, status == CHECKED_IN});
+    } else {
+        auto stay = find_if(stays.begin(), stays.end(), [&](const RoomStay& entry) {
+            return entry.firstDay == checkInDay && entry.endDay == checkOutDay &&
+                   entry.checkedIn == (status == CHECKED_IN);
+        });
+        if (stay != stays.end()) {
+            *stay = stays.back();
+            stays.pop_back();
+        }
+    }
+    
+    if ((staysStartingByDay[checkInDay] += delta) == 0) staysStartingByDay.erase(checkInDay);
+    if ((staysStartingByDay[checkOutDay] -= delta) == 0) staysStartingByDay.erase(checkOutDay);
+    if (checkInDay <= statsDay && statsDay < checkOutDay) {
+        activeToday += delta;
+    }
+}
+
+void Database::rebuildStats() {
+    fill(begin(roomsByStatus), end(roomsByStatus), 0);
+    arrivalsByDay.clear();
+    departuresByDay.clear();
+    staysStartingByDay.clear();
+    staysByRoom.clear();
+    popularity.clear();
+    kpiCube.clear();
+    roomTypes.clear();
+    statsDay = Utils::getTodayEpochDay();
+    activeToday = 0;
+    
+    for (const auto& room : rooms) {
+        trackRoom(room, 1);
+    }
+    unordered_map<int, int> roomByReservation;
+    for (const auto& reservation : reservations) {
+        trackReservation(reservation, 1);
+        roomByReservation[reservation.getReservationId()] = reservation.getRoomNumber();
+    }
+    for (const auto& bill : bills) {
+        auto room = roomByReservation.find(bill.getReservationId());
+        int typeSlot = room != roomByReservation.end() ? roomTypeOf(room->second) : 0;
+        if (bill.getIsPaid()) {
+            kpiCube.recordPayment(bill, typeSlot);
+        } else {
+            kpiCube.postCharges(bill, typeSlot, 1);
+        }
+    }
+}
+
+bool Database::roomBooked(int roomNumber, int firstDay, int endDay) const {
+    auto stays = staysByRoom.find(roomNumber);
+    if (stays == staysByRoom.end()) return false;
+    return any_of(stays->second.begin(), stays->second.end(),
+                  [&](const RoomStay& stay) { return stay.firstDay < endDay && firstDay < stay.endDay; });
+}
+
+// A room's status follows its own bookings: occupied while a guest is checked
+// in, reserved while a confirmed stay holds it, available otherwise. Rooms
+// under maintenance keep their status.
+void Database::settleRoomStatus(Room& room) {
+    if (room.getStatus() == MAINTENANCE) return;
+    RoomStatus status = AVAILABLE;
+    auto stays = staysByRoom.find(room.getRoomNumber());
+    if (stays != staysByRoom.end()) {
+        for (const auto& stay : stays->second) {
+            if (stay.checkedIn) {
+                status = OCCUPIED;
+                break;
+            }
+            status = RESERVED;
+        }
+    }
+    if (status == room.getStatus()) return;
+    trackRoom(room, -1);
+    room.setStatus(status);
+    trackRoom(room, 1);
+}
+
+RoomType Database::roomTypeOf(int roomNumber) const {
+    auto it = roomTypes.find(roomNumber);
+    return it != roomTypes.end() ? it->second : static_cast<RoomType>(0);
+}
+
+// Cube slot of the room a bill's reservation is in; 0 when it is unknown
+int Database::billTypeSlot(const Bill& bill) {
+    Reservation* reservation = findReservation(bill.getReservationId());
+    return reservation ? roomTypeOf(reservation->getRoomNumber()) : 0;
+}
+
+// Readers share the lock on the stats table, so moving the day forward is
+// serialized among them here; writers hold the table exclusively
+void Database::rollStatsDay(int& day, int& active) const {
+    lock_guard<mutex> lock(statsDayMutex);
+    int today = Utils::getTodayEpochDay();
+    if (today > statsDay) {
+        // Apply the stays that start or end on the days we moved past
+        auto last = staysStartingByDay.upper_bound(today);
+        for (auto it = staysStartingByDay.upper_bound(statsDay); it != last; ++it) {
+            activeToday += it->second;
+        }
+    } else if (today < statsDay) {
+        // Clock went backwards; recount from the start
+        activeToday = 0;
+        auto last = staysStartingByDay.upper_bound(today);
+        for (auto it = staysStartingByDay.begin(); it != last; ++it) {
+            activeToday += it->second;
+        }
+    }
+    statsDay = today;
+    day = statsDay;
+    active = activeToday;
+}
+
+DashboardStats Database::getDashboardStats() const {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_RESERVATIONS | TABLE_BILLS | TABLE_STATS);
+    int today;
+    DashboardStats stats;
+    rollStatsDay(today, stats.activeReservations);
+    
+    stats.totalRooms = static_cast<int>(rooms.size());
+    stats.availableRooms = roomsByStatus[AVAILABLE];
+    stats.occupiedRooms = roomsByStatus[OCCUPIED];
+    stats.reservedRooms = roomsByStatus[RESERVED];
+    stats.maintenanceRooms = roomsByStatus[MAINTENANCE];
+    
+    auto arrivals = arrivalsByDay.find(today);
+    stats.todayCheckIns = arrivals != arrivalsByDay.end() ? arrivals->second : 0;
+    auto departures = departuresByDay.find(today);
+    stats.todayCheckOuts = departures != departuresByDay.end() ? departures->second : 0;
+    stats.todayRevenue = revenueLedger.getDay(today).total();
+    return stats;
+}
+
 void Database::showStatistics() const {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_CUSTOMERS | TABLE_RESERVATIONS | TABLE_BILLS |
+                               TABLE_EMPLOYEES | TABLE_STATS);
+    DashboardStats stats = getDashboardStats();
+    
     cout << "\n══════════════════════════════════════════════\n";
     cout << "              HOTEL STATISTICS\n";
     cout << "══════════════════════════════════════════════\n";
-    cout << "Total Rooms:           " << setw(10) << getRoomCount() << "\n";
-    cout << "Available Rooms:       " << setw(10) << getAvailableRoomCount() << "\n";
+    cout << "Total Rooms:           " << setw(10) << stats.totalRooms << "\n";
+    cout << "Available Rooms:       " << setw(10) << stats.availableRooms << "\n";
     cout << "Occupancy Rate:        " << setw(10) 
          << fixed << setprecision(1) 
-         << (getRoomCount() > 0 ? 
-             (1.0 - (double)getAvailableRoomCount() / getRoomCount()) * 100 : 0)
+         << (stats.totalRooms > 0 ? 
+             (1.0 - (double)stats.availableRooms / stats.totalRooms) * 100 : 0)
          << "%\n";
     cout << "Total Customers:       " << setw(10) << getCustomerCount() << "\n";
-    cout << "Active Reservations:   " << setw(10) << getActiveReservationCount() << "\n";
+    cout << "Active Reservations:   " << setw(10) << stats.activeReservations << "\n";
     cout << "Total Employees:       " << setw(10) << getEmployeeCount() << "\n";
     cout << "Total Revenue:         " << setw(10) << Utils::formatCurrency(calculateTotalRevenue()) << "\n";
-    cout << "Today's Revenue:       " << setw(10) << Utils::formatCurrency(calculateTodayRevenue()) << "\n";
+    cout << "Today's Revenue:       " << setw(10) << Utils::formatCurrency(stats.todayRevenue) << "\n";
     cout << "══════════════════════════════════════════════\n";
 }
 
 map<string, double> Database::getDailyRevenue(int days) const {
+    TableLock lock(tableLocks, TABLE_BILLS);
     map<string, double> revenue;
-    // Simplified implementation
-    for (int i = 0; i < days; i++) {
-        string date = Utils::formatDate(time(nullptr) - i * 24 * 60 * 60);
-        revenue[date] = calculateTodayRevenue() * 0.8; // Sample data
+    int today = Utils::getTodayEpochDay();
+    vector<RevenueTotals> series = revenueLedger.getSeries(today, days);
+    for (int i = 0; i < static_cast<int>(series.size()); i++) {
+        string date = Utils::formatDate(Calendar::fromEpochDay(today - days + 1 + i));
+        revenue[date] = series[i].total();
     }
     return revenue;
 }
 
+// Reports below run on a fresh snapshot, so writers wait only for the copy
 map<string, int> Database::getOccupancyRate() const {
-    map<string, int> occupancy;
-    // Simplified implementation
-    occupancy["Standard"] = 75;
-    occupancy["Deluxe"] = 85;
-    occupancy["Suite"] = 60;
-    occupancy["Presidential"] = 40;
-    return occupancy;
+    return snapshot()->getOccupancyRate();
+}
+
+OccupancyReport Database::getOccupancyReport(time_t start, time_t end) const {
+    return snapshot()->getOccupancyReport(start, end);
 }
 
 vector<pair<string, int>> Database::getPopularRooms() const {
-    vector<pair<string, int>> popular;
-    // Simplified implementation
-    popular.push_back({"Standard", 45});
-    popular.push_back({"Deluxe", 30});
-    popular.push_back({"Suite", 15});
-    popular.push_back({"Presidential", 10});
-    return popular;
+    return snapshot()->getPopularRooms();
+}
+
+vector<RoomPopularityEntry> Database::getTopRooms(int k, PopularityMetric metric) const {
+    return snapshot()->getTopRooms(k, metric);
+}
+
+vector<RoomPopularityEntry> Database::getTopRooms(int k, time_t start, time_t end,
+                                                  PopularityMetric metric) const {
+    return snapshot()->getTopRooms(k, start, end, metric);
+}
+
+CustomerReport Database::getCustomerReport(int topSpenders) const {
+    return snapshot()->getCustomerReport(topSpenders);
+}
+
+PaceForecast Database::getPaceForecast(int horizonDays) const {
+    return snapshot()->getPaceForecast(horizonDays);
+}
+
+// ==================== EXPORT OPERATIONS ====================
+ExportResult Database::exportRooms(ExportFormat format) const {
+    return snapshot()->exportRooms(format);
+}
+
+ExportResult Database::exportCustomers(ExportFormat format) const {
+    return snapshot()->exportCustomers(format);
+}
+
+ExportResult Database::exportReservations(ExportFormat format) const {
+    return snapshot()->exportReservations(format);
+}
+
+ExportResult Database::exportEmployees(ExportFormat format) const {
+    return snapshot()->exportEmployees(format);
+}
+
+ExportResult Database::exportBills(ExportFormat format) const {
+    return snapshot()->exportBills(format);
+}
+
+ExportResult Database::exportBillItems(ExportFormat format) const {
+    return snapshot()->exportBillItems(format);
+}
+
+ExportResult Database::exportDailyRevenue(ExportFormat format, int fromDay, int toDay) const {
+    return snapshot()->exportDailyRevenue(format, fromDay, toDay);
+}
+
+ExportResult Database::exportMonthlyOccupancy(ExportFormat format, int fromDay, int toDay) const {
+    return snapshot()->exportMonthlyOccupancy(format, fromDay, toDay);
+}
+
+ExportResult Database::exportRoomUtilization(ExportFormat format) const {
+    return snapshot()->exportRoomUtilization(format);
+}
+
+ExportResult Database::exportCustomerStatistics(ExportFormat format) const {
+    return snapshot()->exportCustomerStatistics(format);
+}
+
+// All ten files come from one snapshot
+vector<ExportResult> Database::exportAll(ExportFormat format) const {
+    return snapshot()->exportAll(format);
+}
+
+// ==================== SNAPSHOTS ====================
+// Holds the tables shared only while copying. A table whose version has not
+// moved since the last snapshot is handed over from it rather than copied.
+shared_ptr<const DatabaseSnapshot> Database::snapshot() const {
+    TableLock lock(tableLocks, TABLE_ROOMS | TABLE_CUSTOMERS | TABLE_RESERVATIONS |
+                               TABLE_BILLS | TABLE_EMPLOYEES | TABLE_STATS);
+    lock_guard<mutex> cache(snapshotMutex);
+    const DatabaseSnapshot* last = lastSnapshot.get();
+    SnapshotVersions versions = snapshotVersions;
+    auto current = [&](unsigned table, unsigned long long& copiedAt) {
+        unsigned long long version = tableLocks.version(table);
+        bool unchanged = last && copiedAt == version;
+        copiedAt = version;
+        return unchanged;
+    };
+    
+    auto next = make_shared<DatabaseSnapshot>();
+    next->today = Utils::getTodayEpochDay();
+    next->rooms = current(TABLE_ROOMS, versions.rooms)
+        ? last->rooms : make_shared<const vector<Room>>(rooms);
+    next->customers = current(TABLE_CUSTOMERS, versions.customers)
+        ? last->customers : make_shared<const vector<Customer>>(customers);
+    if (current(TABLE_RESERVATIONS, versions.reservations)) {
+        next->reservations = last->reservations;
+        next->popularity = last->popularity;
+    } else {
+        next->reservations = make_shared<const vector<Reservation>>(reservations);
+        next->popularity = make_shared<const RoomPopularity>(popularity);
+    }
+    next->employees = current(TABLE_EMPLOYEES, versions.employees)
+        ? last->employees : make_shared<const vector<Employee>>(employees);
+    next->bills = current(TABLE_BILLS, versions.bills)
+        ? last->bills : make_shared<const vector<Bill>>(bills);
+    next->kpiCube = current(TABLE_STATS, versions.stats)
+        ? last->kpiCube : make_shared<const KpiCube>(kpiCube);
+    
+    snapshotVersions = versions;
+    lastSnapshot = next;
+    return next;
 }
 
 // ==================== SEARCH OPERATIONS ====================
 vector<Room*> Database::searchRooms(double maxPrice, int minCapacity, RoomType type) {
+    TableLock lock(tableLocks, TABLE_ROOMS);
     vector<Room*> result;
     for (auto& room : rooms) {
         if (room.isAvailable() &&
@@ -928,6 +2486,7 @@ vector<Room*> Database::searchRooms(double maxPrice, int minCapacity, RoomType t
 }
 
 vector<Customer*> Database::searchCustomers(const string& keyword) {
+    TableLock lock(tableLocks, TABLE_CUSTOMERS);
     vector<Customer*> result;
     string searchKey = Utils::toLower(keyword);
     
@@ -942,16 +2501,14 @@ vector<Customer*> Database::searchCustomers(const string& keyword) {
 }
 
 vector<Reservation*> Database::searchReservationsByDateRange(time_t start, time_t end) {
-    vector<Reservation*> result;
-    for (auto& reservation : reservations) {
-        if (reservation.getRawCheckIn() >= start && reservation.getRawCheckOut() <= end) {
-            result.push_back(&reservation);
-        }
-    }
-    return result;
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
+    return ScanEngine::filter(reservations, [start, end](const Reservation& reservation) {
+        return reservation.getRawCheckIn() >= start && reservation.getRawCheckOut() <= end;
+    });
 }
 
 void Database::displayAllReservations() const {
+    TableLock lock(tableLocks, TABLE_RESERVATIONS);
     if (reservations.empty()) {
         cout << "\nNo reservations available.\n";
         return;
@@ -993,9 +2550,9 @@ void Database::initializeSampleData() {
                    2800.0, "+1-555-0203", "303 Birch St, New York", "2023-06-20");
         
         // Add sample reservations
-        time_t now = time(nullptr);
-        time_t checkIn1 = now + 2 * 24 * 60 * 60;  // 2 days from now
-        time_t checkOut1 = checkIn1 + 3 * 24 * 60 * 60;  // 3 nights
+        int today = Utils::getTodayEpochDay();
+        time_t checkIn1 = Calendar::fromEpochDay(today + 2);  // 2 days from now
+        time_t checkOut1 = Calendar::fromEpochDay(today + 5);  // 3 nights
         
         makeReservation(1001, 101, checkIn1, checkOut1, 2, "Early check-in requested");
         makeReservation(1002, 102, checkIn1, checkOut1, 3, "Extra bed needed");
@@ -6,11 +6,66 @@
 #include "Reservation.h"
 #include "Employee.h"
 #include "Bill.h"
+#include "RevenueLedger.h"
+#include "OccupancyAnalytics.h"
+#include "RoomPopularity.h"
+#include "KpiCube.h"
+#include "PaceForecast.h"
+#include "PricingEngine.h"
+#include "RateCalendar.h"
+#include "RoomAssigner.h"
+#include "RoomBlock.h"
+#include "Waitlist.h"
+#include "ReportWriter.h"
+#include "TableLock.h"
+#include "DatabaseSnapshot.h"
+#include "AuditTrail.h"
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <optional>
 
+// Snapshot of the counters shown on the dashboard and statistics screens
+struct DashboardStats {
+    int totalRooms = 0;
+    int availableRooms = 0;
+    int occupiedRooms = 0;
+    int reservedRooms = 0;
+    int maintenanceRooms = 0;
+    int activeReservations = 0;
+    int todayCheckIns = 0;
+    int todayCheckOuts = 0;
+    double todayRevenue = 0.0;
+};
+
+// Outcome of one night audit
+struct NightAuditReport {
+    int businessDay = 0;        // Night audited, epoch day
+    int chargesPosted = 0;      // One per in-house stay
+    int billsOpened = 0;
+    int staysSettled = 0;       // In-house stays whose bill is already paid; not charged
+    double roomCharges = 0.0;
+    double tax = 0.0;           // At each bill's tax rate
+    KpiSlice kpis;              // The audited day, after posting
+    double seconds = 0.0;
+};
+
+// Each table has a reader-writer lock: any number of threads may read while
+// nobody writes, and writers of different tables run side by side. Every
+// public method locks what it touches, so the methods are safe to call from
+// any thread. Pointers from the find* methods and the references to internal
+// structures stay valid only while nothing else writes; code sharing the
+// Database between threads reads through the value-returning methods
+// (getRoom, getReservation, findActiveReservations, ...) instead.
+//
+// Reports and exports run on a DatabaseSnapshot, holding the tables only
+// while it is copied, so check-ins and charges go on while a report runs.
+// Edits made through find* pointers reach snapshots at the next save.
 class Database {
 private:
     vector<Room> rooms;
@@ -19,12 +74,62 @@ private:
     vector<Employee> employees;
     vector<Bill> bills;
     
+    // Paid revenue by payment day, kept in step with bills
+    RevenueLedger revenueLedger;
+    
+    // Materialized dashboard counters. Every room or reservation transition
+    // goes through trackRoom/trackReservation, which remove the old state's
+    // contribution and add the new one. Day-dependent counts are keyed by
+    // epoch day, so passing midnight only moves the cached "today" forward.
+    int roomsByStatus[MAINTENANCE + 1];
+    unordered_map<int, int> arrivalsByDay;    // CONFIRMED, by check-in day
+    unordered_map<int, int> departuresByDay;  // CHECKED_IN, by check-out day
+    map<int, int> staysStartingByDay;         // +1 at check-in day, -1 at check-out day
+    mutable int statsDay;                     // Day activeToday describes
+    mutable int activeToday;
+    RoomPopularity popularity;                // Per-room booking history
+    KpiCube kpiCube;                          // Revenue and room-nights by day, type, category
+    unordered_map<int, RoomType> roomTypes;   // Room number -> type, for the cube
+    unordered_map<int, unsigned long long> roomVersions;   // Room number -> state changes, for optimistic booking
+    struct RoomStay {
+        int firstDay, endDay;                 // Nights [firstDay, endDay)
+        bool checkedIn;
+    };
+    unordered_map<int, vector<RoomStay>> staysByRoom;      // Room number -> its CONFIRMED and CHECKED_IN stays
+    atomic<long long> bookingRetries;         // Optimistic bookings that lost a race
+    atomic<int> batchDepth;                   // Open beginBatch calls
+    atomic<unsigned> unsavedTables;           // Files the open batch has yet to write
+    unsigned legacyTables;                    // Loaded from the old format; rewritten after loading
+    unsigned unreadableTables;                // Files that could not be read; never saved over
+    PricingEngine pricing;                    // Rate rules, compiled once
+    RateCalendar rateCalendar;                // Seasonal and per-room rates over the booking horizon
+    vector<RatePeriod> ratePeriods;           // Rate changes as entered, replayed into the calendar
+    vector<RoomBlock> blocks;                 // Group room blocks, open and closed
+    Waitlist waitlist;                        // Guests waiting for a room to free up
+    int businessDay;                          // Next night the audit posts; saved with the bills
+    shared_ptr<AuditTrail> auditTrail;        // Who changed payments, reservations, passwords and rates
+    atomic<int> actingEmployee;               // Recorded against audited changes; 0 for nobody
+    
+    mutable TableLocks tableLocks;            // Tables and lock order are listed in Database.cpp
+    mutable mutex statsDayMutex;              // Readers moving statsDay forward
+    
+    // Last snapshot handed out, and the table versions it was copied at
+    struct SnapshotVersions {
+        unsigned long long rooms = 0, customers = 0, reservations = 0;
+        unsigned long long employees = 0, bills = 0, stats = 0;
+    };
+    mutable mutex snapshotMutex;
+    mutable shared_ptr<const DatabaseSnapshot> lastSnapshot;
+    mutable SnapshotVersions snapshotVersions;
+    
     // ID counters
     int nextRoomNumber;
     int nextCustomerId;
     int nextReservationId;
     int nextEmployeeId;
     int nextBillId;
+    int nextBlockId;
+    int nextWaitlistId;
     
     // File names
     const string ROOMS_FILE = "data/rooms.dat";
@@ -32,11 +137,40 @@ private:
     const string RESERVATIONS_FILE = "data/reservations.dat";
     const string EMPLOYEES_FILE = "data/employees.dat";
     const string BILLS_FILE = "data/bills.dat";
+    const string RATES_FILE = "data/rates.dat";
+    const string BLOCKS_FILE = "data/blocks.dat";
+    const string WAITLIST_FILE = "data/waitlist.dat";
+    const string BUSINESS_DAY_FILE = "data/business_day.dat";
     
     // Helper methods
     void initializeSampleData();
     void createDataDirectory();
     
+    // Dashboard counter maintenance
+    void trackRoom(const Room& room, int delta);
+    void trackReservation(const Reservation& reservation, int delta);
+    void rebuildStats();
+    RoomType roomTypeOf(int roomNumber) const;
+    int billTypeSlot(const Bill& bill);
+    void rollStatsDay(int& day, int& active) const;
+    bool roomBooked(int roomNumber, int firstDay, int endDay) const;   // A stay holds one of the nights
+    void settleRoomStatus(Room& room);
+    vector<int> soldByNight(RoomType type, time_t checkIn, time_t checkOut) const;
+    CustomerTier customerTier(int customerId, bool corporate) const;
+    void rebuildRates();
+    void addHeldRooms(unordered_set<int>& taken, int firstDay, int endDay) const;
+    vector<int> pickGroupRooms(const vector<GroupRoomRequest>& request, int firstDay, int endDay) const;
+    vector<RoomStayCost> rankFreeRooms(time_t checkIn, time_t checkOut, int guests, int count,
+                                       optional<RoomType> type) const;
+    void commitReservations(const vector<Reservation>& batch);
+    int fillFromWaitlist(const Room& room, int firstDay, int endDay);
+    double priceBooking(int customerId, int roomNumber, time_t checkIn, time_t checkOut,
+                        int guests, bool corporate) const;
+    int commitBooking(int customerId, int roomNumber, time_t checkIn, time_t checkOut,
+                      int guests, double roomRate, const string& requests);
+    unsigned long long roomVersion(int roomNumber) const;
+    void audit(AuditAction action, AuditEntity entity, int entityId, const string& before, const string& after);
+    
 public:
     Database();
     ~Database();
@@ -44,6 +178,7 @@ public:
     // ==================== ROOM OPERATIONS ====================
     int addRoom(RoomType type, double price, int capacity, const vector<string>& features = {});
     Room* findRoom(int roomNumber);
+    optional<Room> getRoom(int roomNumber) const;
     std::vector<Room*> findAvailableRooms(RoomType type, int capacity);
     bool updateRoomStatus(int roomNumber, RoomStatus status);
     bool modifyRoom(int roomNumber, double newPrice, const vector<string>& newFeatures);
@@ -56,8 +191,11 @@ public:
     int addCustomer(const string& name, const string& email, const string& phone,
                    const string& address, const string& idProof);
     Customer* findCustomer(int customerId);
+    optional<Customer> getCustomer(int customerId) const;
     Customer* findCustomerByName(const string& name);
+    optional<Customer> getCustomerByName(const string& name) const;
     vector<Customer*> findCustomersByPhone(const string& phone);
+    vector<Customer> getCustomersByPhone(const string& phone) const;
     void displayAllCustomers() const;
     bool updateCustomerInfo(int customerId, const string& phone,
                            const string& email, const string& address);
@@ -65,54 +203,164 @@ public:
     
     // ==================== RESERVATION OPERATIONS ====================
     int makeReservation(int customerId, int roomNumber, time_t checkIn,
-                       time_t checkOut, int guests, const string& requests = "");
+                       time_t checkOut, int guests, const string& requests = "",
+                       bool corporate = false);
     Reservation* findReservation(int reservationId);
+    optional<Reservation> getReservation(int reservationId) const;
     vector<Reservation*> findReservationsByCustomer(int customerId);
-    vector<Reservation*> findActiveReservations() const;
-    vector<Reservation*> findTodayCheckIns() const;
-    vector<Reservation*> findTodayCheckOuts() const;
+    vector<Reservation> getReservationsByCustomer(int customerId) const;
+    vector<Reservation> findActiveReservations() const;
+    vector<Reservation> findTodayCheckIns() const;
+    vector<Reservation> findTodayCheckOuts() const;
     bool cancelReservation(int reservationId);
     bool checkIn(int reservationId);
     bool checkOut(int reservationId);
+    int markNoShows();                      // Confirmed arrivals before today; returns how many
+    bool changeReservationDates(int reservationId, time_t checkIn, time_t checkOut);
+    bool modifyReservation(int reservationId, int guests, const string& specialRequests);   // Confirmed only
+    bool setRoomPinned(int reservationId, bool pinned);
+    // Arrivals from today over the next days; nothing changes until applied
+    AssignmentPlan planRoomAssignments(int days) const;
+    int applyRoomAssignments(const AssignmentPlan& plan);   // Returns the moves made
     int getReservationCount() const;
     int getActiveReservationCount() const;
+    long long getBookingRetries() const;   // Bookings redone after another writer took the room first
+    
+    // ==================== PRICING ====================
+    // Occupancy is what is on the books for the room's type on each night
+    RateQuote quoteStay(int roomNumber, time_t checkIn, time_t checkOut,
+                        int customerId, bool corporate = false) const;
+    vector<RateQuote> quoteRoomType(RoomType type, time_t checkIn, time_t checkOut,
+                                    int customerId, bool corporate = false) const;
+    const PricingEngine& getPricingEngine() const;
+    
+    // Rate calendar: dates are nights, inclusive
+    void setSeasonalRate(RoomType type, time_t from, time_t to, double factor);
+    void setRoomRate(int roomNumber, time_t from, time_t to, double price);
+    void clearRoomRates(int roomNumber);
+    void clearSeasonalRates(RoomType type);
+    const RateCalendar& getRateCalendar() const;
+    // Rooms free for every night of the stay, cheapest calendar total first
+    vector<RoomStayCost> findCheapestRooms(time_t checkIn, time_t checkOut, int guests, int count) const;
+    vector<RoomStayCost> findCheapestRooms(RoomType type, time_t checkIn, time_t checkOut, int guests, int count) const;
+    
+    // ==================== GROUP BOOKINGS ====================
+    // All rooms are booked or none is; the files are written once
+    vector<int> makeGroupReservation(int customerId, const vector<GroupRoomRequest>& request,
+                                     time_t checkIn, time_t checkOut, const string& requests = "",
+                                     bool corporate = false);
+    // Holds rooms at today's rates until releaseDate without naming guests
+    int createRoomBlock(int customerId, const string& groupName, const vector<GroupRoomRequest>& request,
+                        time_t checkIn, time_t checkOut, time_t releaseDate, bool corporate = false);
+    int pickUpFromBlock(int blockId, int customerId, RoomType type, int guests,
+                        const string& requests = "");
+    int releaseBlock(int blockId);          // Returns the rooms put back on sale
+    int releaseExpiredBlocks();             // Blocks past their release date
+    RoomBlock* findBlock(int blockId);
+    vector<RoomBlock> getBlocks() const;
+    
+    // ==================== WAITLIST ====================
+    // Cancellations and early check-outs offer the freed nights to the best
+    // fitting waiting request, which is booked in the same save
+    int joinWaitlist(int customerId, RoomType type, int guests, time_t checkIn, time_t checkOut);
+    bool withdrawFromWaitlist(int requestId);
+    const Waitlist& getWaitlist() const;
+    vector<WaitlistRequest> getWaitingRequests() const;
     
     // ==================== EMPLOYEE OPERATIONS ====================
     int addEmployee(const string& name, const string& position, Department dept,
                    Shift shift, double salary, const string& contact,
                    const string& address, const string& joinDate);
     Employee* findEmployee(int employeeId);
-    Employee* authenticateEmployee(const string& email, const string& password);
+    optional<Employee> getEmployee(int employeeId) const;
+    optional<Employee> authenticateEmployee(const string& email, const string& password) const;
     vector<Employee*> findEmployeesByDepartment(Department dept);
     void displayAllEmployees() const;
     bool updateEmployeeInfo(int employeeId, const string& position,
                            Department dept, Shift shift, double salary);
+    // Throws AuthenticationException when the old password is wrong
+    bool changeEmployeePassword(int employeeId, const string& oldPassword,
+                                const string& newPassword, const string& confirmPassword);
     int getEmployeeCount() const;
     
     // ==================== BILLING OPERATIONS ====================
     int createBill(int reservationId, double taxRate = 0.10, double discount = 0.0);
+    int getOrCreateBill(int reservationId);     // The reservation's bill, opened if it has none
     Bill* findBill(int billId);
+    optional<Bill> getBill(int billId) const;
     Bill* findBillByReservation(int reservationId);
-    bool addBillItem(int billId, const string& description, double amount, int quantity = 1);
+    optional<Bill> getBillForReservation(int reservationId) const;
+    bool addBillItem(int billId, const string& description, double amount, int quantity = 1);   // Throws on paid bills
     bool processPayment(int billId, const string& paymentMethod);
     void displayAllBills() const;
     void displayUnpaidBills() const;
     void displayAllReservations() const;
     double calculateTotalRevenue() const;
     double calculateTodayRevenue() const;
+    RevenueTotals getRevenueForPeriod(time_t start, time_t end) const;
+    const RevenueLedger& getRevenueLedger() const;
+    const KpiCube& getKpiCube() const;
     int getBillCount() const;
     
+    // ==================== NIGHT AUDIT ====================
+    // Posts one night's room charge to the bill of every checked-in stay
+    // covering the business day, opening bills as needed, and moves the
+    // business day on. Shards of the reservations are scanned and posted on
+    // the shared thread pool, and the bills are written once. A day is
+    // audited once and not before it has begun.
+    NightAuditReport runNightAudit();
+    int getBusinessDay() const;
+    
+    // ==================== AUDIT TRAIL ====================
+    // Payments, cancellations, password changes and rate and price changes
+    // are recorded in LOG_DIR + AUDIT_FILE against the acting employee,
+    // whom the front end sets at login and clears at logout
+    void setActingEmployee(int employeeId);
+    int getActingEmployee() const;
+    AuditTrail& getAuditTrail();
+    
     // ==================== FILE OPERATIONS ====================
     bool saveAllData();
     bool loadAllData();
     bool backupData() const;
     bool restoreData(const string& backupDir);
+    // Between beginBatch and commitBatch changes stay in memory, and the
+    // commit writes each file the batch touched once. Batches nest; while
+    // one is open a save from any thread only marks its file, which reaches
+    // disk at the outermost commit. If that commit throws, the files it did
+    // not write stay marked.
+    void beginBatch();
+    int commitBatch();   // Files written; 0 when an outer batch is still open
     
     // ==================== STATISTICS ====================
+    // Consistent point-in-time view; the reports below each take a fresh one
+    shared_ptr<const DatabaseSnapshot> snapshot() const;
+    DashboardStats getDashboardStats() const;
     void showStatistics() const;
     map<string, double> getDailyRevenue(int days = 7) const;
     map<string, int> getOccupancyRate() const;
+    OccupancyReport getOccupancyReport(time_t start, time_t end) const;
     vector<pair<string, int>> getPopularRooms() const;
+    vector<RoomPopularityEntry> getTopRooms(int k, PopularityMetric metric = BY_ROOM_NIGHTS) const;
+    vector<RoomPopularityEntry> getTopRooms(int k, time_t start, time_t end,
+                                            PopularityMetric metric = BY_ROOM_NIGHTS) const;
+    CustomerReport getCustomerReport(int topSpenders) const;
+    PaceForecast getPaceForecast(int horizonDays) const;   // Built from the reservations on demand
+    
+    // ==================== EXPORT OPERATIONS ====================
+    // Each call streams one file into REPORT_DIR through a ReportWriter.
+    // exportAll writes every file from the same snapshot.
+    ExportResult exportRooms(ExportFormat format) const;
+    ExportResult exportCustomers(ExportFormat format) const;
+    ExportResult exportReservations(ExportFormat format) const;
+    ExportResult exportEmployees(ExportFormat format) const;
+    ExportResult exportBills(ExportFormat format) const;
+    ExportResult exportBillItems(ExportFormat format) const;
+    ExportResult exportDailyRevenue(ExportFormat format, int fromDay, int toDay) const;
+    ExportResult exportMonthlyOccupancy(ExportFormat format, int fromDay, int toDay) const;
+    ExportResult exportRoomUtilization(ExportFormat format) const;
+    ExportResult exportCustomerStatistics(ExportFormat format) const;
+    vector<ExportResult> exportAll(ExportFormat format) const;
     
     // ==================== SEARCH OPERATIONS ====================
     vector<Room*> searchRooms(double maxPrice, int minCapacity, RoomType type = STANDARD);
@@ -126,12 +374,24 @@ private:
     bool saveReservations();
     bool saveEmployees();
     bool saveBills();
+    bool saveRates();
+    bool saveBlocks();
+    bool saveWaitlist();
+    bool saveBusinessDay();
+    bool deferSave(unsigned table);
     
     bool loadRooms();
     bool loadCustomers();
     bool loadReservations();
     bool loadEmployees();
     bool loadBills();
+    bool loadRates();
+    bool loadBlocks();
+    bool loadWaitlist();
+    bool loadBusinessDay();
+    template <class T, class Read, class ReadLegacy = nullptr_t>
+    bool loadTable(const string& path, unsigned table, vector<T>& rows, Read read, ReadLegacy readLegacy = nullptr);
+    int saveTables(unsigned& tables);    // Clears each table as it is written; returns the files written
 };
 
 #endif // DATABASE_H
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include "DatabaseSnapshot.h"
+#include "ScanEngine.h"
+#include "RevenueLedger.h"
+#include <algorithm>
+#include <unordered_map>
+
+// ==================== REPORTS ====================
+// Occupancy percent per room type over the last 30 nights, tonight included
+map<string, int> DatabaseSnapshot::getOccupancyRate() const {
+    OccupancyReport report = OccupancyAnalytics::compute(*rooms, *reservations, today - 29, today);
+    
+    map<string, int> occupancy;
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        RoomType type = static_cast<RoomType>(t);
+        occupancy[Utils::roomTypeToString(type)] =
+            static_cast<int>(report.getType(type).occupancyRate() + 0.5);
+    }
+    return occupancy;
+}
+
+OccupancyReport DatabaseSnapshot::getOccupancyReport(time_t start, time_t end) const {
+    return OccupancyAnalytics::compute(*rooms, *reservations,
+                                       Utils::toEpochDay(start), Utils::toEpochDay(end));
+}
+
+// Room-nights booked per room type, most popular first
+vector<pair<string, int>> DatabaseSnapshot::getPopularRooms() const {
+    vector<RoomPopularityEntry> byType = popularity->usageByType(*rooms);
+    sort(byType.begin(), byType.end(), [](const RoomPopularityEntry& a, const RoomPopularityEntry& b) {
+        return a.usage.roomNights > b.usage.roomNights;
+    });
+    
+    vector<pair<string, int>> popular;
+    for (const auto& entry : byType) {
+        popular.push_back({Utils::roomTypeToString(entry.type), entry.usage.roomNights});
+    }
+    return popular;
+}
+
+vector<RoomPopularityEntry> DatabaseSnapshot::getTopRooms(int k, PopularityMetric metric) const {
+    return popularity->topRooms(*rooms, k, metric);
+}
+
+vector<RoomPopularityEntry> DatabaseSnapshot::getTopRooms(int k, time_t start, time_t end,
+                                                          PopularityMetric metric) const {
+    return RoomPopularity::topRoomsInWindow(*rooms, *reservations, Utils::toEpochDay(start),
+                                            Utils::toEpochDay(end), k, metric);
+}
+
+namespace {
+    // Per-partition state of the customer report scan. Slots follow the
+    // order of the customers table.
+    struct CustomerScan {
+        vector<CustomerActivity> activity;
+        vector<int> checkedInStays;
+        int activeReservations = 0;
+    };
+}
+
+CustomerReport DatabaseSnapshot::getCustomerReport(int topSpenders) const {
+    unordered_map<int, size_t> slotById;
+    slotById.reserve(customers->size());
+    for (size_t i = 0; i < customers->size(); i++) {
+        slotById[(*customers)[i].getCustomerId()] = i;
+    }
+    
+    CustomerScan identity;
+    identity.activity.resize(customers->size());
+    identity.checkedInStays.resize(customers->size());
+    
+    CustomerScan scan = ScanEngine::aggregate(*reservations, identity,
+        [&slotById](CustomerScan& partial, const Reservation& reservation) {
+            if (reservation.isVoid()) return;
+            if (reservation.isActive()) partial.activeReservations++;
+            
+            auto slot = slotById.find(reservation.getCustomerId());
+            if (slot == slotById.end()) return;
+            CustomerActivity& activity = partial.activity[slot->second];
+            activity.bookings++;
+            activity.roomNights += reservation.calculateNights();
+            activity.spend += reservation.getTotalAmount();
+            if (reservation.getStatus() == CHECKED_IN) partial.checkedInStays[slot->second]++;
+        },
+        [](CustomerScan& total, const CustomerScan& partial) {
+            for (size_t i = 0; i < total.activity.size(); i++) {
+                total.activity[i].bookings += partial.activity[i].bookings;
+                total.activity[i].roomNights += partial.activity[i].roomNights;
+                total.activity[i].spend += partial.activity[i].spend;
+                total.checkedInStays[i] += partial.checkedInStays[i];
+            }
+            total.activeReservations += partial.activeReservations;
+        });
+    
+    CustomerReport report;
+    report.totalCustomers = static_cast<int>(customers->size());
+    report.activeReservations = scan.activeReservations;
+    for (size_t i = 0; i < customers->size(); i++) {
+        scan.activity[i].customerId = (*customers)[i].getCustomerId();
+        if (scan.checkedInStays[i] > 0) report.checkedInGuests++;
+        if (scan.activity[i].bookings > 1) report.repeatCustomers++;
+    }
+    
+    size_t k = min(static_cast<size_t>(max(topSpenders, 0)), scan.activity.size());
+    partial_sort(scan.activity.begin(), scan.activity.begin() + k, scan.activity.end(),
+                 [](const CustomerActivity& a, const CustomerActivity& b) {
+                     return a.spend != b.spend ? a.spend > b.spend : a.customerId < b.customerId;
+                 });
+    report.topSpenders.assign(scan.activity.begin(), scan.activity.begin() + k);
+    while (!report.topSpenders.empty() && report.topSpenders.back().bookings == 0) {
+        report.topSpenders.pop_back();
+    }
+    return report;
+}
+
+PaceForecast DatabaseSnapshot::getPaceForecast(int horizonDays) const {
+    return PaceForecast(*rooms, *reservations, today, horizonDays);
+}
+
+// ==================== EXPORTS ====================
+ExportResult DatabaseSnapshot::exportRooms(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("rooms", format), format);
+    writer.table(*rooms);
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportCustomers(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("customers", format), format);
+    writer.table(*customers);
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportReservations(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("reservations", format), format);
+    writer.table(*reservations);
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportEmployees(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("employees", format), format);
+    writer.table(*employees);
+    return writer.close();
+}
+
+// Bills with their computed amounts, for accounting
+ExportResult DatabaseSnapshot::exportBills(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("bills", format), format);
+    writer.header({"billId", "reservationId", "subtotal", "tax", "discount", "total",
+                   "balanceDue", "isPaid", "paymentMethod", "paymentDate"});
+    for (const auto& bill : *bills) {
+        writer.cell(bill.getBillId());
+        writer.cell(bill.getReservationId());
+        writer.cell(bill.calculateSubtotal());
+        writer.cell(bill.calculateTax());
+        writer.cell(bill.calculateDiscountAmount());
+        writer.cell(bill.calculateTotal());
+        writer.cell(bill.getBalanceDue());
+        writer.cell(bill.getIsPaid() ? 1 : 0);
+        writer.cell(bill.getPaymentMethod());
+        writer.cell(bill.getIsPaid() ? Utils::formatLocalDate(bill.getRawPaymentDate()) : string());
+        writer.endRow();
+    }
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportBillItems(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("bill_items", format), format);
+    writer.header({"billId", "category", "description", "amount", "quantity", "total"});
+    for (const auto& bill : *bills) {
+        for (const auto& item : bill.getItems()) {
+            writer.cell(bill.getBillId());
+            writer.cell(RevenueLedger::categoryToString(RevenueLedger::categorize(item.getDescriptionView())));
+            writer.cell(item.getDescriptionView());
+            writer.cell(item.getAmount());
+            writer.cell(item.getQuantity());
+            writer.cell(item.getTotal());
+            writer.endRow();
+        }
+    }
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportDailyRevenue(ExportFormat format, int fromDay, int toDay) const {
+    ReportWriter writer(ReportWriter::reportPath("daily_revenue", format), format);
+    writer.header({"date", "room", "foodAndBeverage", "services", "total", "payments",
+                   "roomNightsSold", "adr", "revPar"});
+    char date[Calendar::DATE_LENGTH];
+    for (int day = fromDay; day <= toDay; day++) {
+        KpiSlice slice = kpiCube->getDay(day);
+        OccupancySummary rooms = slice.allRooms();
+        Calendar::format(day, date);
+        writer.cell(string_view(date, sizeof(date)));
+        writer.cell(slice.categoryRevenue(REVENUE_ROOM));
+        writer.cell(slice.categoryRevenue(REVENUE_FOOD));
+        writer.cell(slice.categoryRevenue(REVENUE_SERVICE));
+        writer.cell(slice.totalRevenue());
+        writer.cell(slice.payments);
+        writer.cell(rooms.roomNightsSold);
+        writer.cell(rooms.adr());
+        writer.cell(rooms.revPar());
+        writer.endRow();
+    }
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportMonthlyOccupancy(ExportFormat format, int fromDay, int toDay) const {
+    ReportWriter writer(ReportWriter::reportPath("monthly_occupancy", format), format);
+    writer.header({"month", "roomType", "roomNightsAvailable", "roomNightsSold", "occupancyPercent",
+                   "roomRevenue", "adr", "revPar"});
+    char date[Calendar::DATE_LENGTH];
+    for (const auto& bucket : kpiCube->rollUp(fromDay, toDay, KPI_MONTH)) {
+        Calendar::format(bucket.firstDay, date);
+        for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+            const OccupancySummary& rooms = bucket.slice.rooms[t];
+            writer.cell(string_view(date, 7));
+            writer.cell(Utils::roomTypeToString(static_cast<RoomType>(t)));
+            writer.cell(rooms.roomNightsAvailable);
+            writer.cell(rooms.roomNightsSold);
+            writer.cell(rooms.occupancyRate());
+            writer.cell(rooms.roomRevenue);
+            writer.cell(rooms.adr());
+            writer.cell(rooms.revPar());
+            writer.endRow();
+        }
+    }
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportRoomUtilization(ExportFormat format) const {
+    ReportWriter writer(ReportWriter::reportPath("room_utilization", format), format);
+    writer.header({"roomNumber", "roomType", "status", "pricePerNight", "bookings", "roomNights", "revenue"});
+    for (const auto& room : *rooms) {
+        RoomUsage usage = popularity->getUsage(room.getRoomNumber());
+        writer.cell(room.getRoomNumber());
+        writer.cell(Utils::roomTypeToString(room.getType()));
+        writer.cell(Utils::roomStatusToString(room.getStatus()));
+        writer.cell(room.getPricePerNight());
+        writer.cell(usage.bookings);
+        writer.cell(usage.roomNights);
+        writer.cell(usage.revenue);
+        writer.endRow();
+    }
+    return writer.close();
+}
+
+ExportResult DatabaseSnapshot::exportCustomerStatistics(ExportFormat format) const {
+    CustomerReport report = getCustomerReport(static_cast<int>(customers->size()));
+    
+    ReportWriter writer(ReportWriter::reportPath("customer_statistics", format), format);
+    writer.header({"customerId", "bookings", "roomNights", "spend"});
+    for (const auto& activity : report.topSpenders) {
+        writer.cell(activity.customerId);
+        writer.cell(activity.bookings);
+        writer.cell(activity.roomNights);
+        writer.cell(activity.spend);
+        writer.endRow();
+    }
+    return writer.close();
+}
+
+// Tables plus the last year of daily revenue and twelve months of occupancy
+vector<ExportResult> DatabaseSnapshot::exportAll(ExportFormat format) const {
+    int firstMonth = KpiCube::monthStart(KpiCube::monthIndex(today) - 11);
+    int lastDay = KpiCube::monthStart(KpiCube::monthIndex(today) + 1) - 1;
+    
+    return {
+        exportRooms(format),
+        exportCustomers(format),
+        exportReservations(format),
+        exportEmployees(format),
+        exportBills(format),
+        exportBillItems(format),
+        exportDailyRevenue(format, today - 364, today),
+        exportMonthlyOccupancy(format, firstMonth, lastDay),
+        exportRoomUtilization(format),
+        exportCustomerStatistics(format)
+    };
+}
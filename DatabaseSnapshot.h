@@ -0,0 +1,76 @@
+#ifndef DATABASE_SNAPSHOT_H
+#define DATABASE_SNAPSHOT_H
+
+#include "Room.h"
+#include "Customer.h"
+#include "Reservation.h"
+#include "Employee.h"
+#include "Bill.h"
+#include "OccupancyAnalytics.h"
+#include "RoomPopularity.h"
+#include "KpiCube.h"
+#include "PaceForecast.h"
+#include "ReportWriter.h"
+#include <vector>
+#include <map>
+#include <memory>
+
+// One customer's booking history, as shown on the customer report
+struct CustomerActivity {
+    int customerId = 0;
+    int bookings = 0;       // Non-cancelled reservations
+    int roomNights = 0;
+    double spend = 0.0;     // Room charges of those reservations
+};
+
+struct CustomerReport {
+    int totalCustomers = 0;
+    int activeReservations = 0;
+    int checkedInGuests = 0;    // Customers with a CHECKED_IN reservation
+    int repeatCustomers = 0;    // Customers with more than one booking
+    vector<CustomerActivity> topSpenders;
+};
+
+// The tables as they stood at one moment, for reports and exports. Nothing
+// here changes after Database::snapshot() returns, so a report can take as
+// long as it needs without holding a lock, and every figure it prints comes
+// from the same point in time.
+//
+// Snapshots share tables: a table nobody has written since the previous
+// snapshot is the same object in both, and only written tables are copied.
+// A copy is freed when the last snapshot using it goes away.
+struct DatabaseSnapshot {
+    int today = 0;      // Epoch day the snapshot was taken
+    shared_ptr<const vector<Room>> rooms;
+    shared_ptr<const vector<Customer>> customers;
+    shared_ptr<const vector<Reservation>> reservations;
+    shared_ptr<const vector<Employee>> employees;
+    shared_ptr<const vector<Bill>> bills;
+    shared_ptr<const RoomPopularity> popularity;
+    shared_ptr<const KpiCube> kpiCube;
+
+    // ==================== REPORTS ====================
+    map<string, int> getOccupancyRate() const;
+    OccupancyReport getOccupancyReport(time_t start, time_t end) const;
+    vector<pair<string, int>> getPopularRooms() const;
+    vector<RoomPopularityEntry> getTopRooms(int k, PopularityMetric metric = BY_ROOM_NIGHTS) const;
+    vector<RoomPopularityEntry> getTopRooms(int k, time_t start, time_t end,
+                                            PopularityMetric metric = BY_ROOM_NIGHTS) const;
+    CustomerReport getCustomerReport(int topSpenders) const;
+    PaceForecast getPaceForecast(int horizonDays) const;
+
+    // ==================== EXPORTS ====================
+    ExportResult exportRooms(ExportFormat format) const;
+    ExportResult exportCustomers(ExportFormat format) const;
+    ExportResult exportReservations(ExportFormat format) const;
+    ExportResult exportEmployees(ExportFormat format) const;
+    ExportResult exportBills(ExportFormat format) const;
+    ExportResult exportBillItems(ExportFormat format) const;
+    ExportResult exportDailyRevenue(ExportFormat format, int fromDay, int toDay) const;
+    ExportResult exportMonthlyOccupancy(ExportFormat format, int fromDay, int toDay) const;
+    ExportResult exportRoomUtilization(ExportFormat format) const;
+    ExportResult exportCustomerStatistics(ExportFormat format) const;
+    vector<ExportResult> exportAll(ExportFormat format) const;
+};
+
+#endif // DATABASE_SNAPSHOT_H
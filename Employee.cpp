@@ -158,46 +158,13 @@ void Employee::displayBrief() const {
 // ==================== FILE OPERATIONS ====================
 void Employee::saveToFile(ofstream& file) const {
     if (!file.is_open()) throw FileException("File is not open for writing");
-    
-    file << employeeId << "|"
-         << name << "|"
-         << position << "|"
-         << static_cast<int>(department) << "|"
-         << static_cast<int>(shift) << "|"
-         << salary << "|"
-         << contactNumber << "|"
-         << address << "|"
-         << joinDate << "|"
-         << email << "|"
-         << password << "\n";
+    Serialization::writeText(file, *this);
 }
 
 void Employee::loadFromFile(ifstream& file) {
     if (!file.is_open()) throw FileException("File is not open for reading");
-    
-    string line;
-    if (getline(file, line)) {
-        stringstream ss(line);
-        string token;
-        vector<string> tokens;
-        
-        while (getline(ss, token, '|')) {
-            tokens.push_back(token);
-        }
-        
-        if (tokens.size() >= 11) {
-            employeeId = stoi(tokens[0]);
-            name = tokens[1];
-            position = tokens[2];
-            department = static_cast<Department>(stoi(tokens[3]));
-            shift = static_cast<Shift>(stoi(tokens[4]));
-            salary = stod(tokens[5]);
-            contactNumber = tokens[6];
-            address = tokens[7];
-            joinDate = tokens[8];
-            email = tokens[9];
-            password = tokens[10];
-        }
+    if (!Serialization::readText(file, *this)) {
+        throw FileReadException("employees", "unexpected end of file");
     }
 }
 
@@ -2,8 +2,11 @@
 #define EMPLOYEE_H
 
 #include "Utils.h"
+#include "Serialization.h"
 
 class Employee {
+    template <class T> friend struct Schema;
+    
 private:
     int employeeId;
     string name;
@@ -70,4 +73,20 @@ public:
     bool isValid() const;
 };
 
+template <>
+struct Schema<Employee> {
+    static constexpr auto fields = make_tuple(
+        field("employeeId", &Employee::employeeId),
+        field("name", &Employee::name),
+        field("position", &Employee::position),
+        field("department", &Employee::department),
+        field("shift", &Employee::shift),
+        field("salary", &Employee::salary),
+        field("contactNumber", &Employee::contactNumber),
+        field("address", &Employee::address),
+        field("joinDate", &Employee::joinDate),
+        field("email", &Employee::email),
+        field("password", &Employee::password, FieldKind::Secret));
+};
+
 #endif // EMPLOYEE_H
\ No newline at end of file
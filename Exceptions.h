@@ -6,6 +6,7 @@
 #include <iostream>
 #include <ctime>
 #include <cstring>
+#include "Logger.h"
 
 using namespace std;
 
@@ -318,7 +319,7 @@ public:
     }
     
     static void logException(const HotelException& e) {
-        cerr << "\n[EXCEPTION LOGGED] " << e.getFullMessage() << endl;
+        HLOG_ERROR("exception code={} {}", e.getErrorCode(), e.what());
     }
     
     static void displayErrorMessage(const HotelException& e) {
@@ -1,6 +1,7 @@
 #include "Hotel.h"
+#include "Constants.h"
 
-Hotel::Hotel() : currentEmployee(nullptr) {
+Hotel::Hotel() : sessionExpired(false) {
     hotelName = "Grand Luxury Hotel";
     hotelAddress = "123 Luxury Street, New York, NY 10001";
     hotelContact = "+1 (555) 123-4567";
@@ -10,6 +11,8 @@ Hotel::Hotel() : currentEmployee(nullptr) {
     Utils::createDirectory("data");
     Utils::createDirectory("backup");
     Utils::createDirectory("reports");
+    
+    startBackgroundJobs();
 }
 
 Hotel::~Hotel() {
@@ -31,6 +34,16 @@ void Hotel::run() {
             
             choice = Utils::getIntegerInput("\nEnter your choice (0-8): ", 0, 8);
             
+            // Input cannot be interrupted, so an expired session is closed
+            // at the first choice made after it timed out
+            if (sessionExpired) {
+                Utils::showMessage("Session timed out after " + to_string(HotelConstants::SESSION_TIMEOUT_MINUTES) +
+                                   " idle minutes. Please log in again.", 'w');
+                currentEmployee.reset();
+                login();
+                continue;
+            }
+            
             switch(choice) {
                 case 1:
                     manageRooms();
@@ -114,17 +127,47 @@ void Hotel::showDashboard() {
     cout << "📞 " << hotelContact << " | ✉️  " << hotelEmail << "\n";
     cout << "📅 " << Utils::getCurrentDate() << " | 👤 " << getCurrentUser() << "\n";
     
+    DashboardStats stats = database.getDashboardStats();
+    
     cout << "\n┌─────────────────┬─────────────────┬─────────────────┐\n";
     cout << "│    📊 STATS     │    🛏️  ROOMS    │    👥 GUESTS    │\n";
     cout << "├─────────────────┼─────────────────┼─────────────────┤\n";
     cout << "│ Total Rooms:    │ Available:      │ Today's Check:  │\n";
-    cout << "│     " << setw(3) << database.getRoomCount() 
-         << "        │      " << setw(3) << database.getAvailableRoomCount() 
-         << "       │      " << setw(3) << database.findTodayCheckIns().size() 
+    cout << "│     " << setw(3) << stats.totalRooms 
+         << "        │      " << setw(3) << stats.availableRooms 
+         << "       │      " << setw(3) << stats.todayCheckIns 
          << "       │\n";
     cout << "└─────────────────┴─────────────────┴─────────────────┘\n";
 }
 
+// ==================== BACKGROUND JOBS ====================
+void Hotel::startBackgroundJobs() {
+    // Arrivals missed while the system was down are marked straight away
+    database.markNoShows();
+    scheduler.every(chrono::minutes(HotelConstants::AUTO_SAVE_MINUTES), [this]() {
+        database.saveAllData();
+    });
+    scheduler.every(chrono::hours(HotelConstants::AUTO_BACKUP_HOURS), [this]() {
+        database.backupData();
+    });
+    scheduler.every(chrono::minutes(HotelConstants::NO_SHOW_CHECK_MINUTES), [this]() {
+        database.markNoShows();
+    });
+    watchSession();
+}
+
+// Fires when the session would time out if nothing was typed since the last
+// check, and re-arms for whatever is left when something was
+void Hotel::watchSession() {
+    const time_t timeout = HotelConstants::SESSION_TIMEOUT_MINUTES * 60;
+    time_t idle = time(nullptr) - Utils::getLastInputTime();
+    if (idle >= timeout) {
+        sessionExpired = true;
+        idle = 0;
+    }
+    scheduler.after(chrono::seconds(timeout - max<time_t>(idle, 0)), [this]() { watchSession(); });
+}
+
 // ==================== LOGIN/LOGOUT ====================
 void Hotel::login() {
     Utils::clearScreen();
@@ -147,6 +190,8 @@ void Hotel::login() {
         currentEmployee = database.authenticateEmployee(email, password);
         
         if (currentEmployee) {
+            sessionExpired = false;
+            database.setActingEmployee(currentEmployee->getEmployeeId());
             Utils::showMessage("Login successful! Welcome, " + currentEmployee->getName() + "!", 's');
             return;
         } else {
@@ -162,7 +207,8 @@ void Hotel::login() {
 void Hotel::logout() {
     if (currentEmployee) {
         Utils::showMessage("Goodbye, " + currentEmployee->getName() + "!", 's');
-        currentEmployee = nullptr;
+        currentEmployee.reset();
+        database.setActingEmployee(0);
     }
 }
 
@@ -175,7 +221,7 @@ bool Hotel::isManager() const {
 }
 
 bool Hotel::isLoggedIn() const {
-    return currentEmployee != nullptr;
+    return currentEmployee.has_value();
 }
 
 string Hotel::getCurrentUser() const {
@@ -196,6 +242,8 @@ void Hotel::manageRooms() {
             "Search Room",
             "Update Room Status",
             "Modify Room Details",
+            "Set Seasonal Rates",
+            "Find Cheapest Room",
             "Back to Main Menu"
         };
         
@@ -221,13 +269,19 @@ void Hotel::manageRooms() {
             case 6:
                 modifyRoomDetails();
                 break;
+            case 7:
+                setRoomRates();
+                break;
+            case 8:
+                findCheapestRoom();
+                break;
         }
         
         if (choice != 0) {
             Utils::pressEnterToContinue();
         }
         
-    } while (choice != 0 && choice != 7);
+    } while (choice != 0 && choice != 9);
 }
 
 void Hotel::addNewRoom() {
@@ -270,7 +324,7 @@ void Hotel::addNewRoom() {
 
 void Hotel::searchRoom() {
     int roomNumber = Utils::getIntegerInput("Enter room number: ");
-    Room* room = database.findRoom(roomNumber);
+    optional<Room> room = database.getRoom(roomNumber);
     
     if (room) {
         room->display();
@@ -281,7 +335,7 @@ void Hotel::searchRoom() {
 
 void Hotel::updateRoomStatus() {
     int roomNumber = Utils::getIntegerInput("Enter room number: ");
-    Room* room = database.findRoom(roomNumber);
+    optional<Room> room = database.getRoom(roomNumber);
     
     if (room) {
         cout << "\nCurrent Status: " << room->getStatusString() << "\n";
@@ -303,7 +357,7 @@ void Hotel::updateRoomStatus() {
 
 void Hotel::modifyRoomDetails() {
     int roomNumber = Utils::getIntegerInput("Enter room number: ");
-    Room* room = database.findRoom(roomNumber);
+    optional<Room> room = database.getRoom(roomNumber);
     
     if (room) {
         room->display();
@@ -314,27 +368,29 @@ void Hotel::modifyRoomDetails() {
         int choice = Utils::getIntegerInput("Select option (1-3): ", 1, 3);
         
         try {
+            double newPrice = room->getPricePerNight();
+            vector<string> features = room->getFeatures();
             if (choice == 1 || choice == 3) {
-                double newPrice = Utils::getDoubleInput("Enter new price: $", 50.0);
-                room->setPrice(newPrice);
+                newPrice = Utils::getDoubleInput("Enter new price: $", 50.0);
             }
             
             if (choice == 2 || choice == 3) {
                 cout << "\nEnter new features (comma separated): ";
                 string featuresInput = Utils::getStringInput("");
-                vector<string> features;
+                features.clear();
                 
                 stringstream ss(featuresInput);
                 string feature;
                 while (getline(ss, feature, ',')) {
                     features.push_back(Utils::trim(feature));
                 }
-                
-                room->setFeatures(features);
             }
             
-            database.saveAllData();
-            Utils::showMessage("Room details updated successfully!", 's');
+            if (database.modifyRoom(roomNumber, newPrice, features)) {
+                Utils::showMessage("Room details updated successfully!", 's');
+            } else {
+                Utils::showMessage("Room not found!", 'e');
+            }
             
         } catch (const HotelException& e) {
             Utils::showMessage(e.what(), 'e');
@@ -344,6 +400,95 @@ void Hotel::modifyRoomDetails() {
     }
 }
 
+void Hotel::setRoomRates() {
+    try {
+        Utils::displayHeader("SET SEASONAL RATES");
+        
+        cout << "\n1. Seasonal factor for a room type\n";
+        cout << "2. Price per night for one room\n";
+        cout << "3. Clear a room's own rates\n";
+        cout << "4. Clear a room type's seasonal factors\n";
+        int choice = Utils::getIntegerInput("Select option (1-4): ", 1, 4);
+        
+        if (choice == 3) {
+            database.clearRoomRates(Utils::getIntegerInput("Enter room number: "));
+            Utils::showMessage("Room follows its type calendar again", 's');
+            return;
+        }
+        if (choice == 4) {
+            cout << "1. Standard\n2. Deluxe\n3. Suite\n4. Presidential\n";
+            database.clearSeasonalRates(Utils::intToRoomType(Utils::getIntegerInput("Select room type (1-4): ", 1, 4)));
+            Utils::showMessage("Room type is back to its base prices", 's');
+            return;
+        }
+        
+        RoomType type = STANDARD;
+        int roomNumber = 0;
+        if (choice == 1) {
+            cout << "1. Standard\n2. Deluxe\n3. Suite\n4. Presidential\n";
+            type = Utils::intToRoomType(Utils::getIntegerInput("Select room type (1-4): ", 1, 4));
+        } else {
+            roomNumber = Utils::getIntegerInput("Enter room number: ");
+        }
+        
+        string fromStr, toStr;
+        do {
+            fromStr = Utils::getStringInput("First Night (YYYY-MM-DD): ");
+        } while (!Utils::isValidDate(fromStr));
+        do {
+            toStr = Utils::getStringInput("Last Night (YYYY-MM-DD): ");
+        } while (!Utils::isValidDate(toStr));
+        
+        if (choice == 1) {
+            double factor = Utils::getDoubleInput("Factor on base price (e.g. 1.25): ", 0.1);
+            database.setSeasonalRate(type, Utils::parseDate(fromStr), Utils::parseDate(toStr), factor);
+        } else {
+            double price = Utils::getDoubleInput("Price per night: $", 1.0);
+            database.setRoomRate(roomNumber, Utils::parseDate(fromStr), Utils::parseDate(toStr), price);
+        }
+        Utils::showMessage("Rates updated successfully!", 's');
+        
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
+void Hotel::findCheapestRoom() {
+    try {
+        Utils::displayHeader("FIND CHEAPEST ROOM");
+        
+        string checkInStr, checkOutStr;
+        do {
+            checkInStr = Utils::getStringInput("Check-in Date (YYYY-MM-DD): ");
+        } while (!Utils::isValidDate(checkInStr));
+        do {
+            checkOutStr = Utils::getStringInput("Check-out Date (YYYY-MM-DD): ");
+        } while (!Utils::isValidDate(checkOutStr));
+        int guests = Utils::getIntegerInput("Number of Guests: ", 1, 6);
+        
+        time_t checkIn = Utils::parseDate(checkInStr);
+        time_t checkOut = Utils::parseDate(checkOutStr);
+        vector<RoomStayCost> rooms = database.findCheapestRooms(checkIn, checkOut, guests, 10);
+        if (rooms.empty()) {
+            Utils::showMessage("No room is free for those dates", 'w');
+            return;
+        }
+        
+        int nights = Utils::daysBetween(checkIn, checkOut);
+        cout << "\n" << left << setw(8) << "Room" << setw(14) << "Type" << right
+             << setw(14) << "Stay Total" << setw(14) << "Per Night" << "\n";
+        cout << string(50, '-') << "\n";
+        for (const auto& room : rooms) {
+            cout << left << setw(8) << room.roomNumber << setw(14) << Utils::roomTypeToString(room.type) << right
+                 << setw(14) << Utils::formatCurrency(room.total)
+                 << setw(14) << Utils::formatCurrency(room.total / nights) << "\n";
+        }
+        
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
 // ==================== CUSTOMER MANAGEMENT ====================
 void Hotel::manageCustomers() {
     int choice;
@@ -429,7 +574,7 @@ void Hotel::searchCustomer() {
     
     if (searchType == 1) {
         int customerId = Utils::getIntegerInput("Enter Customer ID: ");
-        Customer* customer = database.findCustomer(customerId);
+        optional<Customer> customer = database.getCustomer(customerId);
         if (customer) {
             customer->display();
         } else {
@@ -437,7 +582,7 @@ void Hotel::searchCustomer() {
         }
     } else if (searchType == 2) {
         string name = Utils::getStringInput("Enter name: ");
-        Customer* customer = database.findCustomerByName(name);
+        optional<Customer> customer = database.getCustomerByName(name);
         if (customer) {
             customer->display();
         } else {
@@ -445,10 +590,10 @@ void Hotel::searchCustomer() {
         }
     } else if (searchType == 3) {
         string phone = Utils::getStringInput("Enter phone: ");
-        vector<Customer*> customers = database.findCustomersByPhone(phone);
+        vector<Customer> customers = database.getCustomersByPhone(phone);
         if (!customers.empty()) {
-            for (auto customer : customers) {
-                customer->displayBrief();
+            for (const auto& customer : customers) {
+                customer.displayBrief();
             }
         } else {
             Utils::showMessage("No customers found!", 'e');
@@ -458,7 +603,7 @@ void Hotel::searchCustomer() {
 
 void Hotel::updateCustomerInfo() {
     int customerId = Utils::getIntegerInput("Enter Customer ID: ");
-    Customer* customer = database.findCustomer(customerId);
+    optional<Customer> customer = database.getCustomer(customerId);
     
     if (customer) {
         customer->display();
@@ -509,19 +654,19 @@ void Hotel::updateCustomerInfo() {
 
 void Hotel::viewCustomerHistory() {
     int customerId = Utils::getIntegerInput("Enter Customer ID: ");
-    Customer* customer = database.findCustomer(customerId);
+    optional<Customer> customer = database.getCustomer(customerId);
     
     if (customer) {
         customer->display();
         
-        vector<Reservation*> reservations = database.findReservationsByCustomer(customerId);
+        vector<Reservation> reservations = database.getReservationsByCustomer(customerId);
         if (!reservations.empty()) {
             cout << "\n══════════════════════════════════════════════\n";
             cout << "           RESERVATION HISTORY\n";
             cout << "══════════════════════════════════════════════\n";
             
             for (const auto& reservation : reservations) {
-                reservation->displayBrief();
+                reservation.displayBrief();
             }
         } else {
             cout << "\nNo reservation history found.\n";
@@ -547,6 +692,9 @@ void Hotel::manageReservations() {
             "Cancel Reservation",
             "Process Check-in",
             "Process Check-out",
+            "Optimize Room Assignments",
+            "Group Bookings & Blocks",
+            "Waitlist",
             "Back to Main Menu"
         };
         
@@ -559,13 +707,13 @@ void Hotel::manageReservations() {
                 break;
             case 2:
                 {
-                    vector<Reservation*> active = database.findActiveReservations();
+                    vector<Reservation> active = database.findActiveReservations();
                     if (active.empty()) {
                         cout << "\nNo active reservations.\n";
                     } else {
                         cout << "\nActive Reservations (" << active.size() << "):\n";
                         for (const auto& res : active) {
-                            res->displayBrief();
+                            res.displayBrief();
                         }
                     }
                 }
@@ -588,13 +736,22 @@ void Hotel::manageReservations() {
             case 8:
                 processCheckOut();
                 break;
+            case 9:
+                optimizeRoomAssignments();
+                break;
+            case 10:
+                manageGroupBookings();
+                break;
+            case 11:
+                manageWaitlist();
+                break;
         }
         
         if (choice != 0) {
             Utils::pressEnterToContinue();
         }
         
-    } while (choice != 0 && choice != 9);
+    } while (choice != 0 && choice != 12);
 }
 
 void Hotel::makeNewReservation() {
@@ -643,9 +800,26 @@ void Hotel::makeNewReservation() {
         // Get special requests
         string requests = Utils::getStringInput("Special Requests (optional): ", true);
         
+        // Quote the stay before booking it
+        bool corporate = Utils::getYesNoInput("Corporate booking?");
+        RateQuote quote = database.quoteStay(roomNumber, checkIn, checkOut, customerId, corporate);
+        cout << "\nRate Quote (" << quote.nights << " nights):\n";
+        cout << "  Base Price:          " << setw(14) << Utils::formatCurrency(quote.baseTotal) << "\n";
+        cout << "  With Occupancy:      " << setw(14) << Utils::formatCurrency(quote.occupancyTotal) << "\n";
+        cout << "  Length of Stay:      " << setw(14) << Utils::formatCurrency(-quote.stayDiscount) << "\n";
+        cout << "  Customer Discount:   " << setw(14) << Utils::formatCurrency(-quote.customerDiscount) << "\n";
+        cout << "  Total:               " << setw(14) << Utils::formatCurrency(quote.total)
+             << "  (" << Utils::formatCurrency(quote.averageRate()) << " / night)\n";
+        if (!Utils::getYesNoInput("\nBook at this rate?")) {
+            return;
+        }
+        
         // Make reservation
         int reservationId = database.makeReservation(customerId, roomNumber, 
-                                                    checkIn, checkOut, guests, requests);
+                                                    checkIn, checkOut, guests, requests, corporate);
+        if (Utils::getYesNoInput("Guest requested this specific room?")) {
+            database.setRoomPinned(reservationId, true);
+        }
         
         Utils::showMessage("Reservation created successfully! Reservation ID: " + 
                           to_string(reservationId), 's');
@@ -662,7 +836,7 @@ void Hotel::makeNewReservation() {
 
 void Hotel::viewReservation() {
     int reservationId = Utils::getIntegerInput("Enter Reservation ID: ");
-    Reservation* reservation = database.findReservation(reservationId);
+    optional<Reservation> reservation = database.getReservation(reservationId);
     
     if (reservation) {
         reservation->display();
@@ -673,7 +847,7 @@ void Hotel::viewReservation() {
 
 void Hotel::modifyReservation() {
     int reservationId = Utils::getIntegerInput("Enter Reservation ID: ");
-    Reservation* reservation = database.findReservation(reservationId);
+    optional<Reservation> reservation = database.getReservation(reservationId);
     
     if (reservation) {
         if (reservation->getStatus() != CONFIRMED) {
@@ -708,16 +882,15 @@ void Hotel::modifyReservation() {
                 time_t newCheckIn = Utils::parseDate(checkInStr);
                 time_t newCheckOut = Utils::parseDate(checkOutStr);
                 
-                reservation->setDates(newCheckIn, newCheckOut);
+                database.changeReservationDates(reservationId, newCheckIn, newCheckOut);
             } else if (choice == 2) {
                 int newGuests = Utils::getIntegerInput("New Number of Guests: ", 1, 6);
-                reservation->setGuests(newGuests);
+                database.modifyReservation(reservationId, newGuests, reservation->getSpecialRequests());
             } else if (choice == 3) {
                 string newRequests = Utils::getStringInput("New Special Requests: ", true);
-                reservation->setSpecialRequests(newRequests);
+                database.modifyReservation(reservationId, reservation->getNumberOfGuests(), newRequests);
             }
             
-            database.saveAllData();
             Utils::showMessage("Reservation modified successfully!", 's');
             
         } catch (const HotelException& e) {
@@ -757,8 +930,7 @@ void Hotel::processCheckOut() {
         Utils::showMessage("Check-out processed successfully!", 's');
         
         // Ask to create bill if not exists
-        Bill* bill = database.findBillByReservation(reservationId);
-        if (!bill) {
+        if (!database.getBillForReservation(reservationId)) {
             if (Utils::getYesNoInput("\nCreate bill for this stay?")) {
                 createNewBill();
             }
@@ -768,6 +940,172 @@ void Hotel::processCheckOut() {
     }
 }
 
+// Asks for the rooms a group needs, one room type per line
+vector<GroupRoomRequest> Hotel::readGroupRequest() {
+    vector<GroupRoomRequest> request;
+    do {
+        cout << "1. Standard\n2. Deluxe\n3. Suite\n4. Presidential\n";
+        GroupRoomRequest line;
+        line.type = Utils::intToRoomType(Utils::getIntegerInput("Select room type (1-4): ", 1, 4));
+        line.rooms = Utils::getIntegerInput("Number of rooms: ", 1, 500);
+        line.guestsPerRoom = Utils::getIntegerInput("Guests per room: ", 1, 6);
+        request.push_back(line);
+    } while (Utils::getYesNoInput("Add another room type?"));
+    return request;
+}
+
+time_t Hotel::readDate(const string& prompt) {
+    string date;
+    do {
+        date = Utils::getStringInput(prompt);
+        if (!Utils::isValidDate(date)) {
+            Utils::showMessage("Invalid date format!", 'e');
+        }
+    } while (!Utils::isValidDate(date));
+    return Utils::parseDate(date);
+}
+
+void Hotel::manageGroupBookings() {
+    try {
+        Utils::displayHeader("GROUP BOOKINGS & BLOCKS");
+        
+        cout << "\n1. Book a group now\n";
+        cout << "2. Create a room block\n";
+        cout << "3. Pick up a room from a block\n";
+        cout << "4. View room blocks\n";
+        cout << "5. Release a block\n";
+        int choice = Utils::getIntegerInput("Select option (1-5): ", 1, 5);
+        
+        if (choice == 1 || choice == 2) {
+            int customerId = Utils::getIntegerInput("Enter organiser's Customer ID: ");
+            string groupName = choice == 2 ? Utils::getStringInput("Group Name: ") : "";
+            time_t checkIn = readDate("Check-in Date (YYYY-MM-DD): ");
+            time_t checkOut = readDate("Check-out Date (YYYY-MM-DD): ");
+            vector<GroupRoomRequest> request = readGroupRequest();
+            bool corporate = Utils::getYesNoInput("Corporate booking?");
+            
+            if (choice == 1) {
+                vector<int> ids = database.makeGroupReservation(customerId, request, checkIn, checkOut, "", corporate);
+                Utils::showMessage(to_string(ids.size()) + " rooms booked, reservations " + to_string(ids.front()) +
+                                  " to " + to_string(ids.back()), 's');
+            } else {
+                time_t release = readDate("Release Date (YYYY-MM-DD): ");
+                int blockId = database.createRoomBlock(customerId, groupName, request, checkIn, checkOut, release, corporate);
+                Utils::showMessage("Block created! Block ID: " + to_string(blockId), 's');
+            }
+        } else if (choice == 3) {
+            int blockId = Utils::getIntegerInput("Enter Block ID: ");
+            int customerId = Utils::getIntegerInput("Enter guest's Customer ID: ");
+            cout << "1. Standard\n2. Deluxe\n3. Suite\n4. Presidential\n";
+            RoomType type = Utils::intToRoomType(Utils::getIntegerInput("Select room type (1-4): ", 1, 4));
+            int guests = Utils::getIntegerInput("Number of Guests: ", 1, 6);
+            int reservationId = database.pickUpFromBlock(blockId, customerId, type, guests);
+            Utils::showMessage("Room picked up! Reservation ID: " + to_string(reservationId), 's');
+        } else if (choice == 4) {
+            vector<RoomBlock> blocks = database.getBlocks();
+            if (blocks.empty()) {
+                cout << "\nNo room blocks.\n";
+            }
+            for (const auto& block : blocks) {
+                block.displayBrief();
+            }
+        } else {
+            int blockId = Utils::getIntegerInput("Enter Block ID to release: ");
+            if (Utils::getYesNoInput("Put the rooms still held back on sale?")) {
+                int released = database.releaseBlock(blockId);
+                Utils::showMessage(to_string(released) + " rooms released", 's');
+            }
+        }
+        
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
+void Hotel::manageWaitlist() {
+    try {
+        Utils::displayHeader("WAITLIST");
+        
+        cout << "\n1. Add a guest to the waitlist\n";
+        cout << "2. View waiting requests\n";
+        cout << "3. Withdraw a request\n";
+        int choice = Utils::getIntegerInput("Select option (1-3): ", 1, 3);
+        
+        if (choice == 1) {
+            int customerId = Utils::getIntegerInput("Enter Customer ID: ");
+            cout << "1. Standard\n2. Deluxe\n3. Suite\n4. Presidential\n";
+            RoomType type = Utils::intToRoomType(Utils::getIntegerInput("Select room type (1-4): ", 1, 4));
+            int guests = Utils::getIntegerInput("Number of Guests: ", 1, 6);
+            time_t checkIn = readDate("Check-in Date (YYYY-MM-DD): ");
+            time_t checkOut = readDate("Check-out Date (YYYY-MM-DD): ");
+            int requestId = database.joinWaitlist(customerId, type, guests, checkIn, checkOut);
+            Utils::showMessage("Added to the waitlist! Request ID: " + to_string(requestId), 's');
+        } else if (choice == 2) {
+            int shown = 0;
+            for (const auto& request : database.getWaitingRequests()) {
+                cout << "Request: " << setw(5) << request.requestId
+                     << " | Cust: " << setw(6) << request.customerId
+                     << " | " << setw(12) << left << Utils::roomTypeToString(request.type) << right
+                     << " | Guests: " << request.guests
+                     << " | " << Utils::formatDate(request.checkInDate) << " to "
+                     << Utils::formatDate(request.checkOutDate) << "\n";
+                shown++;
+            }
+            if (shown == 0) {
+                cout << "\nNobody is waiting.\n";
+            }
+        } else {
+            int requestId = Utils::getIntegerInput("Enter Request ID to withdraw: ");
+            if (database.withdrawFromWaitlist(requestId)) {
+                Utils::showMessage("Request withdrawn", 's');
+            } else {
+                Utils::showMessage("No waiting request with that ID", 'e');
+            }
+        }
+        
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
+void Hotel::optimizeRoomAssignments() {
+    try {
+        Utils::displayHeader("OPTIMIZE ROOM ASSIGNMENTS");
+        
+        int days = Utils::getIntegerInput("Arrivals over the next how many days? ", 1, HotelConstants::MAX_ADVANCE_BOOKING);
+        AssignmentPlan plan = database.planRoomAssignments(days);
+        
+        cout << "\nMovable Arrivals:     " << setw(10) << plan.movable << "\n";
+        cout << "Fixed Stays:          " << setw(10) << plan.fixed << "\n";
+        cout << "Orphan Nights Now:    " << setw(10) << plan.orphanNightsBefore << "\n";
+        cout << "Orphan Nights After:  " << setw(10) << plan.orphanNightsAfter << "\n";
+        if (plan.unplaced > 0) {
+            cout << "Kept (no free room):  " << setw(10) << plan.unplaced << "\n";
+        }
+        
+        if (plan.moves.empty()) {
+            Utils::showMessage("Current assignments are already the best found", 'i');
+            return;
+        }
+        
+        cout << "\n" << left << setw(15) << "Reservation" << setw(10) << "From" << setw(10) << "To" << "\n";
+        cout << string(35, '-') << "\n";
+        for (const auto& move : plan.moves) {
+            cout << left << setw(15) << move.reservationId << setw(10) << move.fromRoom
+                 << setw(10) << move.toRoom << "\n";
+        }
+        cout << right;
+        
+        if (Utils::getYesNoInput("\nApply " + to_string(plan.moves.size()) + " room changes?")) {
+            int applied = database.applyRoomAssignments(plan);
+            Utils::showMessage(to_string(applied) + " reservations moved", 's');
+        }
+        
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
 // ==================== QUICK OPERATIONS ====================
 void Hotel::quickCheckIn() {
     try {
@@ -790,7 +1128,7 @@ void Hotel::quickCheckOut() {
 void Hotel::quickPayment() {
     try {
         int billId = Utils::getIntegerInput("Enter Bill ID: ");
-        Bill* bill = database.findBill(billId);
+        optional<Bill> bill = database.getBill(billId);
         
         if (bill) {
             bill->display();
@@ -918,7 +1256,7 @@ void Hotel::addNewEmployee() {
 
 void Hotel::searchEmployee() {
     int employeeId = Utils::getIntegerInput("Enter Employee ID: ");
-    Employee* employee = database.findEmployee(employeeId);
+    optional<Employee> employee = database.getEmployee(employeeId);
     
     if (employee) {
         employee->display();
@@ -929,7 +1267,7 @@ void Hotel::searchEmployee() {
 
 void Hotel::updateEmployeeInfo() {
     int employeeId = Utils::getIntegerInput("Enter Employee ID: ");
-    Employee* employee = database.findEmployee(employeeId);
+    optional<Employee> employee = database.getEmployee(employeeId);
     
     if (employee) {
         employee->display();
@@ -982,19 +1320,19 @@ void Hotel::updateEmployeeInfo() {
 
 void Hotel::changeEmployeePassword() {
     int employeeId = Utils::getIntegerInput("Enter Employee ID: ");
-    Employee* employee = database.findEmployee(employeeId);
+    optional<Employee> employee = database.getEmployee(employeeId);
     
     if (employee) {
         string oldPassword = Utils::getStringInput("Enter old password: ");
-        // Note: In a real system, you would verify the old password
         string newPassword = Utils::getStringInput("Enter new password: ");
         string confirmPassword = Utils::getStringInput("Confirm new password: ");
         
-        if (newPassword == confirmPassword) {
-            // Note: In a real system, update password in database
-            Utils::showMessage("Password changed successfully!", 's');
-        } else {
-            Utils::showMessage("Passwords do not match!", 'e');
+        try {
+            if (database.changeEmployeePassword(employeeId, oldPassword, newPassword, confirmPassword)) {
+                Utils::showMessage("Password changed successfully!", 's');
+            }
+        } catch (const HotelException& e) {
+            Utils::showMessage(e.what(), 'e');
         }
     } else {
         Utils::showMessage("Employee not found!", 'e');
@@ -1054,9 +1392,12 @@ void Hotel::showReports() {
         cout << "1. Revenue Report\n";
         cout << "2. Occupancy Report\n";
         cout << "3. Customer Report\n";
-        cout << "4. Back to Main Menu\n";
+        cout << "4. Popular Rooms Report\n";
+        cout << "5. Booking Pace Forecast\n";
+        cout << "6. Export Reports\n";
+        cout << "7. Back to Main Menu\n";
         
-        choice = Utils::getIntegerInput("Select option (1-4): ", 1, 4);
+        choice = Utils::getIntegerInput("Select option (1-7): ", 1, 7);
         
         switch(choice) {
             case 1:
@@ -1069,6 +1410,15 @@ void Hotel::showReports() {
                 generateCustomerReport();
                 break;
             case 4:
+                generatePopularRoomsReport();
+                break;
+            case 5:
+                generatePaceReport();
+                break;
+            case 6:
+                exportReports();
+                break;
+            case 7:
                 viewingReports = false;
                 break;
         }
@@ -1083,10 +1433,11 @@ void Hotel::systemSettings() {
     
     cout << "1. Display Hotel Information\n";
     cout << "2. Backup Database\n";
-    cout << "3. View Logs\n";
-    cout << "4. Back to Main Menu\n";
+    cout << "3. View Audit Trail\n";
+    cout << "4. Run Night Audit\n";
+    cout << "5. Back to Main Menu\n";
     
-    int choice = Utils::getIntegerInput("Select option (1-4): ", 1, 4);
+    int choice = Utils::getIntegerInput("Select option (1-5): ", 1, 5);
     
     switch(choice) {
         case 1:
@@ -1096,13 +1447,109 @@ void Hotel::systemSettings() {
             Utils::showMessage("Backup feature coming soon!", 'i');
             break;
         case 3:
-            Utils::showMessage("Logs feature coming soon!", 'i');
+            viewAuditTrail();
             break;
         case 4:
+            runNightAudit();
+            break;
+        case 5:
             break;
     }
 }
 
+void Hotel::viewAuditTrail() {
+    if (!isAdmin() && !isManager()) {
+        Utils::showMessage("Access denied! Manager/Admin privileges required.", 'e');
+        return;
+    }
+    
+    AuditTrail& trail = database.getAuditTrail();
+    cout << "\n1. Actions on a Reservation\n";
+    cout << "2. Actions on a Bill\n";
+    cout << "3. Employee Actions Today\n";
+    cout << "4. Verify Audit Trail\n";
+    int choice = Utils::getIntegerInput("Select option (1-4): ", 1, 4);
+    
+    try {
+        switch (choice) {
+            case 1:
+                showAuditEntries(trail.findByEntity(AUDIT_RESERVATION, Utils::getIntegerInput("Enter Reservation ID: ")));
+                break;
+            case 2:
+                showAuditEntries(trail.findByEntity(AUDIT_BILL, Utils::getIntegerInput("Enter Bill ID: ")));
+                break;
+            case 3: {
+                int employeeId = Utils::getIntegerInput("Enter Employee ID: ");
+                time_t now = time(nullptr);
+                tm midnight;
+                localtime_s(&midnight, &now);
+                midnight.tm_hour = midnight.tm_min = midnight.tm_sec = 0;
+                showAuditEntries(trail.findByEmployee(employeeId, mktime(&midnight), now + 1));
+                break;
+            }
+            case 4: {
+                AuditVerification check = trail.verify();
+                if (check.intact) {
+                    Utils::showMessage("Audit trail intact: " + to_string(check.entries) + " entries, head " +
+                                       AuditTrail::hashToHex(trail.getHead()).substr(0, 16), 's');
+                } else {
+                    Utils::showMessage("Audit trail broken at entry " + to_string(check.firstBroken) + "!", 'e');
+                }
+                break;
+            }
+        }
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
+void Hotel::showAuditEntries(const vector<AuditEntry>& entries) {
+    if (entries.empty()) {
+        Utils::showMessage("No audited actions found.", 'i');
+        return;
+    }
+    
+    for (const auto& entry : entries) {
+        time_t seconds = static_cast<time_t>(entry.timestamp / 1000000);
+        tm local;
+        localtime_s(&local, &seconds);
+        char when[20];
+        strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", &local);
+        
+        cout << "#" << entry.sequence << "  " << when
+             << "  Employee " << entry.employeeId
+             << "  " << AuditTrail::actionToString(entry.action)
+             << " " << AuditTrail::entityToString(entry.entity) << " " << entry.entityId << "\n";
+        cout << "    before: " << entry.before << "\n";
+        cout << "    after:  " << entry.after << "\n";
+    }
+}
+
+void Hotel::runNightAudit() {
+    string night = Utils::formatDate(Calendar::fromEpochDay(database.getBusinessDay()));
+    if (!Utils::getYesNoInput("\nClose the business day " + night + " and post room charges?")) return;
+    
+    try {
+        NightAuditReport audit = database.runNightAudit();
+        OccupancySummary rooms = audit.kpis.allRooms();
+        
+        cout << "\nNight Audit for " << night << "\n";
+        cout << "Room charges posted:  " << setw(12) << audit.chargesPosted << "\n";
+        cout << "Bills opened:         " << setw(12) << audit.billsOpened << "\n";
+        cout << "Already paid:         " << setw(12) << audit.staysSettled << "\n";
+        cout << "Room charges:         " << setw(12) << Utils::formatCurrency(audit.roomCharges) << "\n";
+        cout << "Tax:                  " << setw(12) << Utils::formatCurrency(audit.tax) << "\n";
+        cout << "Occupancy:            " << setw(11) << fixed << setprecision(1) << rooms.occupancyRate() << "%\n";
+        cout << "ADR:                  " << setw(12) << Utils::formatCurrency(rooms.adr()) << "\n";
+        cout << "RevPAR:               " << setw(12) << Utils::formatCurrency(rooms.revPar()) << "\n";
+        cout << "Revenue collected:    " << setw(12) << Utils::formatCurrency(audit.kpis.totalRevenue()) << "\n";
+        Utils::showMessage("Business day is now " +
+                           Utils::formatDate(Calendar::fromEpochDay(audit.businessDay + 1)), 's');
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
+}
+
 void Hotel::saveAndExit() {
     Utils::clearScreen();
     cout << "\n╔════════════════════════════════════════╗\n";
@@ -1130,9 +1577,69 @@ void Hotel::generateRevenueReport() {
     cout << "\n╔════════════════════════════════════════╗\n";
     cout << "║          REVENUE REPORT                ║\n";
     cout << "╚════════════════════════════════════════╝\n\n";
-    cout << "Total Revenue: $0.00\n";
-    cout << "Revenue from Room Bookings: $0.00\n";
-    cout << "Revenue from Services: $0.00\n";
+    
+    shared_ptr<const DatabaseSnapshot> snapshot = database.snapshot();
+    const KpiCube& cube = *snapshot->kpiCube;
+    KpiSlice allTime = cube.getAllTime();
+    int today = Utils::getTodayEpochDay();
+    
+    cout << "Total Revenue:              " << setw(12) << Utils::formatCurrency(allTime.totalRevenue()) << "\n";
+    cout << "Revenue from Room Bookings: " << setw(12) << Utils::formatCurrency(allTime.categoryRevenue(REVENUE_ROOM)) << "\n";
+    cout << "Revenue from Food & Drinks: " << setw(12) << Utils::formatCurrency(allTime.categoryRevenue(REVENUE_FOOD)) << "\n";
+    cout << "Revenue from Services:      " << setw(12) << Utils::formatCurrency(allTime.categoryRevenue(REVENUE_SERVICE)) << "\n";
+    cout << "Payments Received:          " << setw(12) << allTime.payments << "\n";
+    cout << "Open Charges (unpaid):      " << setw(12) << Utils::formatCurrency(cube.getOpenCharges()) << "\n";
+    
+    cout << "\nToday:        " << setw(12) << Utils::formatCurrency(cube.getDay(today).totalRevenue()) << "\n";
+    cout << "Last 7 days:  " << setw(12) << Utils::formatCurrency(cube.getPeriod(today - 6, today).totalRevenue()) << "\n";
+    cout << "Last 30 days: " << setw(12) << Utils::formatCurrency(cube.getPeriod(today - 29, today).totalRevenue()) << "\n";
+    
+    // Year to date, split by room type
+    int yearStart = Calendar::daysFromCivil(Calendar::civilFromDays(today).year, 1, 1);
+    KpiSlice yearToDate = cube.getPeriod(yearStart, today);
+    cout << "\nYear to Date by Room Type:\n";
+    cout << left << setw(14) << "Room Type" << right << setw(12) << "Room" << setw(12) << "F&B"
+         << setw(12) << "Services" << setw(12) << "Total" << setw(8) << "Nights"
+         << setw(10) << "ADR" << setw(10) << "RevPAR" << "\n";
+    cout << string(90, '-') << "\n";
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        const OccupancySummary& rooms = yearToDate.rooms[t];
+        cout << left << setw(14) << Utils::roomTypeToString(static_cast<RoomType>(t)) << right
+             << setw(12) << Utils::formatCurrency(yearToDate.revenue[t][REVENUE_ROOM])
+             << setw(12) << Utils::formatCurrency(yearToDate.revenue[t][REVENUE_FOOD])
+             << setw(12) << Utils::formatCurrency(yearToDate.revenue[t][REVENUE_SERVICE])
+             << setw(12) << Utils::formatCurrency(yearToDate.typeRevenue(t))
+             << setw(8) << rooms.roomNightsSold
+             << setw(10) << Utils::formatCurrency(rooms.adr())
+             << setw(10) << Utils::formatCurrency(rooms.revPar()) << "\n";
+    }
+    
+    cout << "\nLast 12 Months:\n";
+    cout << left << setw(10) << "Month" << right << setw(14) << "Revenue" << setw(8) << "Nights"
+         << setw(11) << "Occupancy" << setw(10) << "ADR" << setw(10) << "RevPAR" << "\n";
+    cout << string(63, '-') << "\n";
+    int firstMonth = KpiCube::monthStart(KpiCube::monthIndex(today) - 11);
+    for (const auto& bucket : cube.rollUp(firstMonth, today, KPI_MONTH)) {
+        OccupancySummary rooms = bucket.slice.allRooms();
+        cout << left << setw(10) << Utils::formatDate(Calendar::fromEpochDay(bucket.firstDay)).substr(0, 7) << right
+             << setw(14) << Utils::formatCurrency(bucket.slice.totalRevenue())
+             << setw(8) << rooms.roomNightsSold
+             << setw(10) << fixed << setprecision(1) << rooms.occupancyRate() << "%"
+             << setw(10) << Utils::formatCurrency(rooms.adr())
+             << setw(10) << Utils::formatCurrency(rooms.revPar()) << "\n";
+    }
+    
+    cout << "\nLast 7 Days:\n";
+    cout << left << setw(12) << "Date" << right << setw(12) << "Room" << setw(12) << "F&B"
+         << setw(12) << "Services" << setw(12) << "Total" << "\n";
+    cout << string(60, '-') << "\n";
+    for (const auto& bucket : cube.rollUp(today - 6, today, KPI_DAY)) {
+        cout << left << setw(12) << Utils::formatDate(Calendar::fromEpochDay(bucket.firstDay)) << right
+             << setw(12) << Utils::formatCurrency(bucket.slice.categoryRevenue(REVENUE_ROOM))
+             << setw(12) << Utils::formatCurrency(bucket.slice.categoryRevenue(REVENUE_FOOD))
+             << setw(12) << Utils::formatCurrency(bucket.slice.categoryRevenue(REVENUE_SERVICE))
+             << setw(12) << Utils::formatCurrency(bucket.slice.totalRevenue()) << "\n";
+    }
     Utils::pressEnterToContinue();
 }
 
@@ -1141,10 +1648,46 @@ void Hotel::generateOccupancyReport() {
     cout << "\n╔════════════════════════════════════════╗\n";
     cout << "║         OCCUPANCY REPORT               ║\n";
     cout << "╚════════════════════════════════════════╝\n\n";
-    cout << "Total Rooms: 0\n";
-    cout << "Occupied Rooms: 0\n";
-    cout << "Available Rooms: 0\n";
-    cout << "Occupancy Rate: 0%\n";
+    
+    DashboardStats stats = database.getDashboardStats();
+    cout << "Total Rooms:     " << stats.totalRooms << "\n";
+    cout << "Occupied Rooms:  " << stats.occupiedRooms << "\n";
+    cout << "Available Rooms: " << stats.availableRooms << "\n";
+    
+    shared_ptr<const DatabaseSnapshot> snapshot = database.snapshot();   // Both periods from one view
+    int today = snapshot->today;
+    const pair<string, pair<int, int>> periods[] = {
+        {"Last 30 Nights", {today - 29, today}},
+        {"Next 30 Nights (on the books)", {today + 1, today + 30}}
+    };
+    
+    for (const auto& period : periods) {
+        OccupancyReport report = snapshot->getOccupancyReport(
+            Calendar::fromEpochDay(period.second.first), Calendar::fromEpochDay(period.second.second));
+        
+        cout << "\n" << period.first << " ("
+             << Utils::formatDate(Calendar::fromEpochDay(period.second.first)) << " to "
+             << Utils::formatDate(Calendar::fromEpochDay(period.second.second)) << "):\n";
+        cout << left << setw(14) << "Room Type" << right << setw(7) << "Rooms" << setw(8) << "Sold"
+             << setw(11) << "Occupancy" << setw(12) << "ADR" << setw(12) << "RevPAR" << "\n";
+        cout << string(64, '-') << "\n";
+        
+        auto printRow = [](const string& label, int roomCount, const OccupancySummary& summary) {
+            cout << left << setw(14) << label << right
+                 << setw(7) << roomCount
+                 << setw(8) << summary.roomNightsSold
+                 << setw(10) << fixed << setprecision(1) << summary.occupancyRate() << "%"
+                 << setw(12) << Utils::formatCurrency(summary.adr())
+                 << setw(12) << Utils::formatCurrency(summary.revPar()) << "\n";
+        };
+        
+        for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+            RoomType type = static_cast<RoomType>(t);
+            printRow(Utils::roomTypeToString(type), report.getInventory(type), report.getType(type));
+        }
+        cout << string(64, '-') << "\n";
+        printRow("All Rooms", stats.totalRooms, report.getTotal());
+    }
     Utils::pressEnterToContinue();
 }
 
@@ -1153,9 +1696,139 @@ void Hotel::generateCustomerReport() {
     cout << "\n╔════════════════════════════════════════╗\n";
     cout << "║        CUSTOMER REPORT                 ║\n";
     cout << "╚════════════════════════════════════════╝\n\n";
-    cout << "Total Customers: 0\n";
-    cout << "Active Reservations: 0\n";
-    cout << "Customers Checked In: 0\n";
+    
+    const int TOP_SPENDERS = 10;
+    CustomerReport report = database.getCustomerReport(TOP_SPENDERS);
+    
+    cout << "Total Customers:      " << setw(10) << report.totalCustomers << "\n";
+    cout << "Active Reservations:  " << setw(10) << report.activeReservations << "\n";
+    cout << "Customers Checked In: " << setw(10) << report.checkedInGuests << "\n";
+    cout << "Repeat Customers:     " << setw(10) << report.repeatCustomers << "\n\n";
+    
+    cout << "Top Customers by Spend:\n";
+    cout << left << setw(6) << "#" << setw(10) << "ID" << setw(24) << "Name" << right
+         << setw(10) << "Bookings" << setw(8) << "Nights" << setw(14) << "Spend" << "\n";
+    cout << string(72, '-') << "\n";
+    for (size_t i = 0; i < report.topSpenders.size(); i++) {
+        const CustomerActivity& activity = report.topSpenders[i];
+        optional<Customer> customer = database.getCustomer(activity.customerId);
+        cout << left << setw(6) << (i + 1) << setw(10) << activity.customerId
+             << setw(24) << (customer ? customer->getName() : string("-")) << right
+             << setw(10) << activity.bookings
+             << setw(8) << activity.roomNights
+             << setw(14) << Utils::formatCurrency(activity.spend) << "\n";
+    }
+    
+    Utils::pressEnterToContinue();
+}
+
+void Hotel::generatePopularRoomsReport() {
+    Utils::clearScreen();
+    cout << "\n╔════════════════════════════════════════╗\n";
+    cout << "║        POPULAR ROOMS REPORT            ║\n";
+    cout << "╚════════════════════════════════════════╝\n\n";
+    
+    const int TOP_ROOMS = 10;
+    int today = Utils::getTodayEpochDay();
+    
+    auto printTable = [](const string& title, const vector<RoomPopularityEntry>& entries) {
+        cout << title << ":\n";
+        cout << left << setw(6) << "#" << setw(8) << "Room" << setw(14) << "Type" << right
+             << setw(10) << "Bookings" << setw(8) << "Nights" << setw(14) << "Revenue" << "\n";
+        cout << string(60, '-') << "\n";
+        for (size_t i = 0; i < entries.size(); i++) {
+            cout << left << setw(6) << (i + 1) << setw(8) << entries[i].roomNumber
+                 << setw(14) << Utils::roomTypeToString(entries[i].type) << right
+                 << setw(10) << entries[i].usage.bookings
+                 << setw(8) << entries[i].usage.roomNights
+                 << setw(14) << Utils::formatCurrency(entries[i].usage.revenue) << "\n";
+        }
+        cout << "\n";
+    };
+    
+    printTable("Top Rooms - All Time", database.getTopRooms(TOP_ROOMS));
+    printTable("Top Rooms - Last 90 Nights",
+               database.getTopRooms(TOP_ROOMS, Calendar::fromEpochDay(today - 89), Calendar::fromEpochDay(today)));
+    
+    cout << "Room-Nights by Room Type:\n";
+    for (const auto& entry : database.getPopularRooms()) {
+        cout << "  " << left << setw(14) << entry.first << right << setw(8) << entry.second << "\n";
+    }
+    Utils::pressEnterToContinue();
+}
+
+void Hotel::generatePaceReport() {
+    Utils::clearScreen();
+    cout << "\n╔════════════════════════════════════════╗\n";
+    cout << "║       BOOKING PACE FORECAST            ║\n";
+    cout << "╚════════════════════════════════════════╝\n\n";
+    
+    const int HORIZON = 90;
+    PaceForecast pace = database.getPaceForecast(HORIZON);
+    int today = pace.getToday();
+    
+    auto printRow = [](const string& label, const PaceNight& night) {
+        double variance = night.sameTimeLastYear > 0
+            ? 100.0 * (night.onTheBooks - night.sameTimeLastYear) / night.sameTimeLastYear : 0.0;
+        cout << left << setw(14) << label << right
+             << setw(8) << night.onTheBooks
+             << setw(8) << night.sameTimeLastYear
+             << setw(8) << fixed << setprecision(1) << variance << "%"
+             << setw(9) << night.lastYearFinal
+             << setw(10) << setprecision(0) << night.forecast
+             << setw(9) << setprecision(1) << night.forecastOccupancy() << "%\n";
+    };
+    auto printHeader = [](const string& label) {
+        cout << left << setw(14) << label << right << setw(8) << "OTB" << setw(8) << "STLY"
+             << setw(9) << "Pace" << setw(9) << "LY Final" << setw(10) << "Forecast"
+             << setw(10) << "Occupancy" << "\n";
+        cout << string(68, '-') << "\n";
+    };
+    
+    // On the books versus the same point last year, over the next 30/60/90 nights
+    for (int days : {30, 60, 90}) {
+        cout << "Next " << days << " Nights:\n";
+        printHeader("Room Type");
+        for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+            RoomType type = static_cast<RoomType>(t);
+            printRow(Utils::roomTypeToString(type), pace.getPeriod(type, today, today + days - 1));
+        }
+        cout << string(68, '-') << "\n";
+        printRow("All Rooms", pace.getPeriod(today, today + days - 1));
+        cout << "\n";
+    }
+    
+    cout << "Weekly Outlook:\n";
+    printHeader("Week Of");
+    for (int start = today; start < today + HORIZON; start += 7) {
+        int end = min(start + 6, today + HORIZON - 1);
+        printRow(Utils::formatDate(Calendar::fromEpochDay(start)), pace.getPeriod(start, end));
+    }
+    Utils::pressEnterToContinue();
+}
+
+void Hotel::exportReports() {
+    Utils::clearScreen();
+    cout << "\n╔════════════════════════════════════════╗\n";
+    cout << "║          EXPORT REPORTS                ║\n";
+    cout << "╚════════════════════════════════════════╝\n\n";
+    
+    cout << "1. CSV (comma separated)\n";
+    cout << "2. TSV (tab separated)\n";
+    int choice = Utils::getIntegerInput("Select format (1-2): ", 1, 2);
+    ExportFormat format = choice == 2 ? EXPORT_TSV : EXPORT_CSV;
+    
+    try {
+        vector<ExportResult> results = database.exportAll(format);
+        cout << "\n" << left << setw(50) << "File" << right << setw(10) << "Rows" << "\n";
+        cout << string(60, '-') << "\n";
+        for (const auto& result : results) {
+            cout << left << setw(50) << result.path << right << setw(10) << result.rows << "\n";
+        }
+        Utils::showMessage("Reports exported successfully!", 's');
+    } catch (const HotelException& e) {
+        Utils::showMessage(e.what(), 'e');
+    }
     Utils::pressEnterToContinue();
 }
 
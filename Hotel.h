@@ -2,7 +2,9 @@
 #define HOTEL_H
 
 #include "Database.h"
+#include "Scheduler.h"
 #include <string>
+#include <atomic>
 
 class Hotel {
 private:
@@ -12,8 +14,13 @@ private:
     string hotelContact;
     string hotelEmail;
     
-    // Current logged in employee
-    Employee* currentEmployee;
+    // Current logged in employee, copied at login
+    optional<Employee> currentEmployee;
+    atomic<bool> sessionExpired;    // Set by the session timer, acted on at the main menu
+    
+    // Autosave, backups, no-shows and the session timer. Declared last so
+    // it stops before anything its jobs touch is destroyed.
+    Scheduler scheduler;
     
     // Main menu functions
     void showMainMenu();
@@ -38,6 +45,8 @@ private:
     void searchRoom();
     void updateRoomStatus();
     void modifyRoomDetails();
+    void setRoomRates();
+    void findCheapestRoom();
     
     void addNewCustomer();
     void searchCustomer();
@@ -50,6 +59,11 @@ private:
     void cancelReservation();
     void processCheckIn();
     void processCheckOut();
+    void optimizeRoomAssignments();
+    void manageGroupBookings();
+    void manageWaitlist();
+    vector<GroupRoomRequest> readGroupRequest();
+    time_t readDate(const string& prompt);
     
     void addNewEmployee();
     void searchEmployee();
@@ -64,6 +78,13 @@ private:
     void generateRevenueReport();
     void generateOccupancyReport();
     void generateCustomerReport();
+    void generatePopularRoomsReport();
+    void generatePaceReport();
+    void exportReports();
+    
+    // Background jobs
+    void startBackgroundJobs();
+    void watchSession();
     
     // Utility functions
     void login();
@@ -71,6 +92,9 @@ private:
     bool isAdmin() const;
     bool isManager() const;
     void saveAndExit();
+    void runNightAudit();
+    void viewAuditTrail();
+    void showAuditEntries(const vector<AuditEntry>& entries);
     
 public:
     Hotel();
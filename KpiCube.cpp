@@ -0,0 +1,232 @@
+#include "KpiCube.h"
+#include <algorithm>
+
+// ==================== KPI SLICE ====================
+double KpiSlice::categoryRevenue(RevenueCategory category) const {
+    double sum = 0.0;
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) sum += revenue[t][category];
+    return sum;
+}
+
+double KpiSlice::typeRevenue(int typeSlot) const {
+    double sum = 0.0;
+    for (int c = 0; c < REVENUE_CATEGORY_COUNT; c++) sum += revenue[typeSlot][c];
+    return sum;
+}
+
+double KpiSlice::totalRevenue() const {
+    double sum = 0.0;
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) sum += typeRevenue(t);
+    return sum;
+}
+
+OccupancySummary KpiSlice::allRooms() const {
+    OccupancySummary summary;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) summary += rooms[t];
+    return summary;
+}
+
+KpiSlice& KpiSlice::operator+=(const KpiSlice& other) {
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) {
+        for (int c = 0; c < REVENUE_CATEGORY_COUNT; c++) {
+            revenue[t][c] += other.revenue[t][c];
+        }
+        rooms[t] += other.rooms[t];
+    }
+    payments += other.payments;
+    return *this;
+}
+
+// ==================== CONSTRUCTOR ====================
+KpiCube::KpiCube() {
+    clear();
+}
+
+void KpiCube::clear() {
+    firstDay = 0;
+    days.clear();
+    firstMonth = 0;
+    months.clear();
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) {
+        for (int c = 0; c < REVENUE_CATEGORY_COUNT; c++) openCharges[t][c] = 0.0;
+        inventory[t] = 0;
+    }
+}
+
+// ==================== STORAGE ====================
+KpiSlice& KpiCube::daySlot(int epochDay) {
+    if (days.empty()) {
+        firstDay = epochDay;
+        days.resize(1);
+    } else if (epochDay < firstDay) {
+        days.insert(days.begin(), firstDay - epochDay, KpiSlice());
+        firstDay = epochDay;
+    } else if (epochDay - firstDay >= static_cast<int>(days.size())) {
+        days.resize(epochDay - firstDay + 1);
+    }
+    return days[epochDay - firstDay];
+}
+
+KpiSlice& KpiCube::monthSlot(int month) {
+    if (months.empty()) {
+        firstMonth = month;
+        months.resize(1);
+    } else if (month < firstMonth) {
+        months.insert(months.begin(), firstMonth - month, KpiSlice());
+        firstMonth = month;
+    } else if (month - firstMonth >= static_cast<int>(months.size())) {
+        months.resize(month - firstMonth + 1);
+    }
+    return months[month - firstMonth];
+}
+
+int KpiCube::monthIndex(int epochDay) {
+    Calendar::CivilDate date = Calendar::civilFromDays(epochDay);
+    return date.year * 12 + date.month - 1;
+}
+
+int KpiCube::monthStart(int month) {
+    return Calendar::daysFromCivil(month / 12, month % 12 + 1, 1);
+}
+
+// ==================== UPDATES ====================
+void KpiCube::trackRoom(RoomType type, int delta) {
+    if (type < STANDARD || type > PRESIDENTIAL) return;
+    inventory[type] += delta;
+}
+
+int KpiCube::getInventory(RoomType type) const {
+    return (type >= STANDARD && type <= PRESIDENTIAL) ? inventory[type] : 0;
+}
+
+void KpiCube::trackStay(const Reservation& reservation, RoomType type, int delta) {
+    if (reservation.isVoid()) return;
+    if (type < STANDARD || type > PRESIDENTIAL) return;
+
+    double rate = delta * reservation.getRoomRate();
+    int end = Utils::toEpochDay(reservation.getRawCheckOut());
+    for (int day = Utils::toEpochDay(reservation.getRawCheckIn()); day < end; day++) {
+        for (KpiSlice* slice : {&daySlot(day), &monthSlot(monthIndex(day))}) {
+            slice->rooms[type].roomNightsSold += delta;
+            slice->rooms[type].roomRevenue += rate;
+        }
+    }
+}
+
+void KpiCube::postCharge(int typeSlot, RevenueCategory category, double amount) {
+    if (typeSlot < 0 || typeSlot >= ROOM_TYPE_SLOTS) typeSlot = 0;
+    openCharges[typeSlot][category] += amount;
+}
+
+void KpiCube::postCharges(const Bill& bill, int typeSlot, int delta) {
+    for (const auto& item : bill.getItems()) {
+        postCharge(typeSlot, RevenueLedger::categorize(item.getDescriptionView()), delta * item.getTotal());
+    }
+}
+
+double KpiCube::getOpenCharges(int typeSlot, RevenueCategory category) const {
+    return openCharges[typeSlot][category];
+}
+
+double KpiCube::getOpenCharges() const {
+    double sum = 0.0;
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) {
+        for (int c = 0; c < REVENUE_CATEGORY_COUNT; c++) sum += openCharges[t][c];
+    }
+    return sum;
+}
+
+void KpiCube::recordPayment(const Bill& bill, int typeSlot) {
+    if (!bill.getIsPaid()) return;
+    if (typeSlot < 0 || typeSlot >= ROOM_TYPE_SLOTS) typeSlot = 0;
+
+    // Same split as RevenueLedger::recordPayment
+    double amounts[REVENUE_CATEGORY_COUNT] = {};
+    double subtotal = 0.0;
+    for (const auto& item : bill.getItems()) {
+        amounts[RevenueLedger::categorize(item.getDescriptionView())] += item.getTotal();
+        subtotal += item.getTotal();
+    }
+    double factor = subtotal != 0.0 ? bill.calculateTotal() / subtotal : 1.0;
+
+    int day = Utils::localEpochDay(bill.getRawPaymentDate());
+    for (KpiSlice* slice : {&daySlot(day), &monthSlot(monthIndex(day))}) {
+        for (int c = 0; c < REVENUE_CATEGORY_COUNT; c++) {
+            slice->revenue[typeSlot][c] += amounts[c] * factor;
+        }
+        slice->payments++;
+    }
+}
+
+// ==================== QUERIES ====================
+// Whole months inside the range come from the month level, the rest from days
+KpiSlice KpiCube::sumRange(int fromDay, int toDay) const {
+    KpiSlice result;
+    if (days.empty()) return result;
+
+    fromDay = max(fromDay, firstDay);
+    toDay = min(toDay, firstDay + static_cast<int>(days.size()) - 1);
+    for (int day = fromDay; day <= toDay;) {
+        int month = monthIndex(day);
+        int nextMonth = monthStart(month + 1);
+        if (day == monthStart(month) && nextMonth - 1 <= toDay) {
+            result += months[month - firstMonth];
+            day = nextMonth;
+        } else {
+            result += days[day - firstDay];
+            day++;
+        }
+    }
+    return result;
+}
+
+KpiSlice KpiCube::getDay(int epochDay) const {
+    return getPeriod(epochDay, epochDay);
+}
+
+long long KpiCube::getRoomsSold(RoomType type, int epochDay) const {
+    if (type < STANDARD || type > PRESIDENTIAL) return 0;
+    if (days.empty() || epochDay < firstDay || epochDay - firstDay >= static_cast<int>(days.size())) return 0;
+    return days[epochDay - firstDay].rooms[type].roomNightsSold;
+}
+
+KpiSlice KpiCube::getPeriod(int fromDay, int toDay) const {
+    if (fromDay > toDay) return KpiSlice();
+
+    KpiSlice slice = sumRange(fromDay, toDay);
+    long long dayCount = static_cast<long long>(toDay) - fromDay + 1;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        slice.rooms[t].roomNightsAvailable = inventory[t] * dayCount;
+    }
+    return slice;
+}
+
+KpiSlice KpiCube::getAllTime() const {
+    if (days.empty()) return KpiSlice();
+    return getPeriod(firstDay, firstDay + static_cast<int>(days.size()) - 1);
+}
+
+vector<KpiBucket> KpiCube::rollUp(int fromDay, int toDay, KpiGrain grain) const {
+    vector<KpiBucket> buckets;
+    for (int day = fromDay; day <= toDay;) {
+        int last = day;
+        switch (grain) {
+            case KPI_WEEK:
+                // weekday() counts from Sunday; weeks here end on Sunday
+                last = day + (7 - Calendar::weekday(day)) % 7;
+                break;
+            case KPI_MONTH:
+                last = monthStart(monthIndex(day) + 1) - 1;
+                break;
+            case KPI_YEAR:
+                last = Calendar::daysFromCivil(Calendar::civilFromDays(day).year + 1, 1, 1) - 1;
+                break;
+            default:
+                break;
+        }
+        last = min(last, toDay);
+        buckets.push_back({day, last, getPeriod(day, last)});
+        day = last + 1;
+    }
+    return buckets;
+}
@@ -0,0 +1,93 @@
+#ifndef KPI_CUBE_H
+#define KPI_CUBE_H
+
+#include "RevenueLedger.h"
+#include "OccupancyAnalytics.h"
+#include <vector>
+
+enum KpiGrain {
+    KPI_DAY,
+    KPI_WEEK,    // Monday to Sunday
+    KPI_MONTH,
+    KPI_YEAR
+};
+
+// The cube summed over a set of days. Revenue is indexed by room type slot
+// (0 = bill whose room is unknown) and category; room-nights and their room
+// revenue come from the stays, so ADR and RevPAR are per night stayed.
+struct KpiSlice {
+    double revenue[ROOM_TYPE_SLOTS][REVENUE_CATEGORY_COUNT] = {};
+    int payments = 0;
+    OccupancySummary rooms[ROOM_TYPE_SLOTS];
+
+    double categoryRevenue(RevenueCategory category) const;
+    double typeRevenue(int typeSlot) const;
+    double totalRevenue() const;
+    OccupancySummary allRooms() const;
+
+    KpiSlice& operator+=(const KpiSlice& other);
+};
+
+struct KpiBucket {
+    int firstDay;   // Epoch days, inclusive
+    int lastDay;
+    KpiSlice slice;
+};
+
+// Pre-aggregated revenue and room-night cube keyed by (epoch day, room type,
+// revenue category). Every payment, charge posting and stay change updates
+// its day slice and the slice of that day's calendar month, so any range
+// sums whole months from the month level and only the ragged edges from
+// days: O(cells touched), never a rescan of bills or reservations.
+//
+// Collected revenue sits on the local day of the payment, split like the
+// RevenueLedger. Charges on bills that are not paid yet have no day; they
+// are kept as open charges per type and category until the bill is paid.
+class KpiCube {
+private:
+    int firstDay;                   // Epoch day of days[0]
+    vector<KpiSlice> days;
+    int firstMonth;                 // Month index of months[0]
+    vector<KpiSlice> months;
+    double openCharges[ROOM_TYPE_SLOTS][REVENUE_CATEGORY_COUNT];
+    int inventory[ROOM_TYPE_SLOTS];
+
+    KpiSlice& daySlot(int epochDay);
+    KpiSlice& monthSlot(int monthIndex);
+    KpiSlice sumRange(int fromDay, int toDay) const;
+
+public:
+    KpiCube();
+
+    void clear();
+
+    // Rooms per type; Database calls this with -1 / +1 like its other counters
+    void trackRoom(RoomType type, int delta);
+    int getInventory(RoomType type) const;
+
+    // One night per day of [check-in day, check-out day) at the room rate.
+    // Cancelled reservations contribute nothing.
+    void trackStay(const Reservation& reservation, RoomType type, int delta);
+
+    // Charges waiting on an unpaid bill
+    void postCharge(int typeSlot, RevenueCategory category, double amount);
+    void postCharges(const Bill& bill, int typeSlot, int delta);
+    double getOpenCharges(int typeSlot, RevenueCategory category) const;
+    double getOpenCharges() const;
+
+    // Books a paid bill on its payment day, tax and discount spread pro rata
+    void recordPayment(const Bill& bill, int typeSlot);
+
+    // Queries (epoch days, inclusive). Available room-nights are filled in
+    // from the current inventory.
+    KpiSlice getDay(int epochDay) const;
+    long long getRoomsSold(RoomType type, int epochDay) const;   // One cell, no slice copy
+    KpiSlice getPeriod(int fromDay, int toDay) const;
+    KpiSlice getAllTime() const;
+    vector<KpiBucket> rollUp(int fromDay, int toDay, KpiGrain grain) const;
+
+    static int monthIndex(int epochDay);
+    static int monthStart(int monthIndex);
+};
+
+#endif // KPI_CUBE_H
@@ -0,0 +1,341 @@
+#include "Logger.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include "Utils.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+
+atomic<int> Logger::minLevel(LOG_LEVEL_INFO);
+
+namespace {
+    const size_t RING_SIZE = 1024;      // Records per thread, a power of two
+    const chrono::milliseconds FLUSH_INTERVAL(20);
+    
+    // Logging from destructors that run after the sink's is dropped
+    atomic<bool> sinkClosed(false);
+
+    // Single producer (its thread), single consumer (the flusher)
+    struct Ring {
+        LogRecord records[RING_SIZE];
+        atomic<size_t> head{0};         // Next record the thread writes
+        atomic<size_t> tail{0};         // Next record the flusher reads
+        atomic<long long> dropped{0};
+        atomic<bool> retired{false};    // Thread has exited; freed once drained
+    };
+
+    class LogSink {
+    private:
+        mutex ringsMutex;
+        vector<shared_ptr<Ring>> rings;
+        unsigned nextThread = 1;
+
+        mutex fileMutex;                // Held while a pass writes
+        ofstream file;
+        string path;
+
+        mutex flushMutex;
+        condition_variable wake;
+        condition_variable flushed;
+        unsigned long long flushRequested = 0;
+        unsigned long long flushCompleted = 0;
+        bool stopping = false;
+        thread flusher;
+
+        atomic<long long> written{0};
+        long long retiredDrops = 0;
+
+        void run();
+        void drain();
+        void openDefault();
+
+    public:
+        LogSink() : path(HotelConstants::LOG_DIR + HotelConstants::LOG_FILE) {
+            flusher = thread(&LogSink::run, this);
+        }
+
+        ~LogSink() {
+            {
+                lock_guard<mutex> lock(flushMutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            flusher.join();
+            sinkClosed = true;
+            drain();
+        }
+
+        shared_ptr<Ring> addRing(unsigned& thread) {
+            auto ring = make_shared<Ring>();
+            lock_guard<mutex> lock(ringsMutex);
+            thread = nextThread++;
+            rings.push_back(ring);
+            return ring;
+        }
+
+        void open(const string& newPath) {
+            lock_guard<mutex> lock(fileMutex);
+            ofstream opened(newPath, ios::app);
+            if (!opened.is_open()) throw LoggingException("Open", newPath);
+            file = std::move(opened);
+            path = newPath;
+        }
+
+        string getPath() {
+            lock_guard<mutex> lock(fileMutex);
+            return path;
+        }
+
+        void flush() {
+            unique_lock<mutex> lock(flushMutex);
+            unsigned long long ticket = ++flushRequested;
+            wake.notify_all();
+            flushed.wait(lock, [&]() { return flushCompleted >= ticket || stopping; });
+        }
+
+        long long getWritten() const { return written; }
+
+        long long getDropped() {
+            lock_guard<mutex> lock(ringsMutex);
+            long long dropped = retiredDrops;
+            for (const auto& ring : rings) dropped += ring->dropped;
+            return dropped;
+        }
+    };
+
+    LogSink& sink() {
+        static LogSink instance;
+        return instance;
+    }
+
+    // Marks the ring retired when its thread exits
+    struct ThreadRing {
+        shared_ptr<Ring> ring;
+        unsigned thread = 0;
+        ~ThreadRing() {
+            if (ring) ring->retired = true;
+        }
+    };
+
+    thread_local ThreadRing threadRing;
+
+    const string& levelName(int level) {
+        static const string unknown = "?";
+        switch (level) {
+            case LOG_LEVEL_DEBUG: return HotelConstants::LOG_DEBUG;
+            case LOG_LEVEL_INFO: return HotelConstants::LOG_INFO;
+            case LOG_LEVEL_WARNING: return HotelConstants::LOG_WARNING;
+            case LOG_LEVEL_ERROR: return HotelConstants::LOG_ERROR;
+            case LOG_LEVEL_AUDIT: return HotelConstants::LOG_AUDIT;
+            default: return unknown;
+        }
+    }
+
+    // "YYYY-MM-DD HH:MM:SS" is recomputed only when the second changes
+    void appendTime(string& out, long long nanos, time_t& cachedSecond, char* cachedText) {
+        time_t second = static_cast<time_t>(nanos / 1000000000);
+        if (second != cachedSecond) {
+            tm local{};
+            localtime_s(&local, &second);
+            strftime(cachedText, 20, "%Y-%m-%d %H:%M:%S", &local);
+            cachedSecond = second;
+        }
+        char micros[16];
+        snprintf(micros, sizeof(micros), ".%06lld", (nanos % 1000000000) / 1000);
+        out += cachedText;
+        out += micros;
+    }
+}
+
+// ==================== FLUSHER ====================
+void LogSink::run() {
+    unique_lock<mutex> lock(flushMutex);
+    while (!stopping) {
+        wake.wait_for(lock, FLUSH_INTERVAL, [this]() { return stopping || flushRequested > flushCompleted; });
+        if (stopping) break;
+        unsigned long long requested = flushRequested;
+        lock.unlock();
+        drain();
+        lock.lock();
+        flushCompleted = requested;
+        flushed.notify_all();
+    }
+    flushCompleted = flushRequested;
+    flushed.notify_all();
+}
+
+void LogSink::openDefault() {
+    Utils::createDirectory(HotelConstants::LOG_DIR);
+    file.open(path, ios::app);
+}
+
+// Takes whatever each ring holds, sorts it by time across threads, writes it
+// and only then hands the records back to their threads
+void LogSink::drain() {
+    vector<shared_ptr<Ring>> current;
+    {
+        lock_guard<mutex> lock(ringsMutex);
+        current = rings;
+    }
+
+    vector<const LogRecord*> pending;
+    vector<size_t> ends(current.size());
+    for (size_t r = 0; r < current.size(); r++) {
+        Ring& ring = *current[r];
+        size_t tail = ring.tail.load(memory_order_relaxed);
+        ends[r] = ring.head.load(memory_order_acquire);
+        for (size_t i = tail; i != ends[r]; i++) {
+            pending.push_back(&ring.records[i & (RING_SIZE - 1)]);
+        }
+    }
+    stable_sort(pending.begin(), pending.end(), [](const LogRecord* a, const LogRecord* b) {
+        return a->time < b->time;
+    });
+
+    if (!pending.empty()) {
+        string out;
+        out.reserve(pending.size() * 96);
+        time_t cachedSecond = 0;
+        char cachedText[20] = "";
+        for (const LogRecord* entry : pending) {
+            const LogRecord& record = *entry;
+            appendTime(out, record.time, cachedSecond, cachedText);
+            out += ' ';
+            const string& level = levelName(record.level);
+            out += level;
+            out.append(level.size() < 7 ? 8 - level.size() : 1, ' ');
+            out += "[t" + to_string(record.thread) + "] ";
+            out += Logger::formatMessage(record);
+            out += '\n';
+        }
+
+        lock_guard<mutex> lock(fileMutex);
+        if (!file.is_open()) openDefault();
+        if (file.is_open()) {
+            file << out;
+            file.flush();
+            written += static_cast<long long>(pending.size());
+        }
+    }
+
+    for (size_t r = 0; r < current.size(); r++) {
+        current[r]->tail.store(ends[r], memory_order_release);
+    }
+
+    // Rings of exited threads go once they are empty
+    lock_guard<mutex> lock(ringsMutex);
+    for (size_t r = 0; r < rings.size();) {
+        Ring& ring = *rings[r];
+        if (ring.retired && ring.tail.load() == ring.head.load()) {
+            retiredDrops += ring.dropped;
+            rings.erase(rings.begin() + r);
+        } else {
+            r++;
+        }
+    }
+}
+
+// ==================== HOT PATH ====================
+LogRecord* Logger::beginRecord() {
+    if (sinkClosed.load(memory_order_relaxed)) return nullptr;
+    if (!threadRing.ring) threadRing.ring = sink().addRing(threadRing.thread);
+    Ring& ring = *threadRing.ring;
+    size_t head = ring.head.load(memory_order_relaxed);
+    if (head - ring.tail.load(memory_order_acquire) == RING_SIZE) {
+        ring.dropped.fetch_add(1, memory_order_relaxed);
+        return nullptr;
+    }
+    LogRecord& record = ring.records[head & (RING_SIZE - 1)];
+    record.time = chrono::duration_cast<chrono::nanoseconds>(
+        chrono::system_clock::now().time_since_epoch()).count();
+    record.thread = threadRing.thread;
+    return &record;
+}
+
+void Logger::commitRecord() {
+    Ring& ring = *threadRing.ring;
+    ring.head.store(ring.head.load(memory_order_relaxed) + 1, memory_order_release);
+}
+
+// Strings past the record's text space are cut short
+void Logger::encodeText(LogRecord& record, string_view text) {
+    int slot = record.argCount++;
+    size_t room = LogRecord::TEXT_BYTES - record.textUsed;
+    size_t length = min(text.size(), room);
+    text.copy(record.text + record.textUsed, length);
+    record.kinds[slot] = LogRecord::ARG_TEXT;
+    record.values[slot].text.offset = record.textUsed;
+    record.values[slot].text.length = static_cast<uint16_t>(length);
+    record.textUsed = static_cast<uint16_t>(record.textUsed + length);
+}
+
+// ==================== FORMATTING ====================
+string Logger::formatMessage(const LogRecord& record) {
+    string out;
+    int arg = 0;
+    for (const char* p = record.format; *p; p++) {
+        if (p[0] != '{' || p[1] != '}' || arg >= record.argCount) {
+            out += *p;
+            continue;
+        }
+        char number[32];
+        switch (record.kinds[arg]) {
+            case LogRecord::ARG_INT:
+                snprintf(number, sizeof(number), "%lld", record.values[arg].i);
+                out += number;
+                break;
+            case LogRecord::ARG_UINT:
+                snprintf(number, sizeof(number), "%llu", record.values[arg].u);
+                out += number;
+                break;
+            case LogRecord::ARG_DOUBLE:
+                snprintf(number, sizeof(number), "%.2f", record.values[arg].d);
+                out += number;
+                break;
+            case LogRecord::ARG_BOOL:
+                out += record.values[arg].i ? "true" : "false";
+                break;
+            case LogRecord::ARG_TEXT:
+                out.append(record.text + record.values[arg].text.offset, record.values[arg].text.length);
+                break;
+        }
+        arg++;
+        p++;
+    }
+    return out;
+}
+
+// ==================== CONFIGURATION ====================
+void Logger::setLevel(LogLevel level) {
+    minLevel = level;
+}
+
+LogLevel Logger::getLevel() {
+    return static_cast<LogLevel>(minLevel.load());
+}
+
+void Logger::open(const string& path) {
+    sink().open(path);
+}
+
+string Logger::getPath() {
+    return sink().getPath();
+}
+
+void Logger::flush() {
+    sink().flush();
+}
+
+long long Logger::getWritten() {
+    return sink().getWritten();
+}
+
+long long Logger::getDropped() {
+    return sink().getDropped();
+}
@@ -0,0 +1,142 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+using namespace std;
+
+// Severity, lowest first. The names written are the HotelConstants LOG_*
+// strings; AUDIT is kept whatever the runtime level.
+enum LogLevel {
+    LOG_LEVEL_DEBUG = 1,
+    LOG_LEVEL_INFO = 2,
+    LOG_LEVEL_WARNING = 3,
+    LOG_LEVEL_ERROR = 4,
+    LOG_LEVEL_AUDIT = 5
+};
+
+// Calls below this level compile to nothing, e.g. /DHOTEL_LOG_MIN_LEVEL=2
+// drops debug logging from a release build
+#ifndef HOTEL_LOG_MIN_LEVEL
+#define HOTEL_LOG_MIN_LEVEL 1
+#endif
+
+// Format strings use {} for each argument, in order:
+//   HLOG_INFO("reservation.book id={} room={} total={}", id, room, total);
+// The format must be a string literal; it is formatted later, off the
+// calling thread.
+#define HOTEL_LOG(level, ...)                                                   \
+    do {                                                                        \
+        if ((level) >= HOTEL_LOG_MIN_LEVEL && Logger::isEnabled(level)) {       \
+            Logger::write((level), __VA_ARGS__);                                \
+        }                                                                       \
+    } while (0)
+
+#define HLOG_DEBUG(...) HOTEL_LOG(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define HLOG_INFO(...) HOTEL_LOG(LOG_LEVEL_INFO, __VA_ARGS__)
+#define HLOG_WARNING(...) HOTEL_LOG(LOG_LEVEL_WARNING, __VA_ARGS__)
+#define HLOG_ERROR(...) HOTEL_LOG(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define HLOG_AUDIT(...) HOTEL_LOG(LOG_LEVEL_AUDIT, __VA_ARGS__)
+
+// One log call as captured on the calling thread: the format pointer and the
+// arguments in binary, strings copied inline up to the space left
+struct LogRecord {
+    static const int MAX_ARGS = 8;
+    static const int TEXT_BYTES = 160;
+
+    enum ArgKind : uint8_t { ARG_INT, ARG_UINT, ARG_DOUBLE, ARG_BOOL, ARG_TEXT };
+
+    long long time;                 // Nanoseconds since the epoch
+    const char* format;
+    unsigned thread;                // Small id, in order of each thread's first log
+    uint8_t level;
+    uint8_t argCount;
+    uint16_t textUsed;
+    uint8_t kinds[MAX_ARGS];
+    union {
+        long long i;
+        unsigned long long u;
+        double d;
+        struct { uint16_t offset, length; } text;
+    } values[MAX_ARGS];
+    char text[TEXT_BYTES];
+};
+
+// Asynchronous logger writing LOG_DIR + LOG_FILE. Each thread fills its own
+// fixed ring of records without locks or allocation; a background thread
+// drains the rings every few milliseconds, formats the records and appends
+// them to the file in time order. A full ring drops new records rather than
+// block the caller, and counts them.
+class Logger {
+private:
+    static atomic<int> minLevel;
+
+    static LogRecord* beginRecord();    // nullptr when this thread's ring is full
+    static void commitRecord();
+    static void encodeText(LogRecord& record, string_view text);
+
+    template <class T>
+    static void encode(LogRecord& record, const T& value) {
+        if (record.argCount == LogRecord::MAX_ARGS) return;
+        int slot = record.argCount;
+        if constexpr (is_same_v<T, bool>) {
+            record.kinds[slot] = LogRecord::ARG_BOOL;
+            record.values[slot].i = value;
+        } else if constexpr (is_enum_v<T>) {
+            record.kinds[slot] = LogRecord::ARG_INT;
+            record.values[slot].i = static_cast<long long>(value);
+        } else if constexpr (is_integral_v<T> && is_signed_v<T>) {
+            record.kinds[slot] = LogRecord::ARG_INT;
+            record.values[slot].i = value;
+        } else if constexpr (is_integral_v<T>) {
+            record.kinds[slot] = LogRecord::ARG_UINT;
+            record.values[slot].u = value;
+        } else if constexpr (is_floating_point_v<T>) {
+            record.kinds[slot] = LogRecord::ARG_DOUBLE;
+            record.values[slot].d = value;
+        } else {
+            encodeText(record, string_view(value));
+            return;
+        }
+        record.argCount++;
+    }
+
+public:
+    template <class... Args>
+    static void write(LogLevel level, const char* format, const Args&... args) {
+        LogRecord* record = beginRecord();
+        if (!record) return;
+        record->format = format;
+        record->level = static_cast<uint8_t>(level);
+        record->argCount = 0;
+        record->textUsed = 0;
+        (encode(*record, args), ...);
+        commitRecord();
+    }
+
+    static bool isEnabled(LogLevel level) {
+        return level >= minLevel.load(memory_order_relaxed) || level == LOG_LEVEL_AUDIT;
+    }
+    static void setLevel(LogLevel level);
+    static LogLevel getLevel();
+
+    // Appends to path from now on. Throws LoggingException if it cannot be
+    // opened; the default file is opened on the first flush.
+    static void open(const string& path);
+    static string getPath();
+
+    // Returns once everything logged before the call is in the file
+    static void flush();
+
+    static long long getWritten();
+    static long long getDropped();
+
+    // The text a record formats to, without the time, level and thread
+    static string formatMessage(const LogRecord& record);
+};
+
+#endif // LOGGER_H
@@ -0,0 +1,177 @@
+#include "OccupancyAnalytics.h"
+#include "ThreadPool.h"
+
+// ==================== OCCUPANCY SUMMARY ====================
+double OccupancySummary::occupancyRate() const {
+    return roomNightsAvailable > 0 ? 100.0 * roomNightsSold / roomNightsAvailable : 0.0;
+}
+
+double OccupancySummary::adr() const {
+    return roomNightsSold > 0 ? roomRevenue / roomNightsSold : 0.0;
+}
+
+double OccupancySummary::revPar() const {
+    return roomNightsAvailable > 0 ? roomRevenue / roomNightsAvailable : 0.0;
+}
+
+OccupancySummary& OccupancySummary::operator+=(const OccupancySummary& other) {
+    roomNightsAvailable += other.roomNightsAvailable;
+    roomNightsSold += other.roomNightsSold;
+    roomRevenue += other.roomRevenue;
+    return *this;
+}
+
+// ==================== OCCUPANCY REPORT ====================
+OccupancyReport::OccupancyReport(int firstDay, int dayCount)
+    : firstDay(firstDay), dayCount(max(dayCount, 0)) {
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) {
+        inventory[t] = 0;
+        sold[t].assign(this->dayCount, 0);
+        revenue[t].assign(this->dayCount, 0.0);
+    }
+}
+
+int OccupancyReport::getFirstDay() const { return firstDay; }
+int OccupancyReport::getDayCount() const { return dayCount; }
+int OccupancyReport::getInventory(RoomType type) const { return inventory[type]; }
+
+OccupancySummary OccupancyReport::getNight(RoomType type, int epochDay) const {
+    OccupancySummary summary;
+    int index = epochDay - firstDay;
+    if (index < 0 || index >= dayCount) return summary;
+
+    summary.roomNightsAvailable = inventory[type];
+    summary.roomNightsSold = sold[type][index];
+    summary.roomRevenue = revenue[type][index];
+    return summary;
+}
+
+OccupancySummary OccupancyReport::getNight(int epochDay) const {
+    OccupancySummary summary;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        summary += getNight(static_cast<RoomType>(t), epochDay);
+    }
+    return summary;
+}
+
+OccupancySummary OccupancyReport::getType(RoomType type) const {
+    OccupancySummary summary;
+    summary.roomNightsAvailable = static_cast<long long>(inventory[type]) * dayCount;
+    for (int d = 0; d < dayCount; d++) {
+        summary.roomNightsSold += sold[type][d];
+        summary.roomRevenue += revenue[type][d];
+    }
+    return summary;
+}
+
+OccupancySummary OccupancyReport::getTotal() const {
+    OccupancySummary summary;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        summary += getType(static_cast<RoomType>(t));
+    }
+    return summary;
+}
+
+// ==================== ANALYTICS ====================
+namespace {
+    // A reservation clipped to the report range, as report-relative nights
+    struct Stay {
+        int first;
+        int end;     // Exclusive
+        double rate;
+    };
+
+    struct Tile {
+        int type;
+        int begin;   // Report-relative night range [begin, end)
+        int end;
+    };
+
+    // Fills one tile from a per-night difference array: each stay adds at
+    // its first night and subtracts after its last, then a prefix sum turns
+    // the deltas into nightly counts. Cost is O(stays + nights in tile).
+    void fillTile(const Tile& tile, const vector<Stay>& stays,
+                  vector<int>& sold, vector<double>& revenue) {
+        int length = tile.end - tile.begin;
+        vector<int> soldDelta(length + 1, 0);
+        vector<double> revenueDelta(length + 1, 0.0);
+
+        for (const Stay& stay : stays) {
+            int first = max(stay.first, tile.begin);
+            int end = min(stay.end, tile.end);
+            if (first >= end) continue;
+            soldDelta[first - tile.begin]++;
+            soldDelta[end - tile.begin]--;
+            revenueDelta[first - tile.begin] += stay.rate;
+            revenueDelta[end - tile.begin] -= stay.rate;
+        }
+
+        int soldRunning = 0;
+        double revenueRunning = 0.0;
+        for (int i = 0; i < length; i++) {
+            soldRunning += soldDelta[i];
+            revenueRunning += revenueDelta[i];
+            sold[tile.begin + i] = soldRunning;
+            revenue[tile.begin + i] = revenueRunning;
+        }
+    }
+}
+
+OccupancyReport OccupancyAnalytics::compute(const vector<Room>& rooms,
+                                            const vector<Reservation>& reservations,
+                                            int fromDay, int toDay, unsigned threads) {
+    OccupancyReport report(fromDay, toDay - fromDay + 1);
+    if (report.dayCount == 0) return report;
+
+    // Room number -> type, and inventory per type
+    int maxRoomNumber = 0;
+    for (const auto& room : rooms) {
+        maxRoomNumber = max(maxRoomNumber, room.getRoomNumber());
+    }
+    vector<signed char> typeByRoom(maxRoomNumber + 1, 0);
+    for (const auto& room : rooms) {
+        if (room.getRoomNumber() <= 0 || room.getType() < STANDARD || room.getType() > PRESIDENTIAL) continue;
+        typeByRoom[room.getRoomNumber()] = static_cast<signed char>(room.getType());
+        report.inventory[room.getType()]++;
+    }
+
+    // Bucket the stays that overlap the range by room type
+    vector<Stay> stays[ROOM_TYPE_SLOTS];
+    for (const auto& reservation : reservations) {
+        if (reservation.isVoid()) continue;
+        int roomNumber = reservation.getRoomNumber();
+        if (roomNumber <= 0 || roomNumber > maxRoomNumber || typeByRoom[roomNumber] == 0) continue;
+
+        int first = Utils::toEpochDay(reservation.getRawCheckIn()) - fromDay;
+        int end = Utils::toEpochDay(reservation.getRawCheckOut()) - fromDay;
+        first = max(first, 0);
+        end = min(end, report.dayCount);
+        if (first >= end) continue;
+        stays[typeByRoom[roomNumber]].push_back({first, end, reservation.getRoomRate()});
+    }
+
+    // Cut every room type into date chunks so all workers have tiles
+    ThreadPool& pool = ThreadPool::shared();
+    if (threads == 0) threads = pool.size();
+    int chunks = min(static_cast<int>(threads), report.dayCount);
+    vector<Tile> tiles;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        if (stays[t].empty()) continue;
+        for (int c = 0; c < chunks; c++) {
+            int begin = static_cast<int>(static_cast<long long>(report.dayCount) * c / chunks);
+            int end = static_cast<int>(static_cast<long long>(report.dayCount) * (c + 1) / chunks);
+            if (begin < end) tiles.push_back({t, begin, end});
+        }
+    }
+
+    // Tiles write disjoint slices of the report, so they run on the shared
+    // pool without any locking
+    pool.parallelFor(tiles.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            const Tile& tile = tiles[i];
+            fillTile(tile, stays[tile.type], report.sold[tile.type], report.revenue[tile.type]);
+        }
+    });
+
+    return report;
+}
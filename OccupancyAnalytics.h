@@ -0,0 +1,62 @@
+#ifndef OCCUPANCY_ANALYTICS_H
+#define OCCUPANCY_ANALYTICS_H
+
+#include "Room.h"
+#include "Reservation.h"
+#include <vector>
+
+// Slots indexed directly by RoomType; slot 0 is unused
+const int ROOM_TYPE_SLOTS = PRESIDENTIAL + 1;
+
+struct OccupancySummary {
+    long long roomNightsAvailable = 0;
+    long long roomNightsSold = 0;
+    double roomRevenue = 0.0;
+
+    double occupancyRate() const;   // Percent of available room-nights sold
+    double adr() const;             // Average daily rate: revenue / nights sold
+    double revPar() const;          // Revenue per available room-night
+
+    OccupancySummary& operator+=(const OccupancySummary& other);
+};
+
+// Room-nights sold and room revenue per room type and night, for the nights
+// [firstDay, firstDay + dayCount). Inventory is the number of rooms of each
+// type in the hotel, so every night of the range has the same supply.
+class OccupancyReport {
+    friend class OccupancyAnalytics;
+
+private:
+    int firstDay;
+    int dayCount;
+    int inventory[ROOM_TYPE_SLOTS];
+    vector<int> sold[ROOM_TYPE_SLOTS];
+    vector<double> revenue[ROOM_TYPE_SLOTS];
+
+public:
+    OccupancyReport(int firstDay, int dayCount);
+
+    int getFirstDay() const;
+    int getDayCount() const;
+    int getInventory(RoomType type) const;
+
+    OccupancySummary getNight(RoomType type, int epochDay) const;
+    OccupancySummary getNight(int epochDay) const;
+    OccupancySummary getType(RoomType type) const;
+    OccupancySummary getTotal() const;
+};
+
+class OccupancyAnalytics {
+public:
+    // Builds the report for the nights fromDay..toDay (epoch days, inclusive).
+    // A reservation occupies the nights [check-in day, check-out day); only
+    // cancelled reservations are left out. The range is cut into tiles of
+    // (room type, date chunk), each tile owns its slice of the output and is
+    // filled from per-night difference arrays on the shared thread pool.
+    // threads sets the date chunks per type; 0 means one per pool worker.
+    static OccupancyReport compute(const vector<Room>& rooms,
+                                   const vector<Reservation>& reservations,
+                                   int fromDay, int toDay, unsigned threads = 0);
+};
+
+#endif // OCCUPANCY_ANALYTICS_H
@@ -0,0 +1,166 @@
+#include "PaceForecast.h"
+
+// ==================== PACE NIGHT ====================
+double PaceNight::forecastOccupancy() const {
+    return inventory > 0 ? 100.0 * forecast / inventory : 0.0;
+}
+
+PaceNight& PaceNight::operator+=(const PaceNight& other) {
+    inventory += other.inventory;
+    onTheBooks += other.onTheBooks;
+    sameTimeLastYear += other.sameTimeLastYear;
+    lastYearFinal += other.lastYearFinal;
+    forecast += other.forecast;
+    return *this;
+}
+
+// ==================== CONSTRUCTOR ====================
+PaceForecast::PaceForecast(const vector<Room>& rooms, const vector<Reservation>& reservations,
+                           int today, int horizonDays)
+    : today(today),
+      firstDay(today - YEAR_OFFSET - 7 * REFERENCE_WEEKS),
+      dayCount(YEAR_OFFSET + 7 * REFERENCE_WEEKS + max(horizonDays, 1)) {
+    int maxRoomNumber = 0;
+    for (const auto& room : rooms) {
+        maxRoomNumber = max(maxRoomNumber, room.getRoomNumber());
+    }
+    vector<signed char> typeByRoom(maxRoomNumber + 1, 0);
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) inventory[t] = 0;
+    for (const auto& room : rooms) {
+        if (room.getRoomNumber() <= 0 || room.getType() < STANDARD || room.getType() > PRESIDENTIAL) continue;
+        typeByRoom[room.getRoomNumber()] = static_cast<signed char>(room.getType());
+        inventory[room.getType()]++;
+    }
+
+    const size_t rowLength = MAX_LEAD + 1;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        curves[t].assign(static_cast<size_t>(dayCount) * rowLength, 0);
+    }
+
+    // Count each booked night at its exact lead time...
+    int lastDay = getLastDay();
+    for (const auto& reservation : reservations) {
+        if (reservation.isVoid()) continue;
+        int roomNumber = reservation.getRoomNumber();
+        if (roomNumber <= 0 || roomNumber > maxRoomNumber || typeByRoom[roomNumber] == 0) continue;
+
+        int type = typeByRoom[roomNumber];
+        int bookedDay = Utils::localEpochDay(reservation.getRawBookingDate());
+        int first = max(Utils::toEpochDay(reservation.getRawCheckIn()), firstDay);
+        int end = min(Utils::toEpochDay(reservation.getRawCheckOut()), lastDay + 1);
+        for (int night = first; night < end; night++) {
+            int lead = min(max(night - bookedDay, 0), MAX_LEAD);
+            curve(type, night)[lead]++;
+        }
+    }
+
+    // ...then turn each row into "booked at least x days ahead"
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        int* row = curves[t].data();
+        for (int d = 0; d < dayCount; d++, row += rowLength) {
+            for (int x = MAX_LEAD - 1; x >= 0; x--) {
+                row[x] += row[x + 1];
+            }
+        }
+    }
+}
+
+// ==================== CURVES ====================
+bool PaceForecast::covers(int epochDay) const {
+    return epochDay >= firstDay && epochDay < firstDay + dayCount;
+}
+
+int* PaceForecast::curve(int type, int epochDay) {
+    return curves[type].data() + static_cast<size_t>(epochDay - firstDay) * (MAX_LEAD + 1);
+}
+
+const int* PaceForecast::curve(int type, int epochDay) const {
+    return curves[type].data() + static_cast<size_t>(epochDay - firstDay) * (MAX_LEAD + 1);
+}
+
+void PaceForecast::addBooking(const Reservation& reservation, RoomType type) {
+    if (reservation.isVoid()) return;
+    if (type < STANDARD || type > PRESIDENTIAL) return;
+
+    int bookedDay = Utils::localEpochDay(reservation.getRawBookingDate());
+    int first = max(Utils::toEpochDay(reservation.getRawCheckIn()), firstDay);
+    int end = min(Utils::toEpochDay(reservation.getRawCheckOut()), getLastDay() + 1);
+    for (int night = first; night < end; night++) {
+        int lead = min(max(night - bookedDay, 0), MAX_LEAD);
+        int* row = curve(type, night);
+        for (int x = 0; x <= lead; x++) {
+            row[x]++;
+        }
+    }
+}
+
+int PaceForecast::getToday() const { return today; }
+int PaceForecast::getLastDay() const { return firstDay + dayCount - 1; }
+
+int PaceForecast::getInventory(RoomType type) const {
+    return (type >= STANDARD && type <= PRESIDENTIAL) ? inventory[type] : 0;
+}
+
+int PaceForecast::getOnTheBooks(RoomType type, int epochDay, int lead) const {
+    if (type < STANDARD || type > PRESIDENTIAL || !covers(epochDay)) return 0;
+    return curve(type, epochDay)[min(max(lead, 0), MAX_LEAD)];
+}
+
+// ==================== FORECAST ====================
+PaceNight PaceForecast::getNight(RoomType type, int epochDay) const {
+    PaceNight night;
+    night.epochDay = epochDay;
+    night.inventory = getInventory(type);
+    if (night.inventory == 0 && getOnTheBooks(type, epochDay, 0) == 0) return night;
+
+    int lead = max(epochDay - today, 0);
+    int lastYear = epochDay - YEAR_OFFSET;
+    night.onTheBooks = getOnTheBooks(type, epochDay, 0);
+    night.sameTimeLastYear = getOnTheBooks(type, lastYear, lead);
+    night.lastYearFinal = getOnTheBooks(type, lastYear, 0);
+    night.forecast = night.onTheBooks;
+    if (epochDay < today) return night;   // Already happened
+
+    // Average pickup of the comparable nights that are complete
+    double pickup = 0.0;
+    int references = 0;
+    for (int week = -REFERENCE_WEEKS; week <= REFERENCE_WEEKS; week++) {
+        int reference = lastYear + 7 * week;
+        if (!covers(reference) || reference >= today) continue;
+        const int* row = curve(type, reference);
+        pickup += row[0] - row[min(lead, MAX_LEAD)];
+        references++;
+    }
+    if (references > 0) {
+        night.forecast += pickup / references;
+    }
+    night.forecast = min(night.forecast, static_cast<double>(max(night.inventory, night.onTheBooks)));
+    return night;
+}
+
+PaceNight PaceForecast::getNight(int epochDay) const {
+    PaceNight night;
+    night.epochDay = epochDay;
+    for (int t = STANDARD; t < ROOM_TYPE_SLOTS; t++) {
+        night += getNight(static_cast<RoomType>(t), epochDay);
+    }
+    return night;
+}
+
+PaceNight PaceForecast::getPeriod(RoomType type, int fromDay, int toDay) const {
+    PaceNight period;
+    period.epochDay = fromDay;
+    for (int day = fromDay; day <= toDay; day++) {
+        period += getNight(type, day);
+    }
+    return period;
+}
+
+PaceNight PaceForecast::getPeriod(int fromDay, int toDay) const {
+    PaceNight period;
+    period.epochDay = fromDay;
+    for (int day = fromDay; day <= toDay; day++) {
+        period += getNight(day);
+    }
+    return period;
+}
@@ -0,0 +1,67 @@
+#ifndef PACE_FORECAST_H
+#define PACE_FORECAST_H
+
+#include "OccupancyAnalytics.h"
+#include <vector>
+
+struct PaceNight {
+    int epochDay = 0;
+    int inventory = 0;
+    int onTheBooks = 0;         // Room-nights booked so far
+    int sameTimeLastYear = 0;   // Comparable night last year, at the same lead time
+    int lastYearFinal = 0;      // Comparable night last year, as it ended
+    double forecast = 0.0;      // Projected final room-nights
+
+    double forecastOccupancy() const;   // Percent of inventory
+    PaceNight& operator+=(const PaceNight& other);
+};
+
+// Booking curves per room type: for every stay night in the window and every
+// lead time x = 0..MAX_LEAD, the room-nights that were on the books x days
+// before that night. Each night's curve is a contiguous row of ints, so
+// building the matrix and folding a new booking in are straight loops the
+// compiler vectorizes.
+//
+// The forecast uses the pickup method. A future night at lead x is compared
+// with the same weekday 52 weeks earlier, +/- REFERENCE_WEEKS weeks; their
+// average pickup from lead x to arrival is added to what is on the books now,
+// capped at the inventory. Cancelled reservations never count, because the
+// data does not record when they were cancelled.
+class PaceForecast {
+private:
+    int today;
+    int firstDay;   // First night with a curve
+    int dayCount;
+    int inventory[ROOM_TYPE_SLOTS];
+    vector<int> curves[ROOM_TYPE_SLOTS];
+
+    int* curve(int type, int epochDay);
+    const int* curve(int type, int epochDay) const;
+    bool covers(int epochDay) const;
+
+public:
+    static const int MAX_LEAD = 365;            // Bookings made earlier count at this lead
+    static const int YEAR_OFFSET = 364;         // 52 weeks, so the weekday matches
+    static const int REFERENCE_WEEKS = 2;
+
+    // Curves cover last year's reference nights through today + horizonDays - 1
+    PaceForecast(const vector<Room>& rooms, const vector<Reservation>& reservations,
+                 int today, int horizonDays);
+
+    // Folds in one more booking, made on its booking date
+    void addBooking(const Reservation& reservation, RoomType type);
+
+    int getToday() const;
+    int getLastDay() const;
+    int getInventory(RoomType type) const;
+
+    // Room-nights for the night that were booked at least `lead` days ahead
+    int getOnTheBooks(RoomType type, int epochDay, int lead) const;
+
+    PaceNight getNight(RoomType type, int epochDay) const;
+    PaceNight getNight(int epochDay) const;
+    PaceNight getPeriod(RoomType type, int fromDay, int toDay) const;
+    PaceNight getPeriod(int fromDay, int toDay) const;
+};
+
+#endif // PACE_FORECAST_H
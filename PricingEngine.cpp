@@ -0,0 +1,159 @@
+#include "PricingEngine.h"
+#include "Constants.h"
+#include "Exceptions.h"
+
+// ==================== RULES ====================
+PricingRules PricingRules::defaults() {
+    PricingRules rules;
+    rules.bands = {
+        {0.00, 0.90},
+        {0.40, 1.00},
+        {0.70, 1.10},
+        {0.85, 1.25},
+        {0.95, 1.40}
+    };
+    rules.stayDiscounts = {
+        {7, HotelConstants::WEEKLY_DISCOUNT},
+        {30, HotelConstants::MONTHLY_DISCOUNT}
+    };
+    rules.tierDiscount[TIER_STANDARD] = 0.0;
+    rules.tierDiscount[TIER_LOYALTY] = HotelConstants::LOYALTY_DISCOUNT;
+    rules.tierDiscount[TIER_CORPORATE] = HotelConstants::CORPORATE_DISCOUNT;
+    rules.loyaltyVisits = HotelConstants::LOYALTY_MIN_VISITS;
+    return rules;
+}
+
+double RateQuote::averageRate() const {
+    return nights > 0 ? total / nights : 0.0;
+}
+
+// ==================== CONSTRUCTORS ====================
+PricingEngine::PricingEngine() : rules(PricingRules::defaults()) {
+    compile();
+}
+
+PricingEngine::PricingEngine(const PricingRules& rules) : rules(rules) {
+    compile();
+}
+
+void PricingEngine::compile() {
+    for (const auto& band : rules.bands) {
+        if (band.minOccupancy < 0.0 || band.minOccupancy > 1.0) {
+            throw ValidationException("Occupancy band must start between 0 and 1");
+        }
+        if (band.multiplier <= 0.0) throw ValidationException("Band multiplier must be positive");
+    }
+    for (const auto& tier : rules.stayDiscounts) {
+        if (tier.minNights <= 0) throw ValidationException("Stay discount needs a positive night count");
+        if (tier.discount < 0.0 || tier.discount >= 1.0) throw ValidationException("Stay discount must be in [0, 1)");
+    }
+    for (int t = 0; t < CUSTOMER_TIER_COUNT; t++) {
+        if (rules.tierDiscount[t] < 0.0 || rules.tierDiscount[t] >= 1.0) {
+            throw ValidationException("Customer discount must be in [0, 1)");
+        }
+        tierDiscount[t] = rules.tierDiscount[t];
+    }
+
+    // Occupancy below every band is charged at the base price
+    for (int step = 0; step <= OCCUPANCY_STEPS; step++) {
+        double occupancy = static_cast<double>(step) / OCCUPANCY_STEPS;
+        double best = -1.0;
+        multiplierByPermille[step] = 1.0;
+        for (const auto& band : rules.bands) {
+            if (band.minOccupancy <= occupancy + 1e-12 && band.minOccupancy > best) {
+                best = band.minOccupancy;
+                multiplierByPermille[step] = band.multiplier;
+            }
+        }
+    }
+
+    int longest = 1;
+    for (const auto& tier : rules.stayDiscounts) longest = max(longest, tier.minNights);
+    stayDiscountByNights.assign(longest + 1, 0.0);
+    for (int nights = 1; nights <= longest; nights++) {
+        int reached = 0;
+        for (const auto& tier : rules.stayDiscounts) {
+            if (tier.minNights <= nights && tier.minNights > reached) {
+                reached = tier.minNights;
+                stayDiscountByNights[nights] = tier.discount;
+            }
+        }
+    }
+}
+
+const PricingRules& PricingEngine::getRules() const { return rules; }
+
+// ==================== LOOKUPS ====================
+double PricingEngine::getMultiplier(int roomsSold, int inventory) const {
+    if (inventory <= 0) return multiplierByPermille[OCCUPANCY_STEPS];
+    long long step = static_cast<long long>(max(roomsSold, 0)) * OCCUPANCY_STEPS / inventory;
+    return multiplierByPermille[min<long long>(step, OCCUPANCY_STEPS)];
+}
+
+double PricingEngine::getStayDiscount(int nights) const {
+    if (nights <= 0) return 0.0;
+    return stayDiscountByNights[min(nights, static_cast<int>(stayDiscountByNights.size()) - 1)];
+}
+
+double PricingEngine::getCustomerDiscount(CustomerTier tier) const {
+    return (tier >= 0 && tier < CUSTOMER_TIER_COUNT) ? tierDiscount[tier] : 0.0;
+}
+
+CustomerTier PricingEngine::tierOf(const Customer& customer, bool corporate) const {
+    if (corporate) return TIER_CORPORATE;
+    if (rules.loyaltyVisits > 0 && customer.getTotalVisits() >= rules.loyaltyVisits) return TIER_LOYALTY;
+    return TIER_STANDARD;
+}
+
+// ==================== QUOTES ====================
+double PricingEngine::stayFactor(const vector<int>& soldByNight, int inventory,
+                                 const vector<double>& seasonByNight) const {
+    double factor = 0.0;
+    if (seasonByNight.empty()) {
+        for (int sold : soldByNight) {
+            factor += getMultiplier(sold, inventory);
+        }
+        return factor;
+    }
+    if (seasonByNight.size() != soldByNight.size()) {
+        throw ValidationException("Seasonal rates do not match the stay");
+    }
+    for (size_t i = 0; i < soldByNight.size(); i++) {
+        factor += seasonByNight[i] * getMultiplier(soldByNight[i], inventory);
+    }
+    return factor;
+}
+
+RateQuote PricingEngine::quote(const Room& room, const vector<int>& soldByNight, int inventory,
+                               CustomerTier tier, const vector<double>& seasonByNight) const {
+    vector<const Room*> rooms = {&room};
+    return quoteRooms(rooms, soldByNight, inventory, tier, seasonByNight).front();
+}
+
+vector<RateQuote> PricingEngine::quoteRooms(const vector<const Room*>& rooms, const vector<int>& soldByNight,
+                                            int inventory, CustomerTier tier,
+                                            const vector<double>& seasonByNight) const {
+    int nights = static_cast<int>(soldByNight.size());
+    double factor = stayFactor(soldByNight, inventory, seasonByNight);
+    double season = nights;
+    if (!seasonByNight.empty()) {
+        season = 0.0;
+        for (double night : seasonByNight) season += night;
+    }
+    double stayRate = getStayDiscount(nights);
+    double customerRate = getCustomerDiscount(tier);
+
+    vector<RateQuote> quotes(rooms.size());
+    for (size_t i = 0; i < rooms.size(); i++) {
+        RateQuote& q = quotes[i];
+        double price = rooms[i]->getPricePerNight();
+        q.roomNumber = rooms[i]->getRoomNumber();
+        q.nights = nights;
+        q.baseTotal = price * season;
+        q.occupancyTotal = price * factor;
+        q.stayDiscount = q.occupancyTotal * stayRate;
+        q.customerDiscount = (q.occupancyTotal - q.stayDiscount) * customerRate;
+        q.total = q.occupancyTotal - q.stayDiscount - q.customerDiscount;
+    }
+    return quotes;
+}
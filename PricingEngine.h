@@ -0,0 +1,87 @@
+#ifndef PRICING_ENGINE_H
+#define PRICING_ENGINE_H
+
+#include "Room.h"
+#include "Customer.h"
+#include <vector>
+
+enum CustomerTier {
+    TIER_STANDARD,
+    TIER_LOYALTY,     // Returning guest with enough visits
+    TIER_CORPORATE,
+    CUSTOMER_TIER_COUNT
+};
+
+struct OccupancyBand {
+    double minOccupancy;   // Fraction of the type's rooms already sold, 0..1
+    double multiplier;     // Applied to the room's base price
+};
+
+struct StayDiscount {
+    int minNights;
+    double discount;       // Fraction off the stay
+};
+
+struct PricingRules {
+    vector<OccupancyBand> bands;          // Any order; the highest band reached wins
+    vector<StayDiscount> stayDiscounts;   // The longest tier reached wins
+    double tierDiscount[CUSTOMER_TIER_COUNT] = {};
+    int loyaltyVisits = 0;                // 0 turns loyalty pricing off
+
+    // Occupancy bands plus the discount rates from Constants.h
+    static PricingRules defaults();
+};
+
+struct RateQuote {
+    int roomNumber = 0;
+    int nights = 0;
+    double baseTotal = 0.0;         // Base price over the nights, with seasonal rates
+    double occupancyTotal = 0.0;    // After the occupancy bands
+    double stayDiscount = 0.0;      // Amounts taken off
+    double customerDiscount = 0.0;
+    double total = 0.0;
+
+    double averageRate() const;
+};
+
+// Quotes stays from a rule set compiled into flat tables when the engine is
+// built: occupancy multipliers by per-mille sold, stay discounts by nights,
+// customer discounts by tier. A quote is one table read per night; quoting
+// every room of a type shares the per-night work, since the occupancy and
+// discounts only depend on the type, so each extra room is one multiply.
+class PricingEngine {
+private:
+    static const int OCCUPANCY_STEPS = 1000;
+
+    PricingRules rules;
+    double multiplierByPermille[OCCUPANCY_STEPS + 1];
+    vector<double> stayDiscountByNights;   // Longer stays use the last entry
+    double tierDiscount[CUSTOMER_TIER_COUNT];
+
+    void compile();
+
+public:
+    PricingEngine();
+    explicit PricingEngine(const PricingRules& rules);   // Throws ValidationException
+
+    const PricingRules& getRules() const;
+
+    double getMultiplier(int roomsSold, int inventory) const;
+    double getStayDiscount(int nights) const;
+    double getCustomerDiscount(CustomerTier tier) const;
+    CustomerTier tierOf(const Customer& customer, bool corporate) const;
+
+    // Sum of the nightly multipliers; soldByNight holds the rooms of the
+    // type already sold on each night of the stay. seasonByNight, when given,
+    // scales each night by its rate-calendar factor.
+    double stayFactor(const vector<int>& soldByNight, int inventory,
+                      const vector<double>& seasonByNight = {}) const;
+
+    RateQuote quote(const Room& room, const vector<int>& soldByNight, int inventory,
+                    CustomerTier tier, const vector<double>& seasonByNight = {}) const;
+    vector<RateQuote> quoteRooms(const vector<const Room*>& rooms, const vector<int>& soldByNight,
+                                 int inventory, CustomerTier tier,
+                                 const vector<double>& seasonByNight = {}) const;
+};
+
+#endif // PRICING_ENGINE_H
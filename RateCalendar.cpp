@@ -0,0 +1,161 @@
+#include "RateCalendar.h"
+
+// ==================== CONSTRUCTOR ====================
+RateCalendar::RateCalendar(int firstDay, int dayCount) {
+    reset(firstDay, dayCount);
+}
+
+void RateCalendar::reset(int newFirstDay, int newDayCount) {
+    firstDay = newFirstDay;
+    dayCount = max(newDayCount, 0);
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) {
+        typeFactors[t].assign(dayCount, 1.0);
+        typePrefix[t].assign(dayCount + 1, 0.0);
+        buildPrefix(typeFactors[t], typePrefix[t], 0);
+    }
+    roomOverrides.clear();
+}
+
+int RateCalendar::getFirstDay() const { return firstDay; }
+int RateCalendar::getDayCount() const { return dayCount; }
+
+// ==================== PREFIX SUMS ====================
+// Only the suffix from the first changed night needs recomputing
+void RateCalendar::buildPrefix(const vector<double>& values, vector<double>& prefix, int from) {
+    double sum = prefix[from];
+    for (size_t i = from; i < values.size(); i++) {
+        sum += values[i];
+        prefix[i + 1] = sum;
+    }
+}
+
+void RateCalendar::buildFactorPrefix(RoomOverrides& overrides, int from) const {
+    const vector<double>& factors = typeFactors[overrides.type];
+    double sum = overrides.factorPrefix[from];
+    for (int i = from; i < dayCount; i++) {
+        if (overrides.overridden[i]) sum += factors[i];
+        overrides.factorPrefix[i + 1] = sum;
+    }
+}
+
+bool RateCalendar::clip(int& fromDay, int& toDay) const {
+    fromDay = max(fromDay, firstDay);
+    toDay = min(toDay, firstDay + dayCount - 1);
+    return fromDay <= toDay;
+}
+
+int RateCalendar::coveredNights(int checkInDay, int checkOutDay) const {
+    int from = max(checkInDay, firstDay);
+    int end = min(checkOutDay, firstDay + dayCount);
+    return max(end - from, 0);
+}
+
+double RateCalendar::coveredSum(const vector<double>& prefix, int checkInDay, int checkOutDay) const {
+    int from = max(checkInDay, firstDay);
+    int end = min(checkOutDay, firstDay + dayCount);
+    if (from >= end) return 0.0;
+    return prefix[end - firstDay] - prefix[from - firstDay];
+}
+
+// ==================== UPDATES ====================
+void RateCalendar::setTypeFactor(RoomType type, int fromDay, int toDay, double factor) {
+    if (type < STANDARD || type > PRESIDENTIAL) throw ValidationException("Invalid room type");
+    if (factor <= 0) throw ValidationException("Rate factor must be positive");
+    if (fromDay > toDay) throw ValidationException("Rate period ends before it starts");
+    if (!clip(fromDay, toDay)) return;
+
+    vector<double>& factors = typeFactors[type];
+    fill(factors.begin() + (fromDay - firstDay), factors.begin() + (toDay - firstDay + 1), factor);
+    buildPrefix(factors, typePrefix[type], fromDay - firstDay);
+    for (auto& entry : roomOverrides) {
+        if (entry.second.type == type) buildFactorPrefix(entry.second, fromDay - firstDay);
+    }
+}
+
+void RateCalendar::setRoomRate(const Room& room, int fromDay, int toDay, double price) {
+    if (price <= 0) throw ValidationException("Room rate must be positive");
+    if (fromDay > toDay) throw ValidationException("Rate period ends before it starts");
+    if (!clip(fromDay, toDay)) return;
+
+    auto found = roomOverrides.find(room.getRoomNumber());
+    if (found == roomOverrides.end()) {
+        RoomOverrides overrides;
+        overrides.type = room.getType();
+        overrides.overridden.assign(dayCount, 0);
+        overrides.prices.assign(dayCount, 0.0);
+        overrides.pricePrefix.assign(dayCount + 1, 0.0);
+        overrides.factorPrefix.assign(dayCount + 1, 0.0);
+        found = roomOverrides.emplace(room.getRoomNumber(), move(overrides)).first;
+    }
+
+    RoomOverrides& overrides = found->second;
+    int from = fromDay - firstDay;
+    int to = toDay - firstDay + 1;
+    fill(overrides.overridden.begin() + from, overrides.overridden.begin() + to, 1);
+    fill(overrides.prices.begin() + from, overrides.prices.begin() + to, price);
+    buildPrefix(overrides.prices, overrides.pricePrefix, from);
+    buildFactorPrefix(overrides, from);
+}
+
+void RateCalendar::clearRoomRates(int roomNumber) {
+    roomOverrides.erase(roomNumber);
+}
+
+bool RateCalendar::hasRoomRates(int roomNumber) const {
+    return roomOverrides.count(roomNumber) > 0;
+}
+
+// ==================== QUERIES ====================
+double RateCalendar::getTypeFactor(RoomType type, int epochDay) const {
+    if (type < STANDARD || type > PRESIDENTIAL) return 1.0;
+    if (epochDay < firstDay || epochDay >= firstDay + dayCount) return 1.0;
+    return typeFactors[type][epochDay - firstDay];
+}
+
+double RateCalendar::getNightlyRate(const Room& room, int epochDay) const {
+    auto found = roomOverrides.find(room.getRoomNumber());
+    if (found != roomOverrides.end() && epochDay >= firstDay && epochDay < firstDay + dayCount &&
+        found->second.overridden[epochDay - firstDay]) {
+        return found->second.prices[epochDay - firstDay];
+    }
+    return room.getPricePerNight() * getTypeFactor(room.getType(), epochDay);
+}
+
+double RateCalendar::typeFactorSum(RoomType type, int checkInDay, int checkOutDay) const {
+    if (checkInDay >= checkOutDay) return 0.0;
+    int outside = (checkOutDay - checkInDay) - coveredNights(checkInDay, checkOutDay);
+    if (type < STANDARD || type > PRESIDENTIAL) return checkOutDay - checkInDay;
+    return coveredSum(typePrefix[type], checkInDay, checkOutDay) + outside;
+}
+
+double RateCalendar::stayCost(const Room& room, int checkInDay, int checkOutDay) const {
+    if (checkInDay >= checkOutDay) return 0.0;
+    double factors = typeFactorSum(room.getType(), checkInDay, checkOutDay);
+    auto found = roomOverrides.find(room.getRoomNumber());
+    if (found == roomOverrides.end()) return room.getPricePerNight() * factors;
+
+    // Overridden nights swap their factor-priced night for the room's own price
+    const RoomOverrides& overrides = found->second;
+    factors -= coveredSum(overrides.factorPrefix, checkInDay, checkOutDay);
+    return room.getPricePerNight() * factors + coveredSum(overrides.pricePrefix, checkInDay, checkOutDay);
+}
+
+vector<double> RateCalendar::nightlyFactors(RoomType type, int checkInDay, int checkOutDay) const {
+    vector<double> factors;
+    if (checkInDay >= checkOutDay) return factors;
+    factors.reserve(checkOutDay - checkInDay);
+    for (int day = checkInDay; day < checkOutDay; day++) {
+        factors.push_back(getTypeFactor(type, day));
+    }
+    return factors;
+}
+
+vector<double> RateCalendar::nightlyFactors(const Room& room, int checkInDay, int checkOutDay) const {
+    vector<double> factors;
+    if (checkInDay >= checkOutDay) return factors;
+    factors.reserve(checkOutDay - checkInDay);
+    for (int day = checkInDay; day < checkOutDay; day++) {
+        factors.push_back(getNightlyRate(room, day) / room.getPricePerNight());
+    }
+    return factors;
+}
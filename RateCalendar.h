@@ -0,0 +1,90 @@
+#ifndef RATE_CALENDAR_H
+#define RATE_CALENDAR_H
+
+#include "OccupancyAnalytics.h"
+#include "Serialization.h"
+#include <vector>
+#include <unordered_map>
+
+// One entered rate change, kept so the calendar can be saved and replayed.
+// roomNumber 0 sets a seasonal factor for the whole type; otherwise value is
+// that room's price per night.
+struct RatePeriod {
+    int roomNumber = 0;
+    RoomType type = STANDARD;
+    time_t fromDate = 0;   // Nights fromDate..toDate, inclusive
+    time_t toDate = 0;
+    double value = 1.0;
+};
+
+template <>
+struct Schema<RatePeriod> {
+    static constexpr auto fields = make_tuple(
+        field("roomNumber", &RatePeriod::roomNumber),
+        field("type", &RatePeriod::type),
+        field("fromDate", &RatePeriod::fromDate, FieldKind::Date),
+        field("toDate", &RatePeriod::toDate, FieldKind::Date),
+        field("value", &RatePeriod::value));
+};
+
+struct RoomStayCost {
+    int roomNumber;
+    RoomType type;
+    double total;
+};
+
+// Dense per-night rates over [firstDay, firstDay + dayCount). Each room type
+// has a seasonal factor per night applied to every room's own base price; a
+// room can also carry its own price on chosen nights, and its other nights
+// keep following the type calendar and its current base price. Both are
+// stored with prefix sums, so the cost of any stay is a few reads and
+// subtractions whatever its length. Nights outside the horizon are charged
+// at the base price.
+class RateCalendar {
+private:
+    // One room's own prices; nothing here depends on its base price
+    struct RoomOverrides {
+        RoomType type;
+        vector<char> overridden;        // 1 on nights with the room's own price
+        vector<double> prices;          // Those prices; 0 elsewhere
+        vector<double> pricePrefix;     // [i] = sum of prices before i
+        vector<double> factorPrefix;    // [i] = sum of the type factors the prices replace
+    };
+
+    int firstDay;
+    int dayCount;
+    vector<double> typeFactors[ROOM_TYPE_SLOTS];
+    vector<double> typePrefix[ROOM_TYPE_SLOTS];      // [i] = sum of nights before i
+    unordered_map<int, RoomOverrides> roomOverrides;
+
+    static void buildPrefix(const vector<double>& values, vector<double>& prefix, int from);
+    void buildFactorPrefix(RoomOverrides& overrides, int from) const;
+    bool clip(int& fromDay, int& toDay) const;
+    double coveredSum(const vector<double>& prefix, int checkInDay, int checkOutDay) const;
+    int coveredNights(int checkInDay, int checkOutDay) const;
+
+public:
+    RateCalendar(int firstDay = 0, int dayCount = 0);
+
+    // Drops every rate: factors back to 1.0, no room calendars
+    void reset(int firstDay, int dayCount);
+    int getFirstDay() const;
+    int getDayCount() const;
+
+    // Epoch days, inclusive and clipped to the horizon. Throw ValidationException.
+    void setTypeFactor(RoomType type, int fromDay, int toDay, double factor);
+    void setRoomRate(const Room& room, int fromDay, int toDay, double price);
+    void clearRoomRates(int roomNumber);
+    bool hasRoomRates(int roomNumber) const;
+
+    double getTypeFactor(RoomType type, int epochDay) const;
+    double getNightlyRate(const Room& room, int epochDay) const;
+
+    // Nights [checkInDay, checkOutDay)
+    double typeFactorSum(RoomType type, int checkInDay, int checkOutDay) const;
+    double stayCost(const Room& room, int checkInDay, int checkOutDay) const;
+    vector<double> nightlyFactors(RoomType type, int checkInDay, int checkOutDay) const;
+    vector<double> nightlyFactors(const Room& room, int checkInDay, int checkOutDay) const;   // Rate / base price
+};
+
+#endif // RATE_CALENDAR_H
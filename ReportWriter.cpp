@@ -0,0 +1,92 @@
+#include "ReportWriter.h"
+#include "Constants.h"
+#include "Utils.h"
+
+// ==================== CONSTRUCTOR / DESTRUCTOR ====================
+ReportWriter::ReportWriter(const string& path, ExportFormat format)
+    : path(path), file(path, ios::binary | ios::trunc),
+      delimiter(format == EXPORT_TSV ? '\t' : ','), rowStarted(false), rows(0) {
+    if (!file.is_open()) {
+        throw FileWriteException(path, "cannot create file");
+    }
+    buffer.reserve(FLUSH_THRESHOLD + FLUSH_THRESHOLD / 4);
+}
+
+ReportWriter::~ReportWriter() {
+    if (file.is_open()) {
+        file.write(buffer.data(), buffer.size());
+    }
+}
+
+// ==================== ROWS ====================
+void ReportWriter::separate() {
+    if (rowStarted) buffer.push_back(delimiter);
+    rowStarted = true;
+}
+
+void ReportWriter::flushIfFull() {
+    if (buffer.size() < FLUSH_THRESHOLD) return;
+    file.write(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+void ReportWriter::header(initializer_list<string_view> columns) {
+    for (string_view column : columns) {
+        cell(column);
+    }
+    buffer.push_back('\n');
+    rowStarted = false;
+}
+
+void ReportWriter::cell(string_view text) {
+    separate();
+    Serialization::detail::appendCsvText(buffer, text, delimiter);
+}
+
+void ReportWriter::cell(const char* text) {
+    cell(string_view(text));
+}
+
+void ReportWriter::cell(int value) {
+    separate();
+    Serialization::detail::appendScalar(buffer, value);
+}
+
+void ReportWriter::cell(long long value) {
+    separate();
+    Serialization::detail::appendScalar(buffer, value);
+}
+
+void ReportWriter::cell(double value) {
+    separate();
+    char text[64];
+    auto result = to_chars(text, text + sizeof(text), value, chars_format::fixed, 2);
+    buffer.append(text, result.ptr);
+}
+
+void ReportWriter::endRow() {
+    buffer.push_back('\n');
+    rowStarted = false;
+    rows++;
+    flushIfFull();
+}
+
+// ==================== CLOSE ====================
+ExportResult ReportWriter::close() {
+    file.write(buffer.data(), buffer.size());
+    buffer.clear();
+    file.close();
+    if (file.fail()) {
+        throw FileWriteException(path, "write failed");
+    }
+    return {path, rows};
+}
+
+const string& ReportWriter::getPath() const { return path; }
+size_t ReportWriter::getRowCount() const { return rows; }
+
+string ReportWriter::reportPath(const string& name, ExportFormat format) {
+    Utils::createDirectory("reports");
+    return HotelConstants::REPORT_DIR + name + "_" + Utils::formatLocalDate(time(nullptr)) +
+           (format == EXPORT_TSV ? ".tsv" : ".csv");
+}
@@ -0,0 +1,85 @@
+#ifndef REPORT_WRITER_H
+#define REPORT_WRITER_H
+
+#include "Serialization.h"
+#include <fstream>
+#include <initializer_list>
+
+enum ExportFormat {
+    EXPORT_CSV,
+    EXPORT_TSV
+};
+
+struct ExportResult {
+    string path;
+    size_t rows;
+};
+
+// Streams rows to a CSV or TSV file. Rows are formatted into one reusable
+// buffer that goes to disk in large writes whenever it passes
+// FLUSH_THRESHOLD, so memory stays constant however many rows are written.
+// Quoting follows Serialization's CSV rules with the chosen delimiter.
+class ReportWriter {
+private:
+    string path;
+    ofstream file;
+    string buffer;
+    char delimiter;
+    bool rowStarted;
+    size_t rows;
+
+    void separate();
+    void flushIfFull();
+
+public:
+    static const size_t FLUSH_THRESHOLD = 1 << 20;
+
+    // Throws FileWriteException if the file cannot be created
+    ReportWriter(const string& path, ExportFormat format);
+    ~ReportWriter();
+
+    ReportWriter(const ReportWriter&) = delete;
+    ReportWriter& operator=(const ReportWriter&) = delete;
+
+    // Free-form rows
+    void header(initializer_list<string_view> columns);
+    void cell(string_view text);
+    void cell(const char* text);
+    void cell(int value);
+    void cell(long long value);
+    void cell(double value);            // Two decimals
+    void endRow();
+
+    // Schema-backed rows; Secret fields are left out
+    template <class T>
+    void header() {
+        Serialization::appendCsvHeader<T>(buffer, delimiter);
+    }
+
+    template <class T>
+    void record(const T& row) {
+        Serialization::appendCsv(buffer, row, delimiter);
+        rows++;
+        flushIfFull();
+    }
+
+    template <class T>
+    void table(const vector<T>& rowsToWrite) {
+        header<T>();
+        for (const auto& row : rowsToWrite) {
+            record(row);
+        }
+    }
+
+    // Writes out what is buffered and closes the file; throws
+    // FileWriteException if the data did not reach the disk
+    ExportResult close();
+
+    const string& getPath() const;
+    size_t getRowCount() const;
+
+    // REPORT_DIR/<name>_<YYYY-MM-DD>.csv or .tsv, creating the directory
+    static string reportPath(const string& name, ExportFormat format);
+};
+
+#endif // REPORT_WRITER_H
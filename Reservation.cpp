@@ -5,14 +5,14 @@ Reservation::Reservation() : reservationId(0), customerId(0), roomNumber(0),
                             checkInDate(0), checkOutDate(0), numberOfGuests(1),
                             roomRate(0.0), totalAmount(0.0), paidAmount(0.0),
                             status(CONFIRMED), paymentStatus(PENDING),
-                            bookingDate(time(nullptr)) {}
+                            bookingDate(time(nullptr)), roomPinned(false) {}
 
 Reservation::Reservation(int resId, int custId, int roomNo, time_t checkIn, 
                         time_t checkOut, int guests, double rate)
     : reservationId(resId), customerId(custId), roomNumber(roomNo),
       checkInDate(checkIn), checkOutDate(checkOut), numberOfGuests(guests),
       roomRate(rate), status(CONFIRMED), paymentStatus(PENDING),
-      bookingDate(time(nullptr)) {
+      bookingDate(time(nullptr)), roomPinned(false) {
     
     if (resId <= 0) throw ValidationException("Reservation ID must be positive");
     if (custId <= 0) throw ValidationException("Customer ID must be positive");
@@ -54,9 +54,12 @@ PaymentStatus Reservation::getPaymentStatus() const { return paymentStatus; }
 string Reservation::getSpecialRequests() const { return specialRequests; }
 
 string Reservation::getBookingDate() const {
-    return Utils::formatDate(bookingDate);
+    return Utils::formatLocalDate(bookingDate);
 }
 
+time_t Reservation::getRawBookingDate() const { return bookingDate; }
+bool Reservation::isRoomPinned() const { return roomPinned; }
+
 // ==================== STATUS STRINGS ====================
 string Reservation::getStatusString() const {
     switch(status) {
@@ -64,6 +67,7 @@ string Reservation::getStatusString() const {
         case CHECKED_IN: return "Checked In";
         case CHECKED_OUT: return "Checked Out";
         case CANCELLED: return "Cancelled";
+        case NO_SHOW: return "No Show";
         default: return "Unknown";
     }
 }
@@ -100,6 +104,19 @@ void Reservation::setSpecialRequests(const string& requests) {
     specialRequests = requests;
 }
 
+void Reservation::setBookingDate(time_t date) {
+    bookingDate = date;
+}
+
+void Reservation::setRoomNumber(int roomNo) {
+    if (roomNo <= 0) throw ValidationException("Room number must be positive");
+    roomNumber = roomNo;
+}
+
+void Reservation::setRoomPinned(bool pinned) {
+    roomPinned = pinned;
+}
+
 // ==================== OPERATIONS ====================
 bool Reservation::checkIn() {
     if (status != CONFIRMED) return false;
@@ -114,11 +131,17 @@ bool Reservation::checkOut() {
 }
 
 bool Reservation::cancel() {
-    if (status == CHECKED_IN || status == CHECKED_OUT) return false;
+    if (status == CHECKED_IN || status == CHECKED_OUT || status == NO_SHOW) return false;
     status = CANCELLED;
     return true;
 }
 
+bool Reservation::markNoShow() {
+    if (status != CONFIRMED) return false;
+    status = NO_SHOW;
+    return true;
+}
+
 bool Reservation::makePayment(double amount) {
     if (amount <= 0) throw ValidationException("Payment amount must be positive");
     if (amount > getDueAmount()) throw ValidationException("Payment exceeds due amount");
@@ -135,9 +158,14 @@ bool Reservation::makePayment(double amount) {
 }
 
 bool Reservation::isActive() const {
-    time_t now = time(nullptr);
+    // In house tonight: check-in day <= today < check-out day
+    int today = Utils::getTodayEpochDay();
     return (status == CONFIRMED || status == CHECKED_IN) &&
-           now >= checkInDate && now <= checkOutDate;
+           Utils::toEpochDay(checkInDate) <= today && today < Utils::toEpochDay(checkOutDate);
+}
+
+bool Reservation::isVoid() const {
+    return status == CANCELLED || status == NO_SHOW;
 }
 
 bool Reservation::isPast() const {
@@ -191,37 +219,39 @@ void Reservation::displayBrief() const {
 // ==================== FILE OPERATIONS ====================
 void Reservation::saveToFile(ofstream& file) const {
     if (!file.is_open()) throw FileException("File is not open for writing");
-    
-    file << reservationId << " "
-         << customerId << " "
-         << roomNumber << " "
-         << checkInDate << " "
-         << checkOutDate << " "
-         << numberOfGuests << " "
-         << roomRate << " "
-         << totalAmount << " "
-         << paidAmount << " "
-         << static_cast<int>(status) << " "
-         << static_cast<int>(paymentStatus) << " "
-         << specialRequests << " "
-         << bookingDate << "\n";
+    Serialization::writeText(file, *this);
 }
 
 void Reservation::loadFromFile(ifstream& file) {
     if (!file.is_open()) throw FileException("File is not open for reading");
+    if (!Serialization::readText(file, *this)) {
+        throw FileReadException("reservations", "unexpected end of file");
+    }
+}
+
+// Eleven numeric fields, the special requests, then the booking time
+void Reservation::loadLegacyFromFile(ifstream& file) {
+    vector<string> words;
+    if (!Serialization::readLegacyWords(file, words)) throw FileReadException("reservations", "unexpected end of file");
+    if (words.size() < 12) throw FileCorruptedException("reservations", "short legacy record");
     
-    int statusInt, paymentStatusInt;
-    file >> reservationId >> customerId >> roomNumber 
-         >> checkInDate >> checkOutDate >> numberOfGuests
-         >> roomRate >> totalAmount >> paidAmount
-         >> statusInt >> paymentStatusInt;
-    
-    file.ignore();
-    getline(file, specialRequests, '|');
-    file >> bookingDate;
-    
-    status = static_cast<ReservationStatus>(statusInt);
-    paymentStatus = static_cast<PaymentStatus>(paymentStatusInt);
+    reservationId = Serialization::legacyValue<int>(words[0], "reservations");
+    customerId = Serialization::legacyValue<int>(words[1], "reservations");
+    roomNumber = Serialization::legacyValue<int>(words[2], "reservations");
+    // The first release stored local midnight; dates are UTC-midnight epoch days now
+    checkInDate = Calendar::fromEpochDay(
+        Utils::localEpochDay(Serialization::legacyValue<time_t>(words[3], "reservations")));
+    checkOutDate = Calendar::fromEpochDay(
+        Utils::localEpochDay(Serialization::legacyValue<time_t>(words[4], "reservations")));
+    numberOfGuests = Serialization::legacyValue<int>(words[5], "reservations");
+    roomRate = Serialization::legacyValue<double>(words[6], "reservations");
+    totalAmount = Serialization::legacyValue<double>(words[7], "reservations");
+    paidAmount = Serialization::legacyValue<double>(words[8], "reservations");
+    status = static_cast<ReservationStatus>(Serialization::legacyValue<int>(words[9], "reservations"));
+    paymentStatus = static_cast<PaymentStatus>(Serialization::legacyValue<int>(words[10], "reservations"));
+    specialRequests = Serialization::joinWords(words, 11, words.size() - 1);
+    bookingDate = Serialization::legacyValue<time_t>(words.back(), "reservations");
+    roomPinned = false;
 }
 
 // ==================== VALIDATION ====================
@@ -7,6 +7,8 @@
 #include <vector>
 
 class Reservation {
+    template <class T> friend struct Schema;
+    
 private:
     int reservationId;
     int customerId;
@@ -21,6 +23,7 @@ private:
     PaymentStatus paymentStatus;
     string specialRequests;
     time_t bookingDate;
+    bool roomPinned;        // Guest asked for this room; the assigner leaves it alone
     
 public:
     // Constructors
@@ -45,6 +48,8 @@ public:
     PaymentStatus getPaymentStatus() const;
     string getSpecialRequests() const;
     string getBookingDate() const;
+    time_t getRawBookingDate() const;
+    bool isRoomPinned() const;
     
     // Status strings
     string getStatusString() const;
@@ -55,13 +60,18 @@ public:
     void setGuests(int guests);
     void setRoomRate(double rate);
     void setSpecialRequests(const string& requests);
+    void setBookingDate(time_t date);   // For bookings imported with their original date
+    void setRoomNumber(int roomNo);
+    void setRoomPinned(bool pinned);
     
     // Operations
     bool checkIn();
     bool checkOut();
     bool cancel();
+    bool markNoShow();      // Only a confirmed booking can become a no-show
     bool makePayment(double amount);
     bool isActive() const;
+    bool isVoid() const;    // Cancelled or no-show: holds no nights
     bool isPast() const;
     int calculateNights() const;
     double calculateTotal() const;
@@ -73,9 +83,29 @@ public:
     // File operations
     void saveToFile(ofstream& file) const;
     void loadFromFile(ifstream& file);
+    void loadLegacyFromFile(ifstream& file);   // Space-separated files from before the schema tables
     
     // Validation
     bool isValid() const;
 };
 
+template <>
+struct Schema<Reservation> {
+    static constexpr auto fields = make_tuple(
+        field("reservationId", &Reservation::reservationId),
+        field("customerId", &Reservation::customerId),
+        field("roomNumber", &Reservation::roomNumber),
+        field("checkInDate", &Reservation::checkInDate, FieldKind::Date),
+        field("checkOutDate", &Reservation::checkOutDate, FieldKind::Date),
+        field("numberOfGuests", &Reservation::numberOfGuests),
+        field("roomRate", &Reservation::roomRate),
+        field("totalAmount", &Reservation::totalAmount),
+        field("paidAmount", &Reservation::paidAmount),
+        field("status", &Reservation::status),
+        field("paymentStatus", &Reservation::paymentStatus),
+        field("specialRequests", &Reservation::specialRequests),
+        field("bookingDate", &Reservation::bookingDate, FieldKind::Timestamp),
+        appendedField("roomPinned", &Reservation::roomPinned));
+};
+
 #endif // RESERVATION_H
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "RevenueLedger.h"
+
+// ==================== REVENUE TOTALS ====================
+double RevenueTotals::total() const {
+    double sum = 0.0;
+    for (double value : amount) sum += value;
+    return sum;
+}
+
+RevenueTotals& RevenueTotals::operator+=(const RevenueTotals& other) {
+    for (int c = 0; c < REVENUE_CATEGORY_COUNT; c++) {
+        amount[c] += other.amount[c];
+    }
+    payments += other.payments;
+    return *this;
+}
+
+// ==================== CONSTRUCTOR ====================
+RevenueLedger::RevenueLedger() : firstDay(0) {}
+
+void RevenueLedger::clear() {
+    firstDay = 0;
+    days.clear();
+    allTime = RevenueTotals();
+}
+
+// ==================== RECORDING ====================
+RevenueTotals& RevenueLedger::slotFor(int epochDay) {
+    if (days.empty()) {
+        firstDay = epochDay;
+        days.resize(1);
+    } else if (epochDay < firstDay) {
+        // Only happens when older bills are loaded after newer ones
+        days.insert(days.begin(), firstDay - epochDay, RevenueTotals());
+        firstDay = epochDay;
+    } else if (epochDay - firstDay >= static_cast<int>(days.size())) {
+        days.resize(epochDay - firstDay + 1);
+    }
+    return days[epochDay - firstDay];
+}
+
+void RevenueLedger::recordPayment(const Bill& bill) {
+    if (!bill.getIsPaid()) return;
+
+    RevenueTotals event;
+    double subtotal = 0.0;
+    for (const auto& item : bill.getItems()) {
+        event.amount[categorize(item.getDescriptionView())] += item.getTotal();
+        subtotal += item.getTotal();
+    }
+    if (subtotal != 0.0) {
+        double factor = bill.calculateTotal() / subtotal;
+        for (double& value : event.amount) value *= factor;
+    }
+    event.payments = 1;
+
+    slotFor(Utils::localEpochDay(bill.getRawPaymentDate())) += event;
+    allTime += event;
+}
+
+// ==================== QUERIES ====================
+RevenueTotals RevenueLedger::getDay(int epochDay) const {
+    int index = epochDay - firstDay;
+    if (index < 0 || index >= static_cast<int>(days.size())) return RevenueTotals();
+    return days[index];
+}
+
+RevenueTotals RevenueLedger::getPeriod(int fromDay, int toDay) const {
+    RevenueTotals result;
+    int begin = max(fromDay - firstDay, 0);
+    int end = min(toDay - firstDay + 1, static_cast<int>(days.size()));
+    for (int i = begin; i < end; i++) {
+        result += days[i];
+    }
+    return result;
+}
+
+vector<RevenueTotals> RevenueLedger::getSeries(int lastDay, int dayCount) const {
+    vector<RevenueTotals> series;
+    series.reserve(max(dayCount, 0));
+    for (int day = lastDay - dayCount + 1; day <= lastDay; day++) {
+        series.push_back(getDay(day));
+    }
+    return series;
+}
+
+const RevenueTotals& RevenueLedger::getAllTime() const {
+    return allTime;
+}
+
+// ==================== CATEGORIES ====================
+RevenueCategory RevenueLedger::categorize(string_view description) {
+    // Prefixes written by Bill::addRoomCharge and Bill::addFoodCharge
+    if (description.substr(0, 11) == "Room Charge") return REVENUE_ROOM;
+    if (description.substr(0, 7) == "Food - ") return REVENUE_FOOD;
+    return REVENUE_SERVICE;
+}
+
+string RevenueLedger::categoryToString(RevenueCategory category) {
+    switch (category) {
+        case REVENUE_ROOM: return "Room";
+        case REVENUE_FOOD: return "Food & Beverage";
+        case REVENUE_SERVICE: return "Services";
+        default: return "Unknown";
+    }
+}
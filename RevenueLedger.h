@@ -0,0 +1,55 @@
+#ifndef REVENUE_LEDGER_H
+#define REVENUE_LEDGER_H
+
+#include "Bill.h"
+#include <vector>
+
+// Revenue split used by every report
+enum RevenueCategory {
+    REVENUE_ROOM,
+    REVENUE_FOOD,      // "Food - ..." items (F&B)
+    REVENUE_SERVICE,   // "Service - ..." and any other posted charge
+    REVENUE_CATEGORY_COUNT
+};
+
+struct RevenueTotals {
+    double amount[REVENUE_CATEGORY_COUNT] = {};
+    int payments = 0;
+
+    double total() const;
+    RevenueTotals& operator+=(const RevenueTotals& other);
+};
+
+// Revenue recorded per payment event and aggregated into one slot per
+// calendar day (local date of the payment). Day slots form a dense array
+// from the earliest to the latest payment day, so a day lookup is O(1) and
+// any period total is O(days in the period), independent of bill count.
+class RevenueLedger {
+private:
+    int firstDay;                   // Epoch day of days[0]
+    vector<RevenueTotals> days;
+    RevenueTotals allTime;
+
+    RevenueTotals& slotFor(int epochDay);
+
+public:
+    RevenueLedger();
+
+    void clear();
+
+    // Posts a paid bill on the local day of its payment date. Tax and
+    // discount are spread over the categories pro rata, so the categories
+    // always add up to Bill::calculateTotal().
+    void recordPayment(const Bill& bill);
+
+    // Queries (epoch days, inclusive ranges)
+    RevenueTotals getDay(int epochDay) const;
+    RevenueTotals getPeriod(int fromDay, int toDay) const;
+    vector<RevenueTotals> getSeries(int lastDay, int dayCount) const;
+    const RevenueTotals& getAllTime() const;
+
+    static RevenueCategory categorize(string_view description);
+    static string categoryToString(RevenueCategory category);
+};
+
+#endif // REVENUE_LEDGER_H
@@ -97,37 +97,31 @@ void Room::displayBrief() const {
 // ==================== FILE OPERATIONS ====================
 void Room::saveToFile(ofstream& file) const {
     if (!file.is_open()) throw FileException("File is not open for writing");
-    
-    file << roomNumber << " "
-         << static_cast<int>(type) << " "
-         << static_cast<int>(status) << " "
-         << pricePerNight << " "
-         << capacity << " "
-         << features.size() << " ";
-    
-    for (const auto& feature : features) {
-        file << feature << " ";
-    }
-    file << "\n";
+    Serialization::writeText(file, *this);
 }
 
 void Room::loadFromFile(ifstream& file) {
     if (!file.is_open()) throw FileException("File is not open for reading");
-    
-    int typeInt, statusInt, featureCount;
-    file >> roomNumber >> typeInt >> statusInt >> pricePerNight >> capacity >> featureCount;
-    
-    type = static_cast<RoomType>(typeInt);
-    status = static_cast<RoomStatus>(statusInt);
-    
-    features.clear();
-    for (int i = 0; i < featureCount; i++) {
-        string feature;
-        file >> feature;
-        features.push_back(feature);
+    if (!Serialization::readText(file, *this)) {
+        throw FileReadException("rooms", "unexpected end of file");
     }
 }
 
+// number type status price capacity featureCount features... Features were
+// written space-separated, so a multi-word feature comes back word by word.
+void Room::loadLegacyFromFile(ifstream& file) {
+    vector<string> words;
+    if (!Serialization::readLegacyWords(file, words)) throw FileReadException("rooms", "unexpected end of file");
+    if (words.size() < 6) throw FileCorruptedException("rooms", "short legacy record");
+    
+    roomNumber = Serialization::legacyValue<int>(words[0], "rooms");
+    type = static_cast<RoomType>(Serialization::legacyValue<int>(words[1], "rooms"));
+    status = static_cast<RoomStatus>(Serialization::legacyValue<int>(words[2], "rooms"));
+    pricePerNight = Serialization::legacyValue<double>(words[3], "rooms");
+    capacity = Serialization::legacyValue<int>(words[4], "rooms");
+    features.assign(words.begin() + 6, words.end());
+}
+
 // ==================== VALIDATION ====================
 bool Room::isValid() const {
     return roomNumber > 0 && pricePerNight > 0 && capacity > 0;
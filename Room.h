@@ -2,9 +2,12 @@
 #define ROOM_H
 
 #include "Utils.h"
+#include "Serialization.h"
 #include <vector>
 
 class Room {
+    template <class T> friend struct Schema;
+    
 private:
     int roomNumber;
     RoomType type;
@@ -47,9 +50,21 @@ public:
     // File operations
     void saveToFile(ofstream& file) const;
     void loadFromFile(ifstream& file);
+    void loadLegacyFromFile(ifstream& file);   // Space-separated files from before the schema tables
     
     // Validation
     bool isValid() const;
 };
 
+template <>
+struct Schema<Room> {
+    static constexpr auto fields = make_tuple(
+        field("roomNumber", &Room::roomNumber),
+        field("type", &Room::type),
+        field("status", &Room::status),
+        field("pricePerNight", &Room::pricePerNight),
+        field("capacity", &Room::capacity),
+        field("features", &Room::features));
+};
+
 #endif // ROOM_H
\ No newline at end of file
@@ -0,0 +1,304 @@
+#include "RoomAssigner.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace {
+    struct Stay {
+        int first;      // Nights [first, end)
+        int end;
+        int index;      // Into the reservations
+        bool movable;
+    };
+
+    struct RoomLine {
+        int roomNumber;
+        int capacity;
+        bool accepts;   // Can take moved stays; rooms in maintenance cannot
+        vector<Stay> stays;   // Sorted by first night
+    };
+
+    struct Placement {
+        int line = -1;
+        int pos = 0;
+        int cost = 0;
+    };
+
+    const int NO_NEIGHBOUR = 1 << 20;
+    const int IMPROVEMENT_PASSES = 4;
+
+    int gapCost(int gap, int minGap) {
+        return (gap > 0 && gap < minGap) ? gap : 0;
+    }
+
+    size_t lowerPosition(const RoomLine& line, int first) {
+        return lower_bound(line.stays.begin(), line.stays.end(), first,
+                           [](const Stay& stay, int day) { return stay.first < day; }) - line.stays.begin();
+    }
+
+    // Where [first, end) fits in the room, or -1 if it overlaps a stay
+    int freeSlot(const RoomLine& line, int first, int end) {
+        size_t pos = lowerPosition(line, first);
+        if (pos < line.stays.size() && line.stays[pos].first < end) return -1;
+        if (pos > 0 && line.stays[pos - 1].end > first) return -1;
+        return static_cast<int>(pos);
+    }
+
+    // Orphan nights added by putting [first, end) at pos
+    int insertCost(const RoomLine& line, int pos, int first, int end, int minGap) {
+        bool hasPrev = pos > 0;
+        bool hasNext = pos < static_cast<int>(line.stays.size());
+        int before = (hasPrev && hasNext) ? gapCost(line.stays[pos].first - line.stays[pos - 1].end, minGap) : 0;
+        int after = (hasPrev ? gapCost(first - line.stays[pos - 1].end, minGap) : 0) +
+                    (hasNext ? gapCost(line.stays[pos].first - end, minGap) : 0);
+        return after - before;
+    }
+
+    // Orphan nights saved by taking the stay at pos out of the room
+    int removalCost(const RoomLine& line, int pos, int minGap) {
+        bool hasPrev = pos > 0;
+        bool hasNext = pos + 1 < static_cast<int>(line.stays.size());
+        const Stay& stay = line.stays[pos];
+        int with = (hasPrev ? gapCost(stay.first - line.stays[pos - 1].end, minGap) : 0) +
+                   (hasNext ? gapCost(line.stays[pos + 1].first - stay.end, minGap) : 0);
+        int without = (hasPrev && hasNext) ? gapCost(line.stays[pos + 1].first - line.stays[pos - 1].end, minGap) : 0;
+        return without - with;
+    }
+
+    int orphanNights(const vector<RoomLine>& lines, int minGap) {
+        int total = 0;
+        for (const auto& line : lines) {
+            for (size_t i = 1; i < line.stays.size(); i++) {
+                total += gapCost(line.stays[i].first - line.stays[i - 1].end, minGap);
+            }
+        }
+        return total;
+    }
+
+    void insertSorted(RoomLine& line, const Stay& stay) {
+        auto pos = upper_bound(line.stays.begin(), line.stays.end(), stay.first,
+                               [](int day, const Stay& other) { return day < other.first; });
+        line.stays.insert(pos, stay);
+    }
+
+    // Best free slot for the stay: fewest orphan nights added, then its own
+    // room, then the room whose previous stay ends closest before arrival
+    Placement bestSlot(const vector<RoomLine>& lines, const Stay& stay, int guests, int ownRoom,
+                       int skipLine, int minGap) {
+        Placement best;
+        int bestFit = 0;
+        bool bestOwn = false;
+        for (int l = 0; l < static_cast<int>(lines.size()); l++) {
+            const RoomLine& line = lines[l];
+            if (l == skipLine || !line.accepts || line.capacity < guests) continue;
+            int pos = freeSlot(line, stay.first, stay.end);
+            if (pos < 0) continue;
+
+            int cost = insertCost(line, pos, stay.first, stay.end, minGap);
+            int fit = pos > 0 ? stay.first - line.stays[pos - 1].end : NO_NEIGHBOUR;
+            bool own = line.roomNumber == ownRoom;
+            if (best.line < 0 || cost < best.cost ||
+                (cost == best.cost && (own > bestOwn || (own == bestOwn && fit < bestFit)))) {
+                best.line = l;
+                best.pos = pos;
+                best.cost = cost;
+                bestFit = fit;
+                bestOwn = own;
+            }
+        }
+        return best;
+    }
+
+    class TypeSolver {
+    private:
+        vector<RoomLine>& lines;
+        const vector<Reservation>& reservations;
+        int minGap;
+
+        int guestsOf(const Stay& stay) const {
+            return reservations[stay.index].getNumberOfGuests();
+        }
+        int ownRoomOf(const Stay& stay) const {
+            return reservations[stay.index].getRoomNumber();
+        }
+
+        // Clears one room of the movable stays in the way, rehoming each of
+        // them elsewhere; undone if any of them has nowhere to go
+        bool repair(const Stay& stay) {
+            for (int l = 0; l < static_cast<int>(lines.size()); l++) {
+                RoomLine& line = lines[l];
+                if (!line.accepts || line.capacity < guestsOf(stay)) continue;
+
+                vector<Stay> blockers;
+                bool blockedByFixed = false;
+                for (const auto& other : line.stays) {
+                    if (other.first < stay.end && stay.first < other.end) {
+                        if (!other.movable) blockedByFixed = true;
+                        blockers.push_back(other);
+                    }
+                }
+                if (blockedByFixed || blockers.empty()) continue;
+
+                vector<Stay> kept;
+                for (const auto& other : line.stays) {
+                    if (!(other.first < stay.end && stay.first < other.end)) kept.push_back(other);
+                }
+                vector<Stay> original = line.stays;
+                line.stays = kept;
+                insertSorted(line, stay);
+
+                vector<pair<int, int>> rehomed;   // (line, stay index)
+                bool ok = true;
+                for (const auto& blocker : blockers) {
+                    Placement slot = bestSlot(lines, blocker, guestsOf(blocker), ownRoomOf(blocker), l, minGap);
+                    if (slot.line < 0) {
+                        ok = false;
+                        break;
+                    }
+                    lines[slot.line].stays.insert(lines[slot.line].stays.begin() + slot.pos, blocker);
+                    rehomed.push_back({slot.line, blocker.index});
+                }
+                if (ok) return true;
+
+                for (const auto& moved : rehomed) {
+                    auto& stays = lines[moved.first].stays;
+                    stays.erase(find_if(stays.begin(), stays.end(),
+                                        [&moved](const Stay& s) { return s.index == moved.second; }));
+                }
+                line.stays = original;
+            }
+            return false;
+        }
+
+        // One pass of single-stay moves that lower the orphan count
+        bool improve() {
+            bool changed = false;
+            for (int l = 0; l < static_cast<int>(lines.size()); l++) {
+                for (int pos = 0; pos < static_cast<int>(lines[l].stays.size()); pos++) {
+                    Stay stay = lines[l].stays[pos];
+                    if (!stay.movable) continue;
+                    int removal = removalCost(lines[l], pos, minGap);
+                    if (removal >= 0) continue;   // Not next to an orphan gap
+
+                    Placement slot = bestSlot(lines, stay, guestsOf(stay), ownRoomOf(stay), l, minGap);
+                    if (slot.line < 0 || removal + slot.cost >= 0) continue;
+
+                    lines[l].stays.erase(lines[l].stays.begin() + pos);
+                    lines[slot.line].stays.insert(lines[slot.line].stays.begin() + slot.pos, stay);
+                    changed = true;
+                    pos--;
+                }
+            }
+            return changed;
+        }
+
+    public:
+        TypeSolver(vector<RoomLine>& lines, const vector<Reservation>& reservations, int minGap)
+            : lines(lines), reservations(reservations), minGap(minGap) {}
+
+        // Number of arrivals left without a room; the lines are then unusable
+        int solve(vector<Stay>& movable) {
+            sort(movable.begin(), movable.end(), [](const Stay& a, const Stay& b) {
+                if (a.first != b.first) return a.first < b.first;
+                if (a.end != b.end) return a.end > b.end;
+                return a.index < b.index;
+            });
+
+            int unplaced = 0;
+            for (Stay& stay : movable) {
+                Placement slot = bestSlot(lines, stay, guestsOf(stay), ownRoomOf(stay), -1, minGap);
+                if (slot.line >= 0) {
+                    lines[slot.line].stays.insert(lines[slot.line].stays.begin() + slot.pos, stay);
+                } else if (!repair(stay)) {
+                    unplaced++;
+                }
+            }
+            if (unplaced > 0) return unplaced;
+
+            for (int pass = 0; pass < IMPROVEMENT_PASSES && improve(); pass++) {}
+            return 0;
+        }
+    };
+}
+
+AssignmentPlan RoomAssigner::plan(const vector<Room>& rooms, const vector<Reservation>& reservations,
+                                  int fromDay, int toDay, int minGap) {
+    AssignmentPlan result;
+    result.fromDay = fromDay;
+    result.toDay = toDay;
+
+    vector<RoomLine> lines[ROOM_TYPE_SLOTS];
+    unordered_map<int, int> lineByRoom[ROOM_TYPE_SLOTS];
+    unordered_map<int, RoomType> typeByRoom;
+    for (const auto& room : rooms) {
+        RoomType type = room.getType();
+        if (type < STANDARD || type > PRESIDENTIAL) continue;
+        lineByRoom[type][room.getRoomNumber()] = static_cast<int>(lines[type].size());
+        lines[type].push_back({room.getRoomNumber(), room.getCapacity(), room.getStatus() != MAINTENANCE, {}});
+        typeByRoom[room.getRoomNumber()] = type;
+    }
+
+    // Every stay still to come, in its booked room
+    vector<Stay> movable[ROOM_TYPE_SLOTS];
+    vector<RoomLine> booked[ROOM_TYPE_SLOTS];
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) booked[t] = lines[t];
+    for (size_t i = 0; i < reservations.size(); i++) {
+        const Reservation& reservation = reservations[i];
+        ReservationStatus status = reservation.getStatus();
+        if (status != CONFIRMED && status != CHECKED_IN) continue;
+
+        auto found = typeByRoom.find(reservation.getRoomNumber());
+        if (found == typeByRoom.end()) continue;
+        RoomType type = found->second;
+
+        Stay stay;
+        stay.first = Utils::toEpochDay(reservation.getRawCheckIn());
+        stay.end = Utils::toEpochDay(reservation.getRawCheckOut());
+        stay.index = static_cast<int>(i);
+        if (stay.end <= fromDay) continue;
+        stay.movable = status == CONFIRMED && !reservation.isRoomPinned() &&
+                       fromDay <= stay.first && stay.first <= toDay;
+
+        int line = lineByRoom[type].at(reservation.getRoomNumber());
+        insertSorted(booked[type][line], stay);
+        if (stay.movable) {
+            movable[type].push_back(stay);
+            result.movable++;
+        } else {
+            insertSorted(lines[type][line], stay);
+            result.fixed++;
+        }
+    }
+
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        result.orphanNightsBefore += orphanNights(booked[t], minGap);
+        if (!movable[t].empty()) {
+            TypeSolver solver(lines[t], reservations, minGap);
+            int unplaced = solver.solve(movable[t]);
+            if (unplaced > 0) {
+                // Keep the rooms as booked rather than hand back a partial plan
+                lines[t] = booked[t];
+                result.unplaced += unplaced;
+            }
+        }
+        result.orphanNightsAfter += orphanNights(lines[t], minGap);
+
+        for (const auto& line : lines[t]) {
+            for (const auto& stay : line.stays) {
+                const Reservation& reservation = reservations[stay.index];
+                if (stay.movable && reservation.getRoomNumber() != line.roomNumber) {
+                    result.moves.push_back({reservation.getReservationId(), reservation.getRoomNumber(),
+                                            line.roomNumber});
+                }
+            }
+        }
+    }
+
+    // Never hand back a plan that leaves more orphan nights than the bookings have
+    if (result.orphanNightsAfter > result.orphanNightsBefore) {
+        result.moves.clear();
+        result.orphanNightsAfter = result.orphanNightsBefore;
+    }
+    sort(result.moves.begin(), result.moves.end(),
+         [](const RoomMove& a, const RoomMove& b) { return a.reservationId < b.reservationId; });
+    return result;
+}
@@ -0,0 +1,46 @@
+#ifndef ROOM_ASSIGNER_H
+#define ROOM_ASSIGNER_H
+
+#include "Room.h"
+#include "Reservation.h"
+#include "OccupancyAnalytics.h"
+#include <vector>
+
+struct RoomMove {
+    int reservationId;
+    int fromRoom;
+    int toRoom;
+};
+
+struct AssignmentPlan {
+    int fromDay = 0;                // Arrivals fromDay..toDay may move (epoch days, inclusive)
+    int toDay = 0;
+    int movable = 0;                // Confirmed, unpinned arrivals in the window
+    int fixed = 0;                  // Pinned, checked in or arriving outside the window
+    int unplaced = 0;               // Arrivals no room could take even after repair; their type stays as booked
+    int orphanNightsBefore = 0;     // Short idle gaps between stays, summed over rooms
+    int orphanNightsAfter = 0;
+    vector<RoomMove> moves;
+};
+
+// Reassigns upcoming arrivals to rooms of the type they booked so that the
+// nights left free between stays are long enough to sell. A gap shorter than
+// minGap nights between two stays in the same room counts as orphan nights.
+//
+// Each room type is solved on its own. Fixed stays are placed first; movable
+// ones then go, in arrival order, to the free slot that adds the fewest orphan
+// nights: their own room when it does as well, otherwise packed behind the
+// stay that ends closest before arrival (best fit).
+// An arrival with no free slot is repaired by moving the movable stays that
+// block one room elsewhere. Finally, single-stay moves that lower the orphan
+// count are applied until none is left. Rooms are sorted interval lists, so a
+// placement is a binary search plus two neighbour reads.
+class RoomAssigner {
+public:
+    static const int DEFAULT_MIN_GAP = 3;
+
+    static AssignmentPlan plan(const vector<Room>& rooms, const vector<Reservation>& reservations,
+                               int fromDay, int toDay, int minGap = DEFAULT_MIN_GAP);
+};
+
+#endif // ROOM_ASSIGNER_H
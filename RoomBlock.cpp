@@ -0,0 +1,146 @@
+#include "RoomBlock.h"
+
+// ==================== CONSTRUCTORS ====================
+RoomBlock::RoomBlock() : blockId(0), customerId(0), checkInDate(0), checkOutDate(0),
+                         releaseDate(0), status(BLOCK_OPEN) {}
+
+RoomBlock::RoomBlock(int id, int custId, const string& name, time_t checkIn,
+                     time_t checkOut, time_t release)
+    : blockId(id), customerId(custId), groupName(name), checkInDate(checkIn),
+      checkOutDate(checkOut), releaseDate(release), status(BLOCK_OPEN) {
+
+    if (id <= 0) throw ValidationException("Block ID must be positive");
+    if (custId <= 0) throw ValidationException("Customer ID must be positive");
+    if (name.empty()) throw ValidationException("Group name cannot be empty");
+    if (checkIn >= checkOut) throw ValidationException("Check-out must be after check-in");
+    if (Utils::toEpochDay(release) > Utils::toEpochDay(checkIn)) {
+        throw ValidationException("Release date must not be after check-in");
+    }
+}
+
+// ==================== GETTERS ====================
+int RoomBlock::getBlockId() const { return blockId; }
+int RoomBlock::getCustomerId() const { return customerId; }
+string RoomBlock::getGroupName() const { return groupName; }
+time_t RoomBlock::getRawCheckIn() const { return checkInDate; }
+time_t RoomBlock::getRawCheckOut() const { return checkOutDate; }
+time_t RoomBlock::getRawReleaseDate() const { return releaseDate; }
+BlockStatus RoomBlock::getStatus() const { return status; }
+const vector<BlockRoom>& RoomBlock::getRooms() const { return rooms; }
+
+string RoomBlock::getStatusString() const {
+    switch(status) {
+        case BLOCK_OPEN: return "Open";
+        case BLOCK_RELEASED: return "Released";
+        case BLOCK_COMPLETED: return "Completed";
+        default: return "Unknown";
+    }
+}
+
+int RoomBlock::getHeldCount() const {
+    if (status != BLOCK_OPEN) return 0;
+    int held = 0;
+    for (const auto& room : rooms) {
+        if (room.reservationId == 0) held++;
+    }
+    return held;
+}
+
+int RoomBlock::getPickedUpCount() const {
+    int picked = 0;
+    for (const auto& room : rooms) {
+        if (room.reservationId != 0) picked++;
+    }
+    return picked;
+}
+
+bool RoomBlock::holds(int roomNumber, int firstDay, int endDay) const {
+    if (status != BLOCK_OPEN) return false;
+    if (Utils::toEpochDay(checkInDate) >= endDay || firstDay >= Utils::toEpochDay(checkOutDate)) return false;
+    for (const auto& room : rooms) {
+        if (room.roomNumber == roomNumber && room.reservationId == 0) return true;
+    }
+    return false;
+}
+
+// Rooms can still be picked up on the release date itself
+bool RoomBlock::isExpired(int todayEpochDay) const {
+    return status == BLOCK_OPEN && todayEpochDay > Utils::toEpochDay(releaseDate);
+}
+
+// ==================== OPERATIONS ====================
+void RoomBlock::hold(int roomNumber, double rate) {
+    if (roomNumber <= 0) throw ValidationException("Room number must be positive");
+    if (rate <= 0) throw ValidationException("Room rate must be positive");
+    rooms.push_back({roomNumber, rate, 0});
+}
+
+bool RoomBlock::pickUp(int roomNumber, int reservationId) {
+    if (status != BLOCK_OPEN) return false;
+    for (auto& room : rooms) {
+        if (room.roomNumber == roomNumber && room.reservationId == 0) {
+            room.reservationId = reservationId;
+            if (getHeldCount() == 0) status = BLOCK_COMPLETED;
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<int> RoomBlock::release() {
+    vector<int> released;
+    if (status != BLOCK_OPEN) return released;
+    for (const auto& room : rooms) {
+        if (room.reservationId == 0) released.push_back(room.roomNumber);
+    }
+    status = BLOCK_RELEASED;
+    return released;
+}
+
+// ==================== DISPLAY ====================
+void RoomBlock::displayBrief() const {
+    cout << "Block: " << setw(5) << blockId
+         << " | " << setw(20) << left << groupName.substr(0, 20) << right
+         << " | " << Utils::formatDate(checkInDate) << " to " << Utils::formatDate(checkOutDate)
+         << " | Release: " << Utils::formatDate(releaseDate)
+         << " | Picked up: " << getPickedUpCount() << "/" << rooms.size()
+         << " | " << getStatusString() << "\n";
+}
+
+// ==================== FILE OPERATIONS ====================
+void RoomBlock::saveToFile(ofstream& file) const {
+    if (!file.is_open()) throw FileException("File is not open for writing");
+
+    string block;
+    Serialization::appendText(block, *this);
+    block += to_string(rooms.size());
+    block.push_back('\n');
+    for (const auto& room : rooms) {
+        Serialization::appendText(block, room);
+    }
+    file.write(block.data(), static_cast<streamsize>(block.size()));
+}
+
+void RoomBlock::loadFromFile(ifstream& file) {
+    if (!file.is_open()) throw FileException("File is not open for reading");
+
+    Serialization::TextReader reader;
+    if (!Serialization::readText(file, *this, reader)) {
+        throw FileReadException("blocks", "unexpected end of file");
+    }
+
+    int roomCount = 0;
+    if (!getline(file, reader.line) || !Serialization::detail::parseScalar(string_view(reader.line), roomCount)) {
+        throw FileCorruptedException("blocks", "bad room count for block " + to_string(blockId));
+    }
+
+    rooms.clear();
+    rooms.reserve(roomCount);
+    BlockRoom room;
+    for (int i = 0; i < roomCount; i++) {
+        if (!Serialization::readText(file, room, reader)) {
+            throw FileReadException("blocks", "missing rooms for block " + to_string(blockId));
+        }
+        rooms.push_back(room);
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef ROOM_BLOCK_H
+#define ROOM_BLOCK_H
+
+#include "Utils.h"
+#include "Serialization.h"
+#include <vector>
+#include <fstream>
+
+enum BlockStatus {
+    BLOCK_OPEN = 1,
+    BLOCK_RELEASED = 2,     // Past the release date, or released by hand
+    BLOCK_COMPLETED = 3     // Every held room was picked up
+};
+
+// Rooms wanted by a group, per type, for one date range
+struct GroupRoomRequest {
+    RoomType type;
+    int rooms;
+    int guestsPerRoom;
+};
+
+// One room in a block: held until a guest picks it up
+struct BlockRoom {
+    int roomNumber = 0;
+    double rate = 0.0;          // Locked when the block was created
+    int reservationId = 0;      // 0 while the room is still held
+};
+
+template <>
+struct Schema<BlockRoom> {
+    static constexpr auto fields = make_tuple(
+        field("roomNumber", &BlockRoom::roomNumber),
+        field("rate", &BlockRoom::rate),
+        field("reservationId", &BlockRoom::reservationId));
+};
+
+// Rooms set aside for a group before the guests are named. Held rooms count
+// as taken for the block's nights; guests pick them up one at a time until
+// the release date, after which the rooms still held go back on sale.
+class RoomBlock {
+    template <class T> friend struct Schema;
+
+private:
+    int blockId;
+    int customerId;             // Organiser
+    string groupName;
+    time_t checkInDate;
+    time_t checkOutDate;
+    time_t releaseDate;         // Last day rooms can be picked up
+    BlockStatus status;
+    vector<BlockRoom> rooms;
+
+public:
+    // Constructors
+    RoomBlock();
+    RoomBlock(int id, int custId, const string& name, time_t checkIn,
+              time_t checkOut, time_t release);
+
+    // Getters
+    int getBlockId() const;
+    int getCustomerId() const;
+    string getGroupName() const;
+    time_t getRawCheckIn() const;
+    time_t getRawCheckOut() const;
+    time_t getRawReleaseDate() const;
+    BlockStatus getStatus() const;
+    string getStatusString() const;
+    const vector<BlockRoom>& getRooms() const;
+    int getHeldCount() const;
+    int getPickedUpCount() const;
+
+    // True if the block keeps this room for any of the nights [firstDay, endDay)
+    bool holds(int roomNumber, int firstDay, int endDay) const;
+    bool isExpired(int todayEpochDay) const;
+
+    // Operations
+    void hold(int roomNumber, double rate);
+    bool pickUp(int roomNumber, int reservationId);
+    vector<int> release();      // Returns the rooms that were still held
+
+    // Display
+    void displayBrief() const;
+
+    // File operations: the block record, then a count line and one BlockRoom each
+    void saveToFile(ofstream& file) const;
+    void loadFromFile(ifstream& file);
+};
+
+template <>
+struct Schema<RoomBlock> {
+    static constexpr auto fields = make_tuple(
+        field("blockId", &RoomBlock::blockId),
+        field("customerId", &RoomBlock::customerId),
+        field("groupName", &RoomBlock::groupName),
+        field("checkInDate", &RoomBlock::checkInDate, FieldKind::Date),
+        field("checkOutDate", &RoomBlock::checkOutDate, FieldKind::Date),
+        field("releaseDate", &RoomBlock::releaseDate, FieldKind::Date),
+        field("status", &RoomBlock::status));
+};
+
+#endif // ROOM_BLOCK_H
@@ -0,0 +1,136 @@
+#include "RoomPopularity.h"
+#include "ScanEngine.h"
+#include <queue>
+
+// ==================== ROOM USAGE ====================
+double RoomUsage::value(PopularityMetric metric) const {
+    switch (metric) {
+        case BY_BOOKINGS: return bookings;
+        case BY_REVENUE: return revenue;
+        default: return roomNights;
+    }
+}
+
+RoomUsage& RoomUsage::operator+=(const RoomUsage& other) {
+    bookings += other.bookings;
+    roomNights += other.roomNights;
+    revenue += other.revenue;
+    return *this;
+}
+
+// ==================== COUNTERS ====================
+void RoomPopularity::clear() {
+    usageByRoom.clear();
+}
+
+void RoomPopularity::track(const Reservation& reservation, int delta) {
+    if (reservation.isVoid()) return;
+
+    RoomUsage& usage = usageByRoom[reservation.getRoomNumber()];
+    usage.bookings += delta;
+    usage.roomNights += delta * reservation.calculateNights();
+    usage.revenue += delta * reservation.getTotalAmount();
+    if (usage.bookings == 0) {
+        usageByRoom.erase(reservation.getRoomNumber());
+    }
+}
+
+RoomUsage RoomPopularity::getUsage(int roomNumber) const {
+    auto it = usageByRoom.find(roomNumber);
+    return it != usageByRoom.end() ? it->second : RoomUsage();
+}
+
+// ==================== RANKING ====================
+vector<RoomPopularityEntry> RoomPopularity::selectTop(vector<RoomPopularityEntry> entries, int k,
+                                                      PopularityMetric metric) {
+    if (k <= 0) return {};
+
+    // Ties go to the lower room number so the ranking is stable
+    auto better = [metric](const RoomPopularityEntry& a, const RoomPopularityEntry& b) {
+        double va = a.usage.value(metric), vb = b.usage.value(metric);
+        return va != vb ? va > vb : a.roomNumber < b.roomNumber;
+    };
+
+    // Min-heap on "better": the top of the heap is the weakest of the best K
+    priority_queue<RoomPopularityEntry, vector<RoomPopularityEntry>, decltype(better)> heap(better);
+    for (auto& entry : entries) {
+        if (static_cast<int>(heap.size()) < k) {
+            heap.push(std::move(entry));
+        } else if (better(entry, heap.top())) {
+            heap.pop();
+            heap.push(std::move(entry));
+        }
+    }
+
+    vector<RoomPopularityEntry> result(heap.size());
+    for (size_t i = result.size(); i > 0; i--) {
+        result[i - 1] = heap.top();
+        heap.pop();
+    }
+    return result;
+}
+
+vector<RoomPopularityEntry> RoomPopularity::topRooms(const vector<Room>& rooms, int k,
+                                                     PopularityMetric metric) const {
+    vector<RoomPopularityEntry> entries;
+    entries.reserve(rooms.size());
+    for (const auto& room : rooms) {
+        entries.push_back({room.getRoomNumber(), room.getType(), getUsage(room.getRoomNumber())});
+    }
+    return selectTop(std::move(entries), k, metric);
+}
+
+vector<RoomPopularityEntry> RoomPopularity::usageByType(const vector<Room>& rooms) const {
+    vector<RoomPopularityEntry> byType;
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        byType.push_back({0, static_cast<RoomType>(t), RoomUsage()});
+    }
+    for (const auto& room : rooms) {
+        RoomType type = room.getType();
+        if (type < STANDARD || type > PRESIDENTIAL) continue;
+        byType[type - STANDARD].usage += getUsage(room.getRoomNumber());
+    }
+    return byType;
+}
+
+vector<RoomPopularityEntry> RoomPopularity::topRoomsInWindow(const vector<Room>& rooms,
+                                                             const vector<Reservation>& reservations,
+                                                             int fromDay, int toDay, int k,
+                                                             PopularityMetric metric) {
+    // Dense per-room-number slots; room numbers are small sequential integers
+    int maxRoomNumber = 0;
+    for (const auto& room : rooms) {
+        maxRoomNumber = max(maxRoomNumber, room.getRoomNumber());
+    }
+
+    // Each partition of reservations counts into its own slots
+    auto accumulate = [&](vector<RoomUsage>& usage, const Reservation& reservation) {
+        if (reservation.isVoid()) return;
+        int roomNumber = reservation.getRoomNumber();
+        if (roomNumber <= 0 || roomNumber > maxRoomNumber) return;
+
+        int first = max(Utils::toEpochDay(reservation.getRawCheckIn()), fromDay);
+        int end = min(Utils::toEpochDay(reservation.getRawCheckOut()), toDay + 1);
+        if (first >= end) return;
+
+        RoomUsage& slot = usage[roomNumber];
+        slot.bookings++;
+        slot.roomNights += end - first;
+        slot.revenue += (end - first) * reservation.getRoomRate();
+    };
+    auto merge = [](vector<RoomUsage>& usage, const vector<RoomUsage>& partial) {
+        for (size_t i = 0; i < usage.size(); i++) {
+            usage[i] += partial[i];
+        }
+    };
+    vector<RoomUsage> usage = ScanEngine::aggregate(reservations, vector<RoomUsage>(maxRoomNumber + 1),
+                                                    accumulate, merge);
+
+    vector<RoomPopularityEntry> entries;
+    entries.reserve(rooms.size());
+    for (const auto& room : rooms) {
+        if (room.getRoomNumber() <= 0) continue;
+        entries.push_back({room.getRoomNumber(), room.getType(), usage[room.getRoomNumber()]});
+    }
+    return selectTop(std::move(entries), k, metric);
+}
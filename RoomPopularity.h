@@ -0,0 +1,61 @@
+#ifndef ROOM_POPULARITY_H
+#define ROOM_POPULARITY_H
+
+#include "Room.h"
+#include "Reservation.h"
+#include <vector>
+#include <unordered_map>
+
+enum PopularityMetric {
+    BY_ROOM_NIGHTS,
+    BY_BOOKINGS,
+    BY_REVENUE
+};
+
+struct RoomUsage {
+    int bookings = 0;
+    int roomNights = 0;
+    double revenue = 0.0;
+
+    double value(PopularityMetric metric) const;
+    RoomUsage& operator+=(const RoomUsage& other);
+};
+
+struct RoomPopularityEntry {
+    int roomNumber;
+    RoomType type;
+    RoomUsage usage;
+};
+
+// Booking history per room. The all-time counters are kept current by
+// track(), which Database calls with -1 / +1 around every reservation
+// change, so ranking never rescans reservations. Rankings use a bounded
+// min-heap of K entries: O(N log K) over N rooms instead of a full sort.
+class RoomPopularity {
+private:
+    unordered_map<int, RoomUsage> usageByRoom;
+
+public:
+    void clear();
+
+    // Cancelled reservations contribute nothing
+    void track(const Reservation& reservation, int delta);
+    RoomUsage getUsage(int roomNumber) const;
+
+    // All-time ranking from the maintained counters
+    vector<RoomPopularityEntry> topRooms(const vector<Room>& rooms, int k,
+                                         PopularityMetric metric = BY_ROOM_NIGHTS) const;
+    vector<RoomPopularityEntry> usageByType(const vector<Room>& rooms) const;
+
+    // Ranking over the nights fromDay..toDay (epoch days, inclusive). Only the
+    // nights inside the window count; a booking counts if it has one.
+    static vector<RoomPopularityEntry> topRoomsInWindow(const vector<Room>& rooms,
+                                                        const vector<Reservation>& reservations,
+                                                        int fromDay, int toDay, int k,
+                                                        PopularityMetric metric = BY_ROOM_NIGHTS);
+
+    static vector<RoomPopularityEntry> selectTop(vector<RoomPopularityEntry> entries, int k,
+                                                 PopularityMetric metric);
+};
+
+#endif // ROOM_POPULARITY_H
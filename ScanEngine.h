@@ -0,0 +1,74 @@
+#ifndef SCAN_ENGINE_H
+#define SCAN_ENGINE_H
+
+#include "ThreadPool.h"
+#include <vector>
+#include <algorithm>
+
+// Partitioned scans over the in-memory tables. Rows are cut into contiguous
+// partitions, each partition folds into its own partial on the thread pool,
+// and the partials are merged in partition order on the calling thread, so
+// nothing is shared while scanning and results keep row order.
+namespace ScanEngine {
+    // Rows per partition never drop below this
+    const size_t MIN_PARTITION = 4096;
+
+    // A few partitions per worker so an uneven partition doesn't stall the scan
+    inline size_t partitionSize(size_t rows, const ThreadPool& pool) {
+        size_t partitions = static_cast<size_t>(pool.size()) * 4;
+        return max(MIN_PARTITION, (rows + partitions - 1) / partitions);
+    }
+
+    // accumulate(Partial&, const Row&) folds one row in;
+    // merge(Partial&, const Partial&) folds a partition's partial into the result.
+    template <class Row, class Partial, class Accumulate, class Merge>
+    Partial aggregate(const vector<Row>& rows, const Partial& identity,
+                      Accumulate accumulate, Merge merge,
+                      ThreadPool& pool = ThreadPool::shared()) {
+        size_t grain = partitionSize(rows.size(), pool);
+        vector<Partial> partials((rows.size() + grain - 1) / grain);
+
+        pool.parallelFor(rows.size(), grain, [&](size_t begin, size_t end) {
+            // Fold into a local so the partial can live in registers
+            Partial partial = identity;
+            for (size_t i = begin; i < end; i++) {
+                accumulate(partial, rows[i]);
+            }
+            partials[begin / grain] = std::move(partial);
+        });
+
+        Partial result = identity;
+        for (const auto& partial : partials) {
+            merge(result, partial);
+        }
+        return result;
+    }
+
+    // Pointers to the rows matching pred, in table order. Rows may be a
+    // const table, which yields const pointers.
+    template <class Rows, class Pred>
+    auto filter(Rows& rows, Pred pred, ThreadPool& pool = ThreadPool::shared())
+        -> vector<decltype(&rows[0])> {
+        using RowPtr = decltype(&rows[0]);
+        size_t grain = partitionSize(rows.size(), pool);
+        vector<vector<RowPtr>> partials((rows.size() + grain - 1) / grain);
+
+        pool.parallelFor(rows.size(), grain, [&](size_t begin, size_t end) {
+            vector<RowPtr>& matches = partials[begin / grain];
+            for (size_t i = begin; i < end; i++) {
+                if (pred(rows[i])) matches.push_back(&rows[i]);
+            }
+        });
+
+        size_t total = 0;
+        for (const auto& partial : partials) total += partial.size();
+        vector<RowPtr> result;
+        result.reserve(total);
+        for (const auto& partial : partials) {
+            result.insert(result.end(), partial.begin(), partial.end());
+        }
+        return result;
+    }
+}
+
+#endif // SCAN_ENGINE_H
@@ -0,0 +1,77 @@
+#include "Scheduler.h"
+#include "Exceptions.h"
+
+// ==================== CONSTRUCTOR / DESTRUCTOR ====================
+Scheduler::Scheduler(chrono::milliseconds tick)
+    : tick(max(tick, chrono::milliseconds(1))), stopping(false) {
+    worker = thread(&Scheduler::run, this);
+}
+
+Scheduler::~Scheduler() {
+    {
+        lock_guard<mutex> lock(wheelMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    worker.join();
+}
+
+// Ticks are counted from the start, so a late wake-up catches up on every
+// tick it missed instead of drifting
+void Scheduler::run() {
+    typedef chrono::steady_clock Clock;
+    Clock::time_point start = Clock::now();
+    vector<function<void()>> due;
+
+    unique_lock<mutex> lock(wheelMutex);
+    while (!stopping) {
+        Clock::time_point nextTick = start + tick * static_cast<long long>(wheel.getTick() + 1);
+        wake.wait_until(lock, nextTick, [this]() { return stopping; });
+        if (stopping) break;
+
+        unsigned long long elapsed = static_cast<unsigned long long>((Clock::now() - start) / tick);
+        if (elapsed <= wheel.getTick()) continue;
+        wheel.advance(elapsed - wheel.getTick(), due);
+        if (due.empty()) continue;
+
+        lock.unlock();
+        for (auto& task : due) {
+            try {
+                task();
+            } catch (const HotelException& e) {
+                ExceptionHandler::logException(e);
+            } catch (const exception& e) {
+                HLOG_ERROR("scheduler.task failed {}", e.what());
+            }
+        }
+        due.clear();
+        lock.lock();
+    }
+}
+
+unsigned long long Scheduler::toTicks(chrono::milliseconds delay) const {
+    if (delay.count() <= 0) return 1;
+    return static_cast<unsigned long long>((delay + tick - chrono::milliseconds(1)) / tick);
+}
+
+// ==================== SCHEDULING ====================
+TimerId Scheduler::after(chrono::milliseconds delay, function<void()> task) {
+    lock_guard<mutex> lock(wheelMutex);
+    return wheel.schedule(toTicks(delay), std::move(task));
+}
+
+TimerId Scheduler::every(chrono::milliseconds period, function<void()> task) {
+    unsigned long long ticks = toTicks(period);
+    lock_guard<mutex> lock(wheelMutex);
+    return wheel.schedule(ticks, std::move(task), ticks);
+}
+
+bool Scheduler::cancel(TimerId id) {
+    lock_guard<mutex> lock(wheelMutex);
+    return wheel.cancel(id);
+}
+
+size_t Scheduler::pending() {
+    lock_guard<mutex> lock(wheelMutex);
+    return wheel.size();
+}
@@ -0,0 +1,40 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "TimerWheel.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+// Runs tasks later or periodically on one background thread, driven by a
+// TimerWheel that advances once per tick. Times are rounded up to whole
+// ticks and counted from the last tick, so a task runs up to one tick early
+// or late. Tasks run outside the lock and may schedule or cancel others;
+// a task that throws is logged and, if periodic, keeps its schedule.
+class Scheduler {
+private:
+    TimerWheel wheel;
+    mutex wheelMutex;
+    condition_variable wake;
+    thread worker;
+    chrono::milliseconds tick;
+    bool stopping;
+
+    void run();
+    unsigned long long toTicks(chrono::milliseconds delay) const;
+
+public:
+    explicit Scheduler(chrono::milliseconds tick = chrono::milliseconds(1000));
+    ~Scheduler();
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    TimerId after(chrono::milliseconds delay, function<void()> task);
+    TimerId every(chrono::milliseconds period, function<void()> task);
+    bool cancel(TimerId id);
+    size_t pending();
+};
+
+#endif // SCHEDULER_H
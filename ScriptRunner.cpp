@@ -0,0 +1,89 @@
+#include "ScriptRunner.h"
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <unordered_map>
+
+namespace {
+    typedef chrono::high_resolution_clock Clock;
+
+    double secondsSince(Clock::time_point start) {
+        return chrono::duration<double>(Clock::now() - start).count();
+    }
+}
+
+// ==================== CONSTRUCTOR ====================
+ScriptRunner::ScriptRunner(Database& database, int batchSize)
+    : database(database), commands(database), batchSize(max(batchSize, 1)) {}
+
+// ==================== RUN ====================
+ScriptReport ScriptRunner::run(istream& script, ostream& replies) {
+    ScriptReport report;
+    unordered_map<string, size_t> timingSlots;
+    string lastId;
+    int lineNumber = 0;
+    int batched = 0;        // Commands in the open batch
+    Clock::time_point start = Clock::now();
+
+    auto commit = [&]() {
+        if (batched == 0) return;
+        Clock::time_point committing = Clock::now();
+        report.filesWritten += database.commitBatch();
+        report.commitSeconds += secondsSince(committing);
+        report.batches++;
+        batched = 0;
+    };
+
+    string line;
+    while (getline(script, line)) {
+        lineNumber++;
+        istringstream in(line);
+        vector<string> words;
+        string word;
+        while (in >> word) words.push_back(word);
+        if (words.empty() || words[0][0] == '#') continue;
+
+        string command = words[0];
+        transform(command.begin(), command.end(), command.begin(), ::toupper);
+        if (command == "COMMIT") {
+            commit();
+            continue;
+        }
+
+        string request = words[0];
+        for (size_t i = 1; i < words.size(); i++) {
+            request += " " + (words[i] == "$" && !lastId.empty() ? lastId : words[i]);
+        }
+
+        if (batched == 0) database.beginBatch();
+        batched++;
+        Clock::time_point started = Clock::now();
+        string reply = commands.handle(request);
+        double micros = secondsSince(started) * 1e6;
+
+        auto slot = timingSlots.find(command);
+        if (slot == timingSlots.end()) {
+            slot = timingSlots.emplace(command, report.timings.size()).first;
+            report.timings.push_back({command});
+        }
+        ScriptCommandTiming& timing = report.timings[slot->second];
+        timing.count++;
+        timing.micros += micros;
+        report.commands++;
+
+        if (reply.compare(0, 2, "OK") == 0) {
+            if (command == "BOOK" || command == "ADDROOM") lastId = reply.substr(3);
+            replies << reply << "\n";
+        } else {
+            timing.errors++;
+            report.errors++;
+            replies << "line " << lineNumber << ": " << reply << "\n";
+        }
+
+        if (batched == batchSize) commit();
+    }
+    commit();
+
+    report.seconds = secondsSince(start);
+    return report;
+}
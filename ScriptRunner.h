@@ -0,0 +1,53 @@
+#ifndef SCRIPT_RUNNER_H
+#define SCRIPT_RUNNER_H
+
+#include "CommandProcessor.h"
+#include <istream>
+#include <ostream>
+
+// Time spent on one command over a script
+struct ScriptCommandTiming {
+    string command;
+    long long count = 0;
+    long long errors = 0;
+    double micros = 0.0;        // All runs together
+};
+
+struct ScriptReport {
+    long long commands = 0;
+    long long errors = 0;
+    int batches = 0;
+    int filesWritten = 0;
+    double seconds = 0.0;
+    double commitSeconds = 0.0;             // Part of seconds spent writing files
+    vector<ScriptCommandTiming> timings;    // In order of first use
+};
+
+// Runs CommandProcessor commands from a script, one per line, with no
+// prompts. Blank lines and lines starting with # are skipped. Commands run
+// in Database batches of batchSize, so the files are written once per batch
+// rather than once per change; a COMMIT line ends the batch early.
+//
+// A "$" argument stands for the room or reservation made by the last ADDROOM
+// or BOOK, so a script can act on what it just created:
+//
+//   BOOK 1001 101 2025-06-01 2025-06-03 2
+//   CHECKIN $
+//
+// Every reply goes to the output. Errors carry their line number and do not
+// stop the script.
+class ScriptRunner {
+private:
+    Database& database;
+    CommandProcessor commands;
+    int batchSize;
+
+public:
+    static const int DEFAULT_BATCH_SIZE = 500;
+
+    explicit ScriptRunner(Database& database, int batchSize = DEFAULT_BATCH_SIZE);
+
+    ScriptReport run(istream& script, ostream& replies);
+};
+
+#endif // SCRIPT_RUNNER_H
@@ -0,0 +1,464 @@
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include "Calendar.h"
+#include "Exceptions.h"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <tuple>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+using namespace std;
+
+// Every persisted entity specializes Schema<T> with a constexpr tuple of
+// field descriptors, in file order:
+//
+//     template <> struct Schema<Room> {
+//         static constexpr auto fields = make_tuple(
+//             field("roomNumber", &Room::roomNumber), ...);
+//     };
+//
+// and declares `template <class T> friend struct Schema;` so the table can
+// name private members. The text, binary and CSV codecs below are generated
+// from that one table, so adding a field means adding one descriptor.
+template <class T>
+struct Schema;
+
+enum class FieldKind {
+    Value,      // Written as-is
+    Date,       // time_t anchored at UTC midnight; CSV shows YYYY-MM-DD
+    Timestamp,  // time_t instant; CSV shows YYYY-MM-DDTHH:MM:SSZ
+    Secret      // Persisted, but never exported to CSV
+};
+
+template <class Owner, class Member>
+struct Field {
+    const char* name;
+    Member Owner::* member;
+    FieldKind kind;
+    bool appended;   // Added after files existed; older records end before it
+};
+
+template <class Owner, class Member>
+constexpr Field<Owner, Member> field(const char* name, Member Owner::* member,
+                                     FieldKind kind = FieldKind::Value) {
+    return Field<Owner, Member>{name, member, kind, false};
+}
+
+// For fields appended to an existing schema: a text record that ends before
+// the field keeps the value the record was constructed with.
+template <class Owner, class Member>
+constexpr Field<Owner, Member> appendedField(const char* name, Member Owner::* member,
+                                             FieldKind kind = FieldKind::Value) {
+    return Field<Owner, Member>{name, member, kind, true};
+}
+
+namespace Serialization {
+    const char TEXT_DELIMITER = '|';
+    const char LIST_SEPARATOR = ',';
+    const char ESCAPE = '\\';
+
+    // Reused across records so loading a table does not allocate per line.
+    // string_view members read through it point into `scratch` and are only
+    // valid until the next record is read.
+    struct TextReader {
+        string line;
+        string token;
+        vector<string> scratch;
+    };
+
+    namespace detail {
+        template <class M>
+        constexpr bool isScalar = is_arithmetic_v<M> || is_enum_v<M>;
+
+        template <class T, class F>
+        void forEachField(F&& visit) {
+            apply([&](const auto&... descriptor) { (visit(descriptor), ...); }, Schema<T>::fields);
+        }
+
+        // ---------- scalar <-> chars ----------
+        template <class M>
+        void appendScalar(string& out, M value) {
+            if constexpr (is_same_v<M, bool>) {
+                out.push_back(value ? '1' : '0');
+            } else if constexpr (is_enum_v<M>) {
+                appendScalar(out, static_cast<underlying_type_t<M>>(value));
+            } else {
+                char buffer[32];
+                auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+                out.append(buffer, result.ptr);
+            }
+        }
+
+        template <class M>
+        bool parseScalar(string_view text, M& value) {
+            if constexpr (is_same_v<M, bool>) {
+                if (text != "0" && text != "1") return false;
+                value = text == "1";
+                return true;
+            } else if constexpr (is_enum_v<M>) {
+                underlying_type_t<M> raw{};
+                if (!parseScalar(text, raw)) return false;
+                value = static_cast<M>(raw);
+                return true;
+            } else {
+                auto result = from_chars(text.data(), text.data() + text.size(), value);
+                return result.ec == errc() && result.ptr == text.data() + text.size();
+            }
+        }
+
+        // ---------- text codec ----------
+        inline void appendEscaped(string& out, string_view text) {
+            for (char c : text) {
+                switch (c) {
+                    case '\n': out += "\\n"; break;
+                    case '\r': out += "\\r"; break;
+                    case ESCAPE:
+                    case TEXT_DELIMITER:
+                    case LIST_SEPARATOR:
+                        out.push_back(ESCAPE);
+                        out.push_back(c);
+                        break;
+                    default:
+                        out.push_back(c);
+                }
+            }
+        }
+
+        // Splits the next unescaped token off `rest` into `out`, stopping at `stop`
+        inline void nextToken(string_view& rest, char stop, string& out) {
+            out.clear();
+            size_t i = 0;
+            for (; i < rest.size() && rest[i] != stop; i++) {
+                char c = rest[i];
+                if (c == ESCAPE && i + 1 < rest.size()) {
+                    char next = rest[++i];
+                    out.push_back(next == 'n' ? '\n' : next == 'r' ? '\r' : next);
+                } else {
+                    out.push_back(c);
+                }
+            }
+            rest = i < rest.size() ? rest.substr(i + 1) : string_view();
+        }
+
+        template <class M>
+        void appendTextValue(string& out, const M& value) {
+            if constexpr (isScalar<M>) {
+                appendScalar(out, value);
+            } else if constexpr (is_same_v<M, string> || is_same_v<M, string_view>) {
+                appendEscaped(out, value);
+            } else {
+                static_assert(is_same_v<M, vector<string>>, "unsupported field type");
+                for (size_t i = 0; i < value.size(); i++) {
+                    if (i > 0) out.push_back(LIST_SEPARATOR);
+                    appendEscaped(out, value[i]);
+                }
+            }
+        }
+
+        template <class M>
+        bool parseTextValue(TextReader& reader, const string& token, M& value) {
+            if constexpr (isScalar<M>) {
+                return parseScalar(string_view(token), value);
+            } else if constexpr (is_same_v<M, string>) {
+                value = token;
+                return true;
+            } else {
+                static_assert(is_same_v<M, string_view>, "unsupported field type");
+                reader.scratch.push_back(token);
+                value = reader.scratch.back();
+                return true;
+            }
+        }
+
+        // ---------- CSV codec ----------
+        inline void appendCsvText(string& out, string_view text, char delimiter) {
+            const char specials[] = {delimiter, '"', '\n', '\r', '\0'};
+            bool quote = text.find_first_of(specials) != string_view::npos;
+            if (!quote) {
+                out.append(text.data(), text.size());
+                return;
+            }
+            out.push_back('"');
+            for (char c : text) {
+                if (c == '"') out.push_back('"');
+                out.push_back(c);
+            }
+            out.push_back('"');
+        }
+
+        inline void appendTwoDigits(string& out, int value) {
+            out.push_back(static_cast<char>('0' + value / 10));
+            out.push_back(static_cast<char>('0' + value % 10));
+        }
+
+        template <class M>
+        void appendCsvValue(string& out, const M& value, FieldKind kind, char delimiter) {
+            if constexpr (is_integral_v<M> && !is_same_v<M, bool>) {
+                if (kind == FieldKind::Date || kind == FieldKind::Timestamp) {
+                    char date[Calendar::DATE_LENGTH];
+                    Calendar::format(Calendar::toEpochDay(static_cast<time_t>(value)), date);
+                    out.append(date, sizeof(date));
+                    if (kind == FieldKind::Timestamp) {
+                        long long seconds = static_cast<long long>(value) -
+                            static_cast<long long>(Calendar::toEpochDay(static_cast<time_t>(value))) *
+                            Calendar::SECONDS_PER_DAY;
+                        out.push_back('T');
+                        appendTwoDigits(out, static_cast<int>(seconds / 3600));
+                        out.push_back(':');
+                        appendTwoDigits(out, static_cast<int>(seconds / 60 % 60));
+                        out.push_back(':');
+                        appendTwoDigits(out, static_cast<int>(seconds % 60));
+                        out.push_back('Z');
+                    }
+                    return;
+                }
+            }
+            if constexpr (isScalar<M>) {
+                appendScalar(out, value);
+            } else if constexpr (is_same_v<M, string> || is_same_v<M, string_view>) {
+                appendCsvText(out, value, delimiter);
+            } else {
+                static_assert(is_same_v<M, vector<string>>, "unsupported field type");
+                string joined;
+                for (size_t i = 0; i < value.size(); i++) {
+                    if (i > 0) joined.push_back(';');
+                    joined += value[i];
+                }
+                appendCsvText(out, joined, delimiter);
+            }
+        }
+
+        // ---------- binary codec ----------
+        inline void appendLength(string& out, size_t length) {
+            uint32_t size = static_cast<uint32_t>(length);
+            out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        }
+
+        template <class M>
+        void appendBinaryValue(string& out, const M& value) {
+            if constexpr (is_trivially_copyable_v<M> && !is_same_v<M, string_view>) {
+                // POD columns go out as raw bytes
+                out.append(reinterpret_cast<const char*>(&value), sizeof(M));
+            } else if constexpr (is_same_v<M, string> || is_same_v<M, string_view>) {
+                appendLength(out, value.size());
+                out.append(value.data(), value.size());
+            } else {
+                static_assert(is_same_v<M, vector<string>>, "unsupported field type");
+                appendLength(out, value.size());
+                for (const auto& item : value) {
+                    appendLength(out, item.size());
+                    out.append(item.data(), item.size());
+                }
+            }
+        }
+
+        inline bool readLength(istream& in, uint32_t& length) {
+            return static_cast<bool>(in.read(reinterpret_cast<char*>(&length), sizeof(length)));
+        }
+
+        inline bool readString(istream& in, string& value) {
+            uint32_t length = 0;
+            if (!readLength(in, length)) return false;
+            value.resize(length);
+            return length == 0 || static_cast<bool>(in.read(&value[0], length));
+        }
+
+        template <class M>
+        bool readBinaryValue(istream& in, TextReader& reader, M& value) {
+            if constexpr (is_trivially_copyable_v<M> && !is_same_v<M, string_view>) {
+                return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(M)));
+            } else if constexpr (is_same_v<M, string>) {
+                return readString(in, value);
+            } else if constexpr (is_same_v<M, string_view>) {
+                reader.scratch.emplace_back();
+                if (!readString(in, reader.scratch.back())) return false;
+                value = reader.scratch.back();
+                return true;
+            } else {
+                static_assert(is_same_v<M, vector<string>>, "unsupported field type");
+                uint32_t count = 0;
+                if (!readLength(in, count)) return false;
+                value.assign(count, string());
+                for (auto& item : value) {
+                    if (!readString(in, item)) return false;
+                }
+                return true;
+            }
+        }
+    }
+
+    // ==================== TEXT ====================
+    // One record per line, fields separated by '|', list items by ','.
+    template <class T>
+    void appendText(string& out, const T& record) {
+        bool first = true;
+        detail::forEachField<T>([&](const auto& descriptor) {
+            if (!first) out.push_back(TEXT_DELIMITER);
+            first = false;
+            detail::appendTextValue(out, record.*(descriptor.member));
+        });
+        out.push_back('\n');
+    }
+
+    template <class T>
+    void writeText(ostream& out, const T& record) {
+        string line;
+        appendText(line, record);
+        out.write(line.data(), static_cast<streamsize>(line.size()));
+    }
+
+    // Returns false at end of input; throws on a malformed record
+    template <class T>
+    bool readText(istream& in, T& record, TextReader& reader) {
+        if (!getline(in, reader.line)) return false;
+        if (!reader.line.empty() && reader.line.back() == '\r') reader.line.pop_back();
+        reader.scratch.clear();
+        reader.scratch.reserve(tuple_size_v<decay_t<decltype(Schema<T>::fields)>>);
+
+        string_view rest(reader.line);
+        bool ok = true;
+        detail::forEachField<T>([&](const auto& descriptor) {
+            if (!ok) return;
+            using Member = decay_t<decltype(record.*(descriptor.member))>;
+            if constexpr (is_same_v<Member, vector<string>>) {
+                // Split on unescaped '|' but keep escapes so ',' can be split next
+                size_t end = 0;
+                while (end < rest.size() && rest[end] != TEXT_DELIMITER) {
+                    end += (rest[end] == ESCAPE && end + 1 < rest.size()) ? 2 : 1;
+                }
+                string_view raw = rest.substr(0, end);
+                rest = end < rest.size() ? rest.substr(end + 1) : string_view();
+                auto& list = record.*(descriptor.member);
+                list.clear();
+                while (!raw.empty()) {
+                    detail::nextToken(raw, LIST_SEPARATOR, reader.token);
+                    list.push_back(reader.token);
+                }
+            } else {
+                // nextToken leaves a null view once the last field is taken
+                if (descriptor.appended && rest.data() == nullptr) return;
+                detail::nextToken(rest, TEXT_DELIMITER, reader.token);
+                ok = detail::parseTextValue(reader, reader.token, record.*(descriptor.member));
+                if (!ok) {
+                    throw FileCorruptedException("record", string("field '") + descriptor.name +
+                                                 "' has bad value '" + reader.token + "'");
+                }
+            }
+        });
+        return ok;
+    }
+
+    template <class T>
+    bool readText(istream& in, T& record) {
+        TextReader reader;
+        return readText(in, record, reader);
+    }
+
+    // ==================== BINARY ====================
+    // Scalars are raw host-order bytes, strings are u32 length + bytes.
+    template <class T>
+    void appendBinary(string& out, const T& record) {
+        detail::forEachField<T>([&](const auto& descriptor) {
+            detail::appendBinaryValue(out, record.*(descriptor.member));
+        });
+    }
+
+    template <class T>
+    void writeBinary(ostream& out, const T& record) {
+        string bytes;
+        appendBinary(bytes, record);
+        out.write(bytes.data(), static_cast<streamsize>(bytes.size()));
+    }
+
+    template <class T>
+    bool readBinary(istream& in, T& record, TextReader& reader) {
+        reader.scratch.clear();
+        reader.scratch.reserve(tuple_size_v<decay_t<decltype(Schema<T>::fields)>>);
+        bool ok = true;
+        detail::forEachField<T>([&](const auto& descriptor) {
+            if (ok) ok = detail::readBinaryValue(in, reader, record.*(descriptor.member));
+        });
+        return ok;
+    }
+
+    template <class T>
+    bool readBinary(istream& in, T& record) {
+        TextReader reader;
+        return readBinary(in, record, reader);
+    }
+
+    // ==================== CSV ====================
+    // RFC 4180 style quoting; Secret fields are left out.
+    template <class T>
+    void appendCsvHeader(string& out, char delimiter = ',') {
+        bool first = true;
+        detail::forEachField<T>([&](const auto& descriptor) {
+            if (descriptor.kind == FieldKind::Secret) return;
+            if (!first) out.push_back(delimiter);
+            first = false;
+            out += descriptor.name;
+        });
+        out.push_back('\n');
+    }
+
+    template <class T>
+    void appendCsv(string& out, const T& record, char delimiter = ',') {
+        bool first = true;
+        detail::forEachField<T>([&](const auto& descriptor) {
+            if (descriptor.kind == FieldKind::Secret) return;
+            if (!first) out.push_back(delimiter);
+            first = false;
+            detail::appendCsvValue(out, record.*(descriptor.member), descriptor.kind, delimiter);
+        });
+        out.push_back('\n');
+    }
+
+    // ==================== LEGACY TEXT ====================
+    // Files written before the schema tables: space-separated fields, so
+    // text fields with spaces are recovered by position around the fixed ones.
+    // Returns false at end of input.
+    inline bool readLegacyWords(istream& in, vector<string>& words) {
+        string line;
+        while (getline(in, line)) {
+            words.clear();
+            size_t i = 0;
+            while (i < line.size()) {
+                while (i < line.size() && isspace(static_cast<unsigned char>(line[i]))) i++;
+                size_t start = i;
+                while (i < line.size() && !isspace(static_cast<unsigned char>(line[i]))) i++;
+                if (i > start) words.push_back(line.substr(start, i - start));
+            }
+            if (!words.empty()) return true;
+        }
+        return false;
+    }
+
+    template <class M>
+    M legacyValue(const string& word, const char* file) {
+        M value{};
+        if (!detail::parseScalar(string_view(word), value)) {
+            throw FileCorruptedException(file, "bad legacy value '" + word + "'");
+        }
+        return value;
+    }
+
+    // Words [from, to) joined by single spaces
+    inline string joinWords(const vector<string>& words, size_t from, size_t to) {
+        string text;
+        for (size_t i = from; i < to && i < words.size(); i++) {
+            if (i > from) text.push_back(' ');
+            text += words[i];
+        }
+        return text;
+    }
+}
+
+#endif // SERIALIZATION_H
@@ -0,0 +1,84 @@
+#include "TableLock.h"
+#include "Exceptions.h"
+#include <vector>
+
+namespace {
+    // Tables each thread holds, per set of locks
+    struct Holding {
+        const TableLocks* locks;
+        unsigned shared;
+        unsigned exclusive;
+    };
+
+    thread_local vector<Holding> holdings;
+
+    Holding& holdingFor(const TableLocks* locks) {
+        for (auto& holding : holdings) {
+            if (holding.locks == locks) return holding;
+        }
+        holdings.push_back({locks, 0, 0});
+        return holdings.back();
+    }
+}
+
+unsigned long long TableLocks::version(unsigned tables) const {
+    unsigned long long total = 0;
+    for (int table = 0; table < MAX_TABLES; table++) {
+        if (tables & (1u << table)) total += versions[table];
+    }
+    return total;
+}
+
+// ==================== CONSTRUCTOR / DESTRUCTOR ====================
+TableLock::TableLock(TableLocks& locks, unsigned reads, unsigned writes)
+    : locks(locks), sharedTaken(0), exclusiveTaken(0) {
+    Holding& holding = holdingFor(&locks);
+    unsigned held = holding.shared | holding.exclusive;
+    unsigned wanted = (reads | writes) & ~held;
+
+    if (writes & holding.shared) {
+        throw SystemException("Table locks", "a table read by this thread cannot be written in a nested call");
+    }
+    if (wanted != 0 && held != 0) {
+        unsigned lowestWanted = wanted & (~wanted + 1);
+        unsigned highestHeld = held;
+        while (highestHeld & (highestHeld - 1)) highestHeld &= highestHeld - 1;
+        if (lowestWanted < highestHeld) {
+            throw SystemException("Table locks", "tables taken out of order in a nested call");
+        }
+    }
+
+    for (int table = 0; table < TableLocks::MAX_TABLES; table++) {
+        unsigned bit = 1u << table;
+        if (!(wanted & bit)) continue;
+        if (writes & bit) {
+            locks.tables[table].lock();
+            exclusiveTaken |= bit;
+        } else {
+            locks.tables[table].lock_shared();
+            sharedTaken |= bit;
+        }
+    }
+    holding.shared |= sharedTaken;
+    holding.exclusive |= exclusiveTaken;
+    if (holding.shared == 0 && holding.exclusive == 0) holdings.pop_back();   // Asked for no tables
+}
+
+TableLock::~TableLock() {
+    if (sharedTaken == 0 && exclusiveTaken == 0) return;
+    for (int table = TableLocks::MAX_TABLES - 1; table >= 0; table--) {
+        unsigned bit = 1u << table;
+        if (exclusiveTaken & bit) {
+            locks.versions[table]++;
+            locks.tables[table].unlock();
+        } else if (sharedTaken & bit) locks.tables[table].unlock_shared();
+    }
+
+    Holding& holding = holdingFor(&locks);
+    holding.shared &= ~sharedTaken;
+    holding.exclusive &= ~exclusiveTaken;
+    if (holding.shared == 0 && holding.exclusive == 0) {
+        holding = holdings.back();
+        holdings.pop_back();
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef TABLE_LOCK_H
+#define TABLE_LOCK_H
+
+#include <shared_mutex>
+#include <atomic>
+
+using namespace std;
+
+// One reader-writer lock per table, for up to MAX_TABLES tables numbered by
+// bit: table i is the bit 1u << i, and the bits give the lock order.
+//
+// Each table also counts the exclusive guards released on it, so a reader
+// can tell whether a table changed since it last looked.
+class TableLocks {
+public:
+    static const int MAX_TABLES = 16;
+
+    // Sum of the write counts of the given tables; stable while they are held
+    unsigned long long version(unsigned tables) const;
+
+private:
+    shared_mutex tables[MAX_TABLES];
+    atomic<unsigned long long> versions[MAX_TABLES] = {};
+    friend class TableLock;
+};
+
+// Holds a set of tables for one scope: shared for the ones it reads,
+// exclusive for the ones it writes. All are taken at construction in bit
+// order, so two guards can never wait on each other.
+//
+// Guards nest on a thread: tables the thread already holds pass through, so
+// a locked call can make other locked calls. The outer guard must name every
+// table the inner ones add; a nested guard that would write a table the
+// thread only reads, or take a table below one it holds, throws
+// SystemException rather than deadlock.
+class TableLock {
+private:
+    TableLocks& locks;
+    unsigned sharedTaken;       // Tables this guard locked, as opposed to
+    unsigned exclusiveTaken;    // found already held
+
+public:
+    TableLock(TableLocks& locks, unsigned reads, unsigned writes = 0);
+    ~TableLock();
+
+    TableLock(const TableLock&) = delete;
+    TableLock& operator=(const TableLock&) = delete;
+};
+
+#endif // TABLE_LOCK_H
@@ -0,0 +1,110 @@
+#include "ThreadPool.h"
+#include <atomic>
+#include <exception>
+
+// ==================== CONSTRUCTOR / DESTRUCTOR ====================
+ThreadPool::ThreadPool(unsigned threads) : stopping(false) {
+    if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+    workers.reserve(threads);
+    for (unsigned i = 0; i < threads; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueReady.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(queueMutex);
+            queueReady.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (stopping && tasks.empty()) return;
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+unsigned ThreadPool::size() const {
+    return static_cast<unsigned>(workers.size());
+}
+
+// ==================== PARALLEL FOR ====================
+namespace {
+    // Shared with helper tasks, which may start after the call has returned
+    struct ParallelForState {
+        size_t count;
+        size_t grain;
+        size_t chunks;
+        atomic<size_t> nextChunk{0};
+        size_t finishedChunks = 0;
+        exception_ptr error;
+        mutex doneMutex;
+        condition_variable done;
+    };
+
+    void runChunks(ParallelForState& state, const function<void(size_t, size_t)>* body) {
+        for (size_t chunk = state.nextChunk++; chunk < state.chunks; chunk = state.nextChunk++) {
+            size_t begin = chunk * state.grain;
+            size_t end = min(begin + state.grain, state.count);
+            exception_ptr error;
+            try {
+                (*body)(begin, end);
+            } catch (...) {
+                error = current_exception();
+            }
+
+            lock_guard<mutex> lock(state.doneMutex);
+            if (error && !state.error) state.error = error;
+            if (++state.finishedChunks == state.chunks) state.done.notify_all();
+        }
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grain, const function<void(size_t, size_t)>& body) {
+    if (count == 0) return;
+    if (grain == 0) grain = 1;
+
+    auto state = make_shared<ParallelForState>();
+    state->count = count;
+    state->grain = grain;
+    state->chunks = (count + grain - 1) / grain;
+
+    // Small inputs are not worth a hand-off; without helpers the caller
+    // still goes chunk by chunk, since callers index results by chunk
+    if (state->chunks == 1 || size() <= 1) {
+        for (size_t begin = 0; begin < count; begin += grain) {
+            body(begin, min(begin + grain, count));
+        }
+        return;
+    }
+
+    size_t helpers = min<size_t>(size(), state->chunks - 1);
+    for (size_t i = 0; i < helpers; i++) {
+        // body outlives every chunk that gets claimed, because we wait for
+        // them; a helper that starts late finds no chunks and never calls it
+        const function<void(size_t, size_t)>* bodyPtr = &body;
+        submit([state, bodyPtr]() { runChunks(*state, bodyPtr); });
+    }
+    runChunks(*state, &body);
+
+    unique_lock<mutex> lock(state->doneMutex);
+    state->done.wait(lock, [&]() { return state->finishedChunks == state->chunks; });
+    if (state->error) rethrow_exception(state->error);
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
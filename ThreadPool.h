@@ -0,0 +1,60 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+
+using namespace std;
+
+// Fixed set of worker threads fed from one FIFO queue. Reports share the
+// process-wide pool from ThreadPool::shared() instead of spawning threads
+// per call.
+class ThreadPool {
+private:
+    vector<thread> workers;
+    deque<function<void()>> tasks;
+    mutex queueMutex;
+    condition_variable queueReady;
+    bool stopping;
+
+    void workerLoop();
+
+public:
+    // threads = 0 uses one worker per hardware thread
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const;
+
+    template <class F>
+    auto submit(F&& task) -> future<decltype(task())> {
+        using Result = decltype(task());
+        auto packaged = make_shared<packaged_task<Result()>>(std::forward<F>(task));
+        future<Result> result = packaged->get_future();
+        {
+            lock_guard<mutex> lock(queueMutex);
+            tasks.emplace_back([packaged]() { (*packaged)(); });
+        }
+        queueReady.notify_one();
+        return result;
+    }
+
+    // Runs body(begin, end) over [0, count) in chunks of at most `grain`
+    // items. The calling thread works through chunks too and only waits for
+    // chunks already claimed, so nested calls from pool tasks cannot
+    // deadlock. The first exception thrown by body is rethrown here.
+    void parallelFor(size_t count, size_t grain, const function<void(size_t, size_t)>& body);
+
+    static ThreadPool& shared();
+};
+
+#endif // THREAD_POOL_H
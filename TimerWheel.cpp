@@ -0,0 +1,143 @@
+#include "TimerWheel.h"
+#include "Exceptions.h"
+
+// ==================== CONSTRUCTOR ====================
+TimerWheel::TimerWheel() : buckets(LEVELS * SLOTS, -1), now(0), pending(0) {}
+
+// ==================== SLOTS ====================
+// The level is picked by how far off the deadline is, the slot by the
+// deadline's own bits at that level, so a level-n timer lands in level 0
+// exactly when the lower levels have counted down to it.
+void TimerWheel::link(int index) {
+    Timer& timer = timers[index];
+    unsigned long long delta = timer.expires - now;
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (1ULL << ((level + 1) * SLOT_BITS))) level++;
+    int slot = static_cast<int>((timer.expires >> (level * SLOT_BITS)) & (SLOTS - 1));
+
+    timer.bucket = level * SLOTS + slot;
+    timer.prev = -1;
+    timer.next = buckets[timer.bucket];
+    if (timer.next >= 0) timers[timer.next].prev = index;
+    buckets[timer.bucket] = index;
+}
+
+void TimerWheel::unlink(int index) {
+    Timer& timer = timers[index];
+    if (timer.prev >= 0) {
+        timers[timer.prev].next = timer.next;
+    } else {
+        buckets[timer.bucket] = timer.next;
+    }
+    if (timer.next >= 0) timers[timer.next].prev = timer.prev;
+    timer.prev = timer.next = -1;
+}
+
+void TimerWheel::release(int index) {
+    Timer& timer = timers[index];
+    timer.task = nullptr;
+    timer.bucket = -1;
+    timer.generation++;
+    freeTimers.push_back(index);
+    pending--;
+}
+
+// Re-files every timer of the level's current slot one level down or more
+void TimerWheel::cascade(int level) {
+    int bucket = level * SLOTS + static_cast<int>((now >> (level * SLOT_BITS)) & (SLOTS - 1));
+    int index = buckets[bucket];
+    buckets[bucket] = -1;
+    while (index >= 0) {
+        int next = timers[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+int TimerWheel::find(TimerId id) const {
+    size_t index = static_cast<size_t>(id & 0xFFFFFFFFULL);
+    unsigned generation = static_cast<unsigned>(id >> 32);
+    if (index >= timers.size()) return -1;
+    const Timer& timer = timers[index];
+    if (timer.bucket < 0 || timer.generation != generation) return -1;
+    return static_cast<int>(index);
+}
+
+// ==================== SCHEDULING ====================
+TimerId TimerWheel::schedule(unsigned long long delay, function<void()> task, unsigned long long period) {
+    if (!task) throw ValidationException("Timer needs a task");
+    if (delay > MAX_DELAY || period > MAX_DELAY) throw ValidationException("Timer delay is too long");
+    if (delay == 0) delay = 1;
+
+    int index;
+    if (!freeTimers.empty()) {
+        index = freeTimers.back();
+        freeTimers.pop_back();
+    } else {
+        index = static_cast<int>(timers.size());
+        timers.emplace_back();
+    }
+    Timer& timer = timers[index];
+    timer.task = std::move(task);
+    timer.expires = now + delay;
+    timer.period = period;
+    link(index);
+    pending++;
+    return (static_cast<TimerId>(timer.generation) << 32) | static_cast<TimerId>(index);
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    int index = find(id);
+    if (index < 0) return false;
+    unlink(index);
+    release(index);
+    return true;
+}
+
+bool TimerWheel::isPending(TimerId id) const {
+    return find(id) >= 0;
+}
+
+// ==================== TICKS ====================
+void TimerWheel::advance(unsigned long long ticks, vector<function<void()>>& due) {
+    while (ticks > 0) {
+        if (pending == 0) {
+            now += ticks;
+            return;
+        }
+        ticks--;
+        now++;
+
+        // Each wrap of a level pulls the next slot of the level above down
+        for (int level = 1; level < LEVELS; level++) {
+            if ((now & ((1ULL << (level * SLOT_BITS)) - 1)) != 0) break;
+            cascade(level);
+        }
+
+        int bucket = static_cast<int>(now & (SLOTS - 1));
+        int index = buckets[bucket];
+        buckets[bucket] = -1;
+        while (index >= 0) {
+            int next = timers[index].next;
+            Timer& timer = timers[index];
+            timer.prev = timer.next = -1;
+            if (timer.period > 0) {
+                due.push_back(timer.task);
+                timer.expires = now + timer.period;
+                link(index);
+            } else {
+                due.push_back(std::move(timer.task));
+                release(index);
+            }
+            index = next;
+        }
+    }
+}
+
+unsigned long long TimerWheel::getTick() const {
+    return now;
+}
+
+size_t TimerWheel::size() const {
+    return pending;
+}
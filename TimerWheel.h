@@ -0,0 +1,66 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <vector>
+#include <functional>
+
+using namespace std;
+
+// Generation in the high half, timer slot in the low half; 0 is never issued
+typedef unsigned long long TimerId;
+
+// Hierarchical timer wheel: four levels of 256 slots reach 2^32 ticks ahead.
+// A timer sits in the level its deadline falls into and moves one level down
+// each time the level below wraps, so scheduling, cancelling and each tick
+// cost O(1) however many timers are pending. Timers are pooled and linked by
+// index; an id goes stale once its timer fires or is cancelled.
+//
+// Not thread-safe; Scheduler drives one from its own thread.
+class TimerWheel {
+public:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 8;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const unsigned long long MAX_DELAY = (1ULL << (LEVELS * SLOT_BITS)) - 1;
+
+private:
+    struct Timer {
+        function<void()> task;
+        unsigned long long expires = 0;
+        unsigned long long period = 0;      // 0 for one-shot
+        unsigned generation = 1;
+        int prev = -1;
+        int next = -1;
+        int bucket = -1;                    // -1 while free
+    };
+
+    vector<Timer> timers;
+    vector<int> freeTimers;
+    vector<int> buckets;                    // LEVELS * SLOTS list heads
+    unsigned long long now;
+    size_t pending;
+
+    void link(int index);
+    void unlink(int index);
+    void release(int index);
+    void cascade(int level);
+    int find(TimerId id) const;
+
+public:
+    TimerWheel();
+
+    // Runs task after delay ticks (at least 1, at most MAX_DELAY), then every
+    // period ticks if period is not 0
+    TimerId schedule(unsigned long long delay, function<void()> task, unsigned long long period = 0);
+    bool cancel(TimerId id);
+    bool isPending(TimerId id) const;
+
+    // Moves the wheel on and appends the tasks that fell due, earliest
+    // deadline first, for the caller to run
+    void advance(unsigned long long ticks, vector<function<void()>>& due);
+
+    unsigned long long getTick() const;
+    size_t size() const;
+};
+
+#endif // TIMER_WHEEL_H
@@ -1,13 +1,21 @@
 #include "Utils.h"
 #include <sys/stat.h>
 #include <cstdlib>
+#include <atomic>
 
 // ==================== INPUT FUNCTIONS ====================
+namespace {
+    // Read by the session timer on the scheduler thread
+    atomic<time_t> lastInput(time(nullptr));
+}
+
 int Utils::getIntegerInput(const string& prompt, int min, int max) {
     int value;
     while (true) {
         cout << prompt;
-        if (cin >> value) {
+        bool read = static_cast<bool>(cin >> value);
+        lastInput = time(nullptr);
+        if (read) {
             if (value >= min && value <= max) {
                 cin.ignore(numeric_limits<streamsize>::max(), '\n');
                 return value;
@@ -26,7 +34,9 @@ double Utils::getDoubleInput(const string& prompt, double min) {
     double value;
     while (true) {
         cout << prompt;
-        if (cin >> value) {
+        bool read = static_cast<bool>(cin >> value);
+        lastInput = time(nullptr);
+        if (read) {
             if (value >= min) {
                 cin.ignore(numeric_limits<streamsize>::max(), '\n');
                 return value;
@@ -46,6 +56,7 @@ string Utils::getStringInput(const string& prompt, bool allowEmpty) {
     while (true) {
         cout << prompt;
         getline(cin, input);
+        lastInput = time(nullptr);
         input = trim(input);
         
         if (!allowEmpty && input.empty()) {
@@ -62,6 +73,7 @@ bool Utils::getYesNoInput(const string& prompt) {
         cout << prompt << " (y/n): ";
         cin >> choice;
         cin.ignore(numeric_limits<streamsize>::max(), '\n');
+        lastInput = time(nullptr);
         
         choice = tolower(choice);
         if (choice == 'y' || choice == 'n') {
@@ -71,15 +83,17 @@ bool Utils::getYesNoInput(const string& prompt) {
     }
 }
 
+time_t Utils::getLastInputTime() {
+    return lastInput;
+}
+
 // ==================== DATE FUNCTIONS ====================
+// Dates are UTC-midnight anchored epoch days (see Calendar.h). Only "today"
+// and instant-to-day conversions consult the local time zone, via localtime_s.
 string Utils::getCurrentDate() {
-    time_t now = time(nullptr);
-    tm timeinfo;
-    localtime_s(&timeinfo, &now);
-    
-    char buffer[11];
-    strftime(buffer, sizeof(buffer), "%Y-%m-%d", &timeinfo);
-    return string(buffer);
+    char buffer[Calendar::DATE_LENGTH];
+    Calendar::format(getTodayEpochDay(), buffer);
+    return string(buffer, sizeof(buffer));
 }
 
 string Utils::getCurrentDateTime() {
@@ -93,54 +107,49 @@ string Utils::getCurrentDateTime() {
 }
 
 time_t Utils::parseDate(const string& dateStr) {
-    tm tm = {};
-    stringstream ss(dateStr);
-    string token;
-    
-    getline(ss, token, '-');
-    tm.tm_year = stoi(token) - 1900;
-    
-    getline(ss, token, '-');
-    tm.tm_mon = stoi(token) - 1;
-    
-    getline(ss, token, '-');
-    tm.tm_mday = stoi(token);
-    
-    tm.tm_hour = 0;
-    tm.tm_min = 0;
-    tm.tm_sec = 0;
-    
-    return mktime(&tm);
+    int epochDay = 0;
+    if (!Calendar::parse(dateStr.data(), dateStr.size(), epochDay)) {
+        throw InvalidDateException(dateStr, "YYYY-MM-DD");
+    }
+    return Calendar::fromEpochDay(epochDay);
 }
 
 string Utils::formatDate(time_t time) {
-    tm* tm = localtime(&time);
-    char buffer[11];
-    strftime(buffer, sizeof(buffer), "%Y-%m-%d", tm);
-    return string(buffer);
+    char buffer[Calendar::DATE_LENGTH];
+    Calendar::format(Calendar::toEpochDay(time), buffer);
+    return string(buffer, sizeof(buffer));
+}
+
+string Utils::formatLocalDate(time_t instant) {
+    char buffer[Calendar::DATE_LENGTH];
+    Calendar::format(localEpochDay(instant), buffer);
+    return string(buffer, sizeof(buffer));
 }
 
 bool Utils::isValidDate(const string& dateStr) {
-    if (dateStr.length() != 10) return false;
-    if (dateStr[4] != '-' || dateStr[7] != '-') return false;
+    int epochDay = 0;
+    if (!Calendar::parse(dateStr.data(), dateStr.size(), epochDay)) return false;
     
-    try {
-        int year = stoi(dateStr.substr(0, 4));
-        int month = stoi(dateStr.substr(5, 2));
-        int day = stoi(dateStr.substr(8, 2));
-        
-        if (year < 2023 || year > 2030) return false;
-        if (month < 1 || month > 12) return false;
-        if (day < 1 || day > 31) return false;
-        
-        return true;
-    } catch (...) {
-        return false;
-    }
+    int year = Calendar::civilFromDays(epochDay).year;
+    return year >= 2023 && year <= 2030;
 }
 
 int Utils::daysBetween(time_t start, time_t end) {
-    return (end - start) / (60 * 60 * 24);
+    return Calendar::toEpochDay(end) - Calendar::toEpochDay(start);
+}
+
+int Utils::toEpochDay(time_t date) {
+    return Calendar::toEpochDay(date);
+}
+
+int Utils::localEpochDay(time_t instant) {
+    tm timeinfo;
+    localtime_s(&timeinfo, &instant);
+    return Calendar::daysFromCivil(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday);
+}
+
+int Utils::getTodayEpochDay() {
+    return localEpochDay(time(nullptr));
 }
 
 // ==================== STRING FUNCTIONS ====================
@@ -251,6 +260,7 @@ string Utils::centerText(const string& text, int width) {
 void Utils::pressEnterToContinue() {
     cout << "\nPress Enter to continue...";
     cin.ignore(numeric_limits<streamsize>::max(), '\n');
+    lastInput = time(nullptr);
 }
 
 int Utils::generateId() {
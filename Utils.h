@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <cctype>
 #include "Exceptions.h"
+#include "Calendar.h"
 
 using namespace std;
 
@@ -41,7 +42,8 @@ enum ReservationStatus {
     CONFIRMED = 1,
     CHECKED_IN = 2,
     CHECKED_OUT = 3,
-    CANCELLED = 4
+    CANCELLED = 4,
+    NO_SHOW = 5         // Confirmed guest who never arrived
 };
 
 enum PaymentStatus {
@@ -65,14 +67,19 @@ public:
     static double getDoubleInput(const string& prompt, double min = 0.0);
     static string getStringInput(const string& prompt, bool allowEmpty = false);
     static bool getYesNoInput(const string& prompt);
+    static time_t getLastInputTime();       // When any of the above last read a line
     
     // Date and time
     static string getCurrentDate();
     static string getCurrentDateTime();
     static time_t parseDate(const string& dateStr);
     static string formatDate(time_t time);
+    static string formatLocalDate(time_t instant);
     static bool isValidDate(const string& dateStr);
     static int daysBetween(time_t start, time_t end);
+    static int toEpochDay(time_t date);
+    static int localEpochDay(time_t instant);
+    static int getTodayEpochDay();
     
     // String operations
     static string toUpper(const string& str);
@@ -0,0 +1,140 @@
+#include "Waitlist.h"
+#include <algorithm>
+
+// ==================== CONSTRUCTOR ====================
+Waitlist::Waitlist() {
+    fill(longestStay, longestStay + ROOM_TYPE_SLOTS, 0);
+}
+
+void Waitlist::assign(const vector<WaitlistRequest>& loaded) {
+    requests = loaded;
+    for (int t = 0; t < ROOM_TYPE_SLOTS; t++) {
+        waitingByDay[t].clear();
+        longestStay[t] = 0;
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        if (requests[i].status == WAITLIST_WAITING) index(static_cast<int>(i));
+    }
+}
+
+// ==================== INDEX ====================
+int Waitlist::positionOf(int requestId) const {
+    // IDs are handed out in increasing order, so the list is sorted by them
+    auto found = lower_bound(requests.begin(), requests.end(), requestId,
+                             [](const WaitlistRequest& request, int id) { return request.requestId < id; });
+    if (found == requests.end() || found->requestId != requestId) return -1;
+    return static_cast<int>(found - requests.begin());
+}
+
+void Waitlist::index(int position) {
+    const WaitlistRequest& request = requests[position];
+    if (request.type < STANDARD || request.type > PRESIDENTIAL) return;
+    int first = Utils::toEpochDay(request.checkInDate);
+    waitingByDay[request.type][first].push_back(position);
+    longestStay[request.type] = max(longestStay[request.type], Utils::toEpochDay(request.checkOutDate) - first);
+}
+
+void Waitlist::unindex(int position) {
+    const WaitlistRequest& request = requests[position];
+    if (request.type < STANDARD || request.type > PRESIDENTIAL) return;
+    auto day = waitingByDay[request.type].find(Utils::toEpochDay(request.checkInDate));
+    if (day == waitingByDay[request.type].end()) return;
+    vector<int>& positions = day->second;
+    positions.erase(remove(positions.begin(), positions.end(), position), positions.end());
+    if (positions.empty()) waitingByDay[request.type].erase(day);
+}
+
+// ==================== UPDATES ====================
+void Waitlist::add(const WaitlistRequest& request) {
+    if (!requests.empty() && request.requestId <= requests.back().requestId) {
+        throw ValidationException("Waitlist request IDs must increase");
+    }
+    requests.push_back(request);
+    if (request.status == WAITLIST_WAITING) index(static_cast<int>(requests.size()) - 1);
+}
+
+bool Waitlist::close(int requestId, WaitlistStatus status) {
+    int position = positionOf(requestId);
+    if (position < 0 || requests[position].status != WAITLIST_WAITING) return false;
+    unindex(position);
+    requests[position].status = status;
+    return true;
+}
+
+bool Waitlist::markFilled(int requestId, int reservationId) {
+    if (!close(requestId, WAITLIST_FILLED)) return false;
+    requests[positionOf(requestId)].reservationId = reservationId;
+    return true;
+}
+
+bool Waitlist::withdraw(int requestId) {
+    return close(requestId, WAITLIST_WITHDRAWN);
+}
+
+int Waitlist::expire(int todayEpochDay) {
+    int expired = 0;
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        auto& byDay = waitingByDay[t];
+        while (!byDay.empty() && byDay.begin()->first < todayEpochDay) {
+            for (int position : byDay.begin()->second) {
+                requests[position].status = WAITLIST_EXPIRED;
+                expired++;
+            }
+            byDay.erase(byDay.begin());
+        }
+    }
+    return expired;
+}
+
+// ==================== QUERIES ====================
+const WaitlistRequest* Waitlist::find(int requestId) const {
+    int position = positionOf(requestId);
+    return position < 0 ? nullptr : &requests[position];
+}
+
+const vector<WaitlistRequest>& Waitlist::getRequests() const {
+    return requests;
+}
+
+int Waitlist::getWaitingCount() const {
+    int waiting = 0;
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        for (const auto& day : waitingByDay[t]) waiting += static_cast<int>(day.second.size());
+    }
+    return waiting;
+}
+
+int Waitlist::match(RoomType type, int capacity, int freeFrom, int freeTo, int firstDay, int endDay) const {
+    if (type < STANDARD || type > PRESIDENTIAL) return 0;
+    firstDay = max(firstDay, freeFrom);
+    endDay = min(endDay, freeTo);
+    if (firstDay >= endDay) return 0;
+
+    // A request reaching the freed nights arrives no earlier than the longest
+    // stay before them, and before they end
+    const auto& byDay = waitingByDay[type];
+    auto day = byDay.lower_bound(max(freeFrom, firstDay - longestStay[type] + 1));
+    auto last = byDay.lower_bound(endDay);
+
+    const WaitlistRequest* best = nullptr;
+    int bestShared = 0, bestNights = 0;
+    for (; day != last; ++day) {
+        for (int position : day->second) {
+            const WaitlistRequest& request = requests[position];
+            int checkIn = day->first;
+            int checkOut = Utils::toEpochDay(request.checkOutDate);
+            if (checkOut > freeTo || request.guests > capacity) continue;
+            int shared = min(checkOut, endDay) - max(checkIn, firstDay);
+            if (shared <= 0) continue;
+
+            int nights = checkOut - checkIn;
+            if (!best || shared > bestShared || (shared == bestShared &&
+                (nights > bestNights || (nights == bestNights && request.requestId < best->requestId)))) {
+                best = &request;
+                bestShared = shared;
+                bestNights = nights;
+            }
+        }
+    }
+    return best ? best->requestId : 0;
+}
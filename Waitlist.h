@@ -0,0 +1,78 @@
+#ifndef WAITLIST_H
+#define WAITLIST_H
+
+#include "OccupancyAnalytics.h"
+#include "Serialization.h"
+#include <vector>
+#include <map>
+
+enum WaitlistStatus {
+    WAITLIST_WAITING = 1,
+    WAITLIST_FILLED = 2,        // Turned into a reservation
+    WAITLIST_WITHDRAWN = 3,
+    WAITLIST_EXPIRED = 4        // Arrival day passed while waiting
+};
+
+struct WaitlistRequest {
+    int requestId = 0;
+    int customerId = 0;
+    RoomType type = STANDARD;
+    int guests = 1;
+    time_t checkInDate = 0;
+    time_t checkOutDate = 0;
+    time_t requestedAt = 0;
+    WaitlistStatus status = WAITLIST_WAITING;
+    int reservationId = 0;      // Set once filled
+};
+
+template <>
+struct Schema<WaitlistRequest> {
+    static constexpr auto fields = make_tuple(
+        field("requestId", &WaitlistRequest::requestId),
+        field("customerId", &WaitlistRequest::customerId),
+        field("type", &WaitlistRequest::type),
+        field("guests", &WaitlistRequest::guests),
+        field("checkInDate", &WaitlistRequest::checkInDate, FieldKind::Date),
+        field("checkOutDate", &WaitlistRequest::checkOutDate, FieldKind::Date),
+        field("requestedAt", &WaitlistRequest::requestedAt, FieldKind::Timestamp),
+        field("status", &WaitlistRequest::status),
+        field("reservationId", &WaitlistRequest::reservationId));
+};
+
+// Every request ever queued, with the waiting ones indexed by room type and
+// check-in day. A match only has to look at the check-in days that can still
+// reach the freed nights, so its cost follows the requests around those
+// dates rather than the length of the list.
+class Waitlist {
+private:
+    vector<WaitlistRequest> requests;                   // In request order
+    map<int, vector<int>> waitingByDay[ROOM_TYPE_SLOTS]; // Check-in day -> positions in requests
+    int longestStay[ROOM_TYPE_SLOTS];                   // Nights, over waiting requests ever indexed
+
+    int positionOf(int requestId) const;
+    void index(int position);
+    void unindex(int position);
+    bool close(int requestId, WaitlistStatus status);
+
+public:
+    Waitlist();
+
+    // Replaces the list, e.g. after loading it from disk
+    void assign(const vector<WaitlistRequest>& loaded);
+    void add(const WaitlistRequest& request);
+    const WaitlistRequest* find(int requestId) const;
+    const vector<WaitlistRequest>& getRequests() const;
+    int getWaitingCount() const;
+
+    bool markFilled(int requestId, int reservationId);
+    bool withdraw(int requestId);
+    int expire(int todayEpochDay);
+
+    // Best waiting request for a room of this type and capacity that is free
+    // on the nights [freeFrom, freeTo) and has just given up [firstDay, endDay):
+    // the one taking most of the given-up nights, then the longest stay, then
+    // the earliest queued. Returns its request ID, or 0 if none fits.
+    int match(RoomType type, int capacity, int freeFrom, int freeTo, int firstDay, int endDay) const;
+};
+
+#endif // WAITLIST_H
@@ -9,7 +9,7 @@ echo.
 REM Set compiler flags
 set COMPILER_FLAGS=/std:c++latest /EHsc /W3 /D_CRT_SECURE_NO_WARNINGS
 set INCLUDE_DIRS=/I. /I./include
-set SOURCE_FILES=src/Bill.cpp src/Customer.cpp src/Database.cpp src/Employee.cpp src/Hotel.cpp src/main.cpp src/Reservation.cpp src/Room.cpp src/Utils.cpp
+set SOURCE_FILES=src/AuditTrail.cpp src/Bill.cpp src/BookingService.cpp src/CommandProcessor.cpp src/Customer.cpp src/Database.cpp src/DatabaseSnapshot.cpp src/Employee.cpp src/Hotel.cpp src/KpiCube.cpp src/Logger.cpp src/main.cpp src/OccupancyAnalytics.cpp src/PaceForecast.cpp src/PricingEngine.cpp src/RateCalendar.cpp src/ReportWriter.cpp src/Reservation.cpp src/RevenueLedger.cpp src/Room.cpp src/RoomAssigner.cpp src/RoomBlock.cpp src/RoomPopularity.cpp src/Scheduler.cpp src/ScriptRunner.cpp src/TableLock.cpp src/ThreadPool.cpp src/TimerWheel.cpp src/Utils.cpp src/Waitlist.cpp
 set OUTPUT_FILE=hotel_system.exe
 
 echo Compiling with MSVC...
@@ -26,12 +26,33 @@ cl.exe ^
   /O2 ^
   /D_CRT_SECURE_NO_WARNINGS ^
   src/Utils.cpp ^
+  src/Logger.cpp ^
+  src/AuditTrail.cpp ^
+  src/ThreadPool.cpp ^
+  src/TimerWheel.cpp ^
+  src/Scheduler.cpp ^
+  src/TableLock.cpp ^
   src/Room.cpp ^
   src/Customer.cpp ^
   src/Employee.cpp ^
   src/Reservation.cpp ^
+  src/RoomBlock.cpp ^
+  src/Waitlist.cpp ^
   src/Bill.cpp ^
+  src/RevenueLedger.cpp ^
+  src/OccupancyAnalytics.cpp ^
+  src/KpiCube.cpp ^
+  src/ReportWriter.cpp ^
+  src/RoomPopularity.cpp ^
+  src/PaceForecast.cpp ^
+  src/RateCalendar.cpp ^
+  src/PricingEngine.cpp ^
+  src/RoomAssigner.cpp ^
+  src/DatabaseSnapshot.cpp ^
   src/Database.cpp ^
+  src/CommandProcessor.cpp ^
+  src/BookingService.cpp ^
+  src/ScriptRunner.cpp ^
   src/Hotel.cpp ^
   src/main.cpp ^
   /Fe:hotel_system.exe
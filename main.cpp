@@ -8,6 +8,7 @@
 #include <filesystem>
 #include <vector>
 #include <memory>
+#include <iomanip>
 #include "Constants.h"
 #include "Exceptions.h"
 #include "Database.h"
@@ -17,6 +18,9 @@
 #include "Reservation.h"
 #include "Bill.h"
 #include "Employee.h"
+#include "BookingService.h"
+#include "ScriptRunner.h"
+#include <csignal>
 
 using namespace std;
 namespace fs = std::filesystem;
@@ -27,9 +31,29 @@ void runSystemDiagnostics();
 void createRequiredDirectories();
 void checkSystemRequirements();
 void handleCriticalError(const HotelException& e);
+int runBookingService(const string& socketPath);
+int runLoadTest(const string& socketPath, int clients, int requestsPerClient);
+int runScript(const string& scriptPath, int batchSize);
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
+        // Headless modes skip the interactive front end
+        string mode = argc > 1 ? argv[1] : "";
+        string socketPath = argc > 2 ? argv[2] : BookingService::DEFAULT_SOCKET;
+        if (mode == "--serve") {
+            createRequiredDirectories();
+            return runBookingService(socketPath);
+        }
+        if (mode == "--loadgen") {
+            return runLoadTest(socketPath, argc > 3 ? atoi(argv[3]) : 8, argc > 4 ? atoi(argv[4]) : 1000);
+        }
+        if (mode == "--script") {
+            // "-" or no path reads the script from stdin
+            createRequiredDirectories();
+            return runScript(argc > 2 ? argv[2] : "-",
+                             argc > 3 ? atoi(argv[3]) : ScriptRunner::DEFAULT_BATCH_SIZE);
+        }
+        
         // Display welcome screen
         showWelcomeScreen();
         
@@ -80,6 +104,72 @@ int main() {
     }
 }
 
+static BookingService* activeService = nullptr;
+
+static void stopBookingService(int) {
+    if (activeService) activeService->stop();
+}
+
+int runBookingService(const string& socketPath) {
+    Database database;
+    BookingService service(database, socketPath);
+    activeService = &service;
+    signal(SIGINT, stopBookingService);
+    signal(SIGTERM, stopBookingService);
+    
+    std::cout << HotelConstants::HOTEL_NAME << " booking service listening on " << socketPath << "\n";
+    std::cout << "Press Ctrl+C to stop.\n";
+    service.run();
+    activeService = nullptr;
+    
+    ServiceStats stats = service.getStats();
+    std::cout << "\nServed " << stats.requests << " requests (" << stats.errors << " errors) over "
+              << stats.connections << " connections\n";
+    return 0;
+}
+
+int runLoadTest(const string& socketPath, int clients, int requestsPerClient) {
+    std::cout << "Load test: " << clients << " clients x " << requestsPerClient
+              << " requests against " << socketPath << "\n";
+    LoadReport report = runLoadGenerator(socketPath, clients, requestsPerClient);
+    std::cout << "Requests:     " << report.requests << " (" << report.errors << " errors)\n";
+    std::cout << "Elapsed:      " << report.seconds << " s\n";
+    std::cout << "Throughput:   " << static_cast<long long>(report.requestsPerSecond) << " requests/s\n";
+    std::cout << "Latency p50:  " << report.p50Micros << " us\n";
+    std::cout << "Latency p99:  " << report.p99Micros << " us\n";
+    std::cout << "Latency max:  " << report.maxMicros << " us\n";
+    return report.errors == 0 ? 0 : 1;
+}
+
+int runScript(const string& scriptPath, int batchSize) {
+    ifstream file;
+    if (scriptPath != "-") {
+        file.open(scriptPath);
+        if (!file.is_open()) throw FileNotFoundException(scriptPath);
+    }
+    
+    Database database;
+    ScriptRunner runner(database, batchSize);
+    ScriptReport report = runner.run(scriptPath == "-" ? std::cin : file, std::cout);
+    
+    std::cout << "\nCommands:     " << report.commands << " (" << report.errors << " errors) in "
+              << report.batches << " batches\n";
+    std::cout << "Elapsed:      " << report.seconds << " s, " << report.commitSeconds << " s writing "
+              << report.filesWritten << " files\n";
+    if (report.seconds > 0) {
+        std::cout << "Throughput:   " << static_cast<long long>(report.commands / report.seconds) << " commands/s\n";
+    }
+    std::cout << "\n" << left << setw(16) << "Command" << right << setw(10) << "Count" << setw(8) << "Errors"
+              << setw(12) << "Total ms" << setw(10) << "Avg us" << "\n";
+    std::cout << string(56, '-') << "\n";
+    for (const auto& timing : report.timings) {
+        std::cout << left << setw(16) << timing.command << right << setw(10) << timing.count
+                  << setw(8) << timing.errors << setw(12) << fixed << setprecision(1) << timing.micros / 1000
+                  << setw(10) << static_cast<long long>(timing.micros / timing.count) << "\n";
+    }
+    return report.errors == 0 ? 0 : 1;
+}
+
 void showWelcomeScreen() {
     Utils::clearScreen();
     
@@ -0,0 +1,221 @@
+#include "AuditTrail.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <cstdio>
+#include <chrono>
+
+using namespace std;
+
+static const string TEST_TRAIL = "logs/test_audit_trail.log";
+
+static void flipByte(const string& path, long offset) {
+    fstream file(path, ios::in | ios::out | ios::binary);
+    file.seekg(offset);
+    char byte = 0;
+    file.get(byte);
+    file.seekp(offset);
+    file.put(static_cast<char>(byte ^ 0x01));
+}
+
+void testAuditTrail() {
+    cout << "Testing Audit Trail...\n";
+
+    Utils::createDirectory("logs");
+    remove(TEST_TRAIL.c_str());
+    time_t now = time(nullptr);
+    AuditHash head;
+    {
+        shared_ptr<AuditTrail> trail = AuditTrail::open(TEST_TRAIL);
+        assert(AuditTrail::open(TEST_TRAIL) == trail);
+        trail->record(201, AUDIT_PAYMENT, AUDIT_BILL, 5001, "paid=false", "paid=true method=Card");
+        trail->record(202, AUDIT_CANCELLATION, AUDIT_RESERVATION, 10001, "status=Confirmed", "status=Cancelled");
+        trail->record(201, AUDIT_RATE_CHANGE, AUDIT_ROOM_TYPE, SUITE, "factor=1.00", "factor=1.25");
+        trail->record(201, AUDIT_PAYMENT, AUDIT_BILL, 5001, "paid=true", "paid=true");
+        assert(trail->size() == 4);
+
+        vector<AuditEntry> bill = trail->findByEntity(AUDIT_BILL, 5001);
+        assert(bill.size() == 2);
+        assert(bill[0].sequence == 1 && bill[1].sequence == 4);
+        assert(bill[0].employeeId == 201 && bill[0].action == AUDIT_PAYMENT);
+        assert(bill[0].before == "paid=false" && bill[0].after == "paid=true method=Card");
+        assert(trail->findByEntity(AUDIT_BILL, 5002).empty());
+        cout << "✓ Actions on one record found by entity\n";
+
+        assert(trail->findByEmployee(201, now - 60, now + 60).size() == 3);
+        assert(trail->findByEmployee(202, now - 60, now + 60).size() == 1);
+        assert(trail->findByEmployee(201, now + 60, now + 120).empty());
+        cout << "✓ Actions by one employee found by time range\n";
+
+        AuditVerification check = trail->verify();
+        assert(check.intact && check.entries == 4);
+        head = trail->getHead();
+        assert(head == bill[1].hash);
+        cout << "✓ Hash chain verifies, head " << AuditTrail::hashToHex(head).substr(0, 16) << "...\n";
+    }
+
+    // A crash mid-append leaves part of an entry; it is cut off on open
+    {
+        ofstream file(TEST_TRAIL, ios::binary | ios::app);
+        file << "partial entry";
+    }
+    {
+        shared_ptr<AuditTrail> trail = AuditTrail::open(TEST_TRAIL);
+        assert(trail->size() == 4 && trail->getHead() == head);
+        trail->record(203, AUDIT_PASSWORD_CHANGE, AUDIT_EMPLOYEE, 203, "password=set", "password=changed");
+        assert(trail->findByEntity(AUDIT_EMPLOYEE, 203)[0].sequence == 5);
+        assert(trail->verify().intact);
+    }
+    cout << "✓ Reopened: index rebuilt, cut-off entry dropped, chain continues\n";
+
+    // Changing one byte of the second entry's text breaks it and everything after
+    const long SECOND_ENTRY = 30 + 10 + 21 + 32;    // Header, texts and hash of the first
+    flipByte(TEST_TRAIL, SECOND_ENTRY + 30 + 3);
+    {
+        shared_ptr<AuditTrail> trail = AuditTrail::open(TEST_TRAIL);
+        AuditVerification check = trail->verify();
+        assert(!check.intact && check.firstBroken == 2 && check.entries == 1);
+    }
+    cout << "✓ Edited entry detected\n";
+
+    // Database changes are recorded against the employee logged in
+    {
+        Database db;
+        AuditTrail& trail = db.getAuditTrail();
+        int today = Utils::getTodayEpochDay();
+        int room = db.addRoom(DELUXE, 140.0, 2);
+        // Ids come back after the data files are reset, so older runs may have entries on them
+        size_t roomBefore = trail.findByEntity(AUDIT_ROOM, room).size();
+        int paid = db.makeReservation(1001, room, Calendar::fromEpochDay(today + 40),
+                                      Calendar::fromEpochDay(today + 42), 2);
+        int otherRoom = db.addRoom(STANDARD, 90.0, 2);
+        int cancelled = db.makeReservation(1001, otherRoom, Calendar::fromEpochDay(today + 50),
+                                           Calendar::fromEpochDay(today + 51), 1);
+        size_t cancelledBefore = trail.findByEntity(AUDIT_RESERVATION, cancelled).size();
+
+        db.setActingEmployee(202);
+        int bill = db.createBill(paid);
+        size_t billBefore = trail.findByEntity(AUDIT_BILL, bill).size();
+        db.addBillItem(bill, "Spa", 80.0);
+        db.processPayment(bill, "Card");
+        db.cancelReservation(cancelled);
+        db.setRoomRate(room, Calendar::fromEpochDay(today + 60), Calendar::fromEpochDay(today + 61), 199.0);
+        db.modifyRoom(room, 150.0, {});
+        db.changeEmployeePassword(202, "default123", "changed123", "changed123");
+        bool caught = false;
+        try {
+            db.changeEmployeePassword(202, "wrong", "default123", "default123");
+        } catch (const AuthenticationException&) {
+            caught = true;
+        }
+        assert(caught);
+        db.changeEmployeePassword(202, "changed123", "default123", "default123");
+        db.setActingEmployee(0);
+
+        vector<AuditEntry> payments = trail.findByEntity(AUDIT_BILL, bill);
+        payments.erase(payments.begin(), payments.begin() + billBefore);
+        assert(payments.size() == 1 && payments[0].employeeId == 202);
+        assert(payments[0].before.find("paid=false") == 0 && payments[0].after.find("method=Card") != string::npos);
+        vector<AuditEntry> cancellations = trail.findByEntity(AUDIT_RESERVATION, cancelled);
+        cancellations.erase(cancellations.begin(), cancellations.begin() + cancelledBefore);
+        assert(cancellations.size() == 1 && cancellations[0].before.find("status=Confirmed") == 0);
+        vector<AuditEntry> roomChanges = trail.findByEntity(AUDIT_ROOM, room);
+        roomChanges.erase(roomChanges.begin(), roomChanges.begin() + roomBefore);
+        assert(roomChanges.size() == 2);
+        assert(roomChanges[0].action == AUDIT_RATE_CHANGE && roomChanges[1].action == AUDIT_PRICE_CHANGE);
+        assert(roomChanges[1].before == "price=$140.00" && roomChanges[1].after == "price=$150.00");
+        vector<AuditEntry> passwords = trail.findByEntity(AUDIT_EMPLOYEE, 202);
+        assert(passwords.size() >= 2 && passwords.back().after.find("default123") == string::npos);
+
+        time_t now = time(nullptr);
+        vector<AuditEntry> byEmployee = trail.findByEmployee(202, now - 60, now + 60);
+        assert(byEmployee.size() >= 6);
+        for (size_t i = 1; i < byEmployee.size(); i++) assert(byEmployee[i].sequence > byEmployee[i - 1].sequence);
+        cout << "✓ Payments, cancellations, passwords, rates and prices recorded with the employee\n";
+    }
+
+    // The front desk edits a room by passing back its current price or features
+    {
+        Database db;
+        AuditTrail& trail = db.getAuditTrail();
+        int room = db.addRoom(SUITE, 260.0, 3);
+        db.modifyRoom(room, 260.0, {"Balcony", "Sea view"});
+        size_t before = trail.findByEntity(AUDIT_ROOM, room).size();
+
+        db.setActingEmployee(203);
+        optional<Room> current = db.getRoom(room);
+        db.modifyRoom(room, 275.0, current->getFeatures());
+        assert(db.getRoom(room)->getFeatures() == vector<string>({"Balcony", "Sea view"}));
+        vector<AuditEntry> edits = trail.findByEntity(AUDIT_ROOM, room);
+        assert(edits.size() == before + 1);
+        assert(edits.back().action == AUDIT_PRICE_CHANGE && edits.back().employeeId == 203);
+        assert(edits.back().before == "price=$260.00" && edits.back().after == "price=$275.00");
+
+        // Features only: the price passed back is unchanged, so nothing is recorded
+        current = db.getRoom(room);
+        db.modifyRoom(room, current->getPricePerNight(), {"Balcony"});
+        db.setActingEmployee(0);
+        assert(db.getRoom(room)->getFeatures() == vector<string>({"Balcony"}));
+        assert(trail.findByEntity(AUDIT_ROOM, room).size() == before + 1);
+    }
+    cout << "✓ Room edits record a price change only when the price moves\n";
+
+    cout << "Audit Trail Tests: PASSED\n\n";
+}
+
+void benchmarkAuditTrail() {
+    cout << "Benchmarking Audit Trail...\n";
+
+    const int ENTRIES = 100000;
+    const int RESERVATIONS = 5000;
+    remove(TEST_TRAIL.c_str());
+    shared_ptr<AuditTrail> trail = AuditTrail::open(TEST_TRAIL);
+
+    auto start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < ENTRIES; i++) {
+        trail->record(201 + i % 10, AUDIT_CANCELLATION, AUDIT_RESERVATION, 10001 + i % RESERVATIONS,
+                      "status=Confirmed room=" + to_string(101 + i % 200), "status=Cancelled");
+    }
+    double recordNanos = chrono::duration<double, nano>(chrono::high_resolution_clock::now() - start).count();
+    trail->flush();
+    double writeMillis = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+
+    start = chrono::high_resolution_clock::now();
+    vector<AuditEntry> history = trail->findByEntity(AUDIT_RESERVATION, 10001 + RESERVATIONS / 2);
+    double indexedMicros = chrono::duration<double, micro>(chrono::high_resolution_clock::now() - start).count();
+    assert(history.size() == ENTRIES / RESERVATIONS);
+
+    start = chrono::high_resolution_clock::now();
+    AuditVerification check = trail->verify();
+    double scanMillis = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+    assert(check.intact && check.entries == ENTRIES);
+
+    cout << "✓ " << ENTRIES << " entries over " << RESERVATIONS << " reservations\n";
+    cout << "  record():              " << recordNanos / ENTRIES << " ns per entry\n";
+    cout << "  Hashed and written:    " << writeMillis << " ms\n";
+    cout << "  One reservation:       " << indexedMicros << " us, " << history.size() << " entries\n";
+    cout << "  Full scan (verify):    " << scanMillis << " ms\n";
+    cout << "Audit Trail Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     AUDIT TRAIL TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testAuditTrail();
+        benchmarkAuditTrail();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
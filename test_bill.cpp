@@ -0,0 +1,177 @@
+#include "Bill.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+using namespace std;
+
+// Counts every heap allocation made while the benchmarks run
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    if (void* p = malloc(size ? size : 1)) return p;
+    throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+void testDescriptionPool() {
+    cout << "Testing Description Pool...\n";
+
+    assert(DescriptionPool::size() > 0);
+    assert(DescriptionPool::find("Room Charge") == "Room Charge");
+    assert(DescriptionPool::find("Room Charge (3 nights)") == "Room Charge (3 nights)");
+    assert(DescriptionPool::find("Food - Coffee") == "Food - Coffee");
+    assert(DescriptionPool::find("Service - Laundry") == "Service - Laundry");
+    assert(DescriptionPool::find("Minibar Champagne").empty());
+    cout << "✓ Pooled descriptions found\n";
+
+    // Interned views point at the same storage
+    assert(DescriptionPool::find("Tea").data() == DescriptionPool::find(string("Tea")).data());
+    cout << "✓ Interned views are shared\n";
+
+    cout << "Description Pool Tests: PASSED\n\n";
+}
+
+void testBillItems() {
+    cout << "Testing Bill Items...\n";
+
+    Bill bill(5001, 10001);
+    bill.addRoomCharge(100.0, 3);
+    bill.addFoodCharge("Coffee", 4.0, 2);
+    bill.addServiceCharge("Laundry", 25.0);
+    bill.addItem("Minibar Champagne", 90.0);
+    assert(bill.getItems().size() == 4);
+    assert(bill.getItems()[0].getDescription() == "Room Charge (3 nights)");
+    assert(bill.getItems()[3].getDescription() == "Minibar Champagne");
+    assert(bill.calculateSubtotal() == 300.0 + 8.0 + 25.0 + 90.0);
+    cout << "✓ Items posted\n";
+
+    // Copies own their descriptions independently of the source bill
+    Bill copy(bill);
+    {
+        Bill temporary(bill);
+        copy = temporary;
+    }
+    assert(copy.getItems().size() == 4);
+    assert(copy.getItems()[3].getDescription() == "Minibar Champagne");
+    assert(copy.calculateTotal() == bill.calculateTotal());
+    cout << "✓ Copies survive the source arena\n";
+
+    Bill moved(std::move(copy));
+    assert(moved.getItems().size() == 4);
+    moved.removeItem(0);
+    assert(moved.getItems().size() == 3);
+    // The moved-from bill is left empty but still takes items
+    assert(copy.getItems().empty());
+    copy.addItem("Late checkout", 30.0);
+    assert(copy.getItems().size() == 1 && copy.calculateSubtotal() == 30.0);
+    moved = std::move(copy);
+    assert(moved.getItems().size() == 1 && copy.getItems().empty());
+    copy.addItem("Parking", 15.0);
+    assert(moved.getItems()[0].getDescription() == "Late checkout" && copy.getItems().size() == 1);
+    cout << "✓ Move and remove passed\n";
+
+    // Items point into their bill's arena, so only a bill makes or holds them
+    static_assert(!is_copy_constructible<BillItem>::value, "bill items must not be copied out");
+    static_assert(!is_constructible<BillItem, string_view, double, int>::value, "only bills make items");
+
+    try {
+        bill.addItem("", 10.0);
+        cout << "✗ Should have thrown exception for empty description\n";
+        assert(false);
+    } catch (const ValidationException&) {
+        cout << "✓ Empty description exception caught\n";
+    }
+
+    cout << "Bill Item Tests: PASSED\n\n";
+}
+
+// Previous layout: one std::string per line in a plain vector
+struct LegacyItem {
+    string description;
+    double amount;
+    int quantity;
+};
+
+void benchmarkPosting() {
+    cout << "Benchmarking Bill Posting...\n";
+
+    const int BILLS = 20000;
+    const int LINES = 12;
+    const string foodItem = "Room Service Burger";
+    const string custom = "Minibar - Imported Chocolate";
+    double checksum = 0;
+
+    size_t before = allocationCount;
+    auto start = chrono::high_resolution_clock::now();
+    for (int b = 0; b < BILLS; b++) {
+        vector<LegacyItem> items;
+        for (int i = 0; i < LINES; i++) {
+            switch (i % 3) {
+                case 0: items.push_back({"Room Charge", 100.0, 1}); break;
+                case 1: items.push_back({"Food - " + foodItem, 18.0, 1}); break;
+                default: items.push_back({custom, 7.5, 2}); break;
+            }
+        }
+        checksum += items.back().amount;
+    }
+    auto legacyTime = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+    size_t legacyAllocations = allocationCount - before;
+
+    before = allocationCount;
+    start = chrono::high_resolution_clock::now();
+    for (int b = 0; b < BILLS; b++) {
+        Bill bill(5001 + b, 10001);
+        for (int i = 0; i < LINES; i++) {
+            switch (i % 3) {
+                case 0: bill.addItem("Room Charge", 100.0); break;
+                case 1: bill.addFoodCharge(foodItem, 18.0); break;
+                default: bill.addItem(custom, 7.5, 2); break;
+            }
+        }
+        checksum += bill.calculateSubtotal();
+    }
+    auto arenaTime = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+    size_t arenaAllocations = allocationCount - before;
+
+    cout << "✓ " << BILLS << " bills x " << LINES << " lines\n";
+    cout << "  vector<string> items: " << legacyAllocations << " allocations, "
+         << legacyTime.count() << " us\n";
+    cout << "  arena + interning:    " << arenaAllocations << " allocations, "
+         << arenaTime.count() << " us\n";
+    cout << "  (checksum " << checksum << ")\n";
+    assert(arenaAllocations < legacyAllocations);
+
+    cout << "Bill Posting Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     BILL CLASS UNIT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testDescriptionPool();
+        testBillItems();
+        benchmarkPosting();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
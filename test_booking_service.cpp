@@ -0,0 +1,195 @@
+#include "BookingService.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+using namespace std;
+
+static const string SOCKET_PATH = "test_booking.sock";
+
+static bool ok(const string& reply) {
+    return reply.compare(0, 2, "OK") == 0;
+}
+
+static int idOf(const string& reply) {
+    return stoi(reply.substr(3));
+}
+
+static string day(int epochDay) {
+    return Utils::formatDate(Calendar::fromEpochDay(epochDay));
+}
+
+void testProtocol() {
+    cout << "Testing Booking Protocol...\n";
+
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    int room = db.addRoom(SUITE, 310.0, 2);
+    BookingService service(db, SOCKET_PATH, 2);
+
+    assert(service.handle("PING") == "OK PONG");
+    istringstream roomReply(service.handle("ROOM " + to_string(room)));
+    string status;
+    int number, type, state, capacity;
+    double price;
+    roomReply >> status >> number >> type >> state >> price >> capacity;
+    assert(status == "OK" && number == room && type == SUITE && state == AVAILABLE);
+    assert(price == 310.0 && capacity == 2);
+    cout << "✓ Room lookup\n";
+
+    // Rooms from earlier runs stay on file, so the new suite is made the cheapest for those nights
+    string stay = day(today + 360) + " " + day(today + 362) + " 2";
+    string cheapest = service.handle("AVAIL 3 " + stay + " 1");
+    assert(ok(cheapest) && cheapest.find(':') != string::npos);
+    db.setRoomRate(room, Utils::parseDate(day(today + 360)), Utils::parseDate(day(today + 361)),
+                   stod(cheapest.substr(cheapest.find(':') + 1)) / 4);
+    string avail = service.handle("AVAIL 3 " + stay + " 1");
+    assert(avail.compare(0, 4 + to_string(room).size(), "OK " + to_string(room) + ":") == 0);
+    string many = service.handle("AVAIL 3 " + stay + " 1000");
+    assert(ok(many) && count(many.begin(), many.end(), ':') <= 100);
+    db.clearRoomRates(room);
+
+    string booked = service.handle("BOOK 1001 " + to_string(room) + " " + day(today) + " " + day(today + 2) + " 2");
+    assert(ok(booked));
+    int reservation = idOf(booked);
+    string lookup = service.handle("RES " + to_string(reservation));
+    assert(lookup.find(day(today) + " " + day(today + 2) + " " + to_string(CONFIRMED)) != string::npos);
+    assert(!ok(service.handle("BOOK 1001 " + to_string(room) + " " + day(today) + " " + day(today + 2) + " 2")));
+    cout << "✓ Availability and booking\n";
+
+    assert(service.handle("CHECKIN " + to_string(reservation)) == "OK");
+    string charged = service.handle("CHARGE " + to_string(reservation) + " 40 Room service dinner");
+    assert(ok(charged));
+    assert(service.handle("CHARGE " + to_string(reservation) + " 10 Minibar") == charged);
+    Bill* bill = db.findBillByReservation(reservation);
+    assert(bill && bill->getItems().size() == 2 && bill->getItems()[0].getDescription() == "Room service dinner");
+    string paid = service.handle("PAY " + to_string(reservation) + " Card");
+    assert(ok(paid) && stod(paid.substr(3)) > 50.0);
+    assert(db.findBillByReservation(reservation)->getIsPaid());
+    assert(service.handle("CHECKOUT " + to_string(reservation)) == "OK");
+    assert(db.findRoom(room)->getStatus() == AVAILABLE);
+    cout << "✓ Check-in, charges, payment and check-out\n";
+
+    string later = service.handle("BOOK 1001 " + to_string(room) + " " + day(today + 10) + " " + day(today + 12) + " 2");
+    assert(ok(later));
+    vector<string> charges(4);
+    vector<thread> chargers;
+    for (size_t i = 0; i < charges.size(); i++) {
+        chargers.emplace_back([&, i]() {
+            charges[i] = service.handle("CHARGE " + later.substr(3) + " 5 Early arrival");
+        });
+    }
+    for (auto& t : chargers) t.join();
+    for (const auto& reply : charges) assert(ok(reply) && reply == charges[0]);
+    assert(db.findBillByReservation(idOf(later))->getItems().size() == charges.size());
+    assert(service.handle("CANCEL " + later.substr(3)) == "OK");
+    cout << "✓ Racing charges share one bill\n";
+
+    ServiceStats before = service.getStats();
+    assert(service.handle("FLY me to the moon").compare(0, 4, "ERR ") == 0);
+    assert(service.handle("ROOM abc").compare(0, 4, "ERR ") == 0);
+    assert(service.handle("BOOK 1001").compare(0, 4, "ERR ") == 0);
+    assert(service.handle("AVAIL 3 2025-13-40 2025-13-41 1").compare(0, 4, "ERR ") == 0);
+    assert(service.handle("CHECKOUT " + to_string(reservation)).compare(0, 4, "ERR ") == 0);
+    assert(service.getStats().errors == before.errors + 5);
+    cout << "✓ Bad requests answered with ERR\n";
+
+    cout << "Booking Protocol Tests: PASSED\n\n";
+}
+
+void testSocketService() {
+    cout << "Testing Socket Service...\n";
+
+    Database db;
+    string room = to_string(db.addRoom(STANDARD, 110.0, 2));
+    BookingService service(db, SOCKET_PATH, 4);
+    thread loop([&]() { service.run(); });
+    this_thread::sleep_for(chrono::milliseconds(100));
+
+    {
+        BookingClient client(SOCKET_PATH);
+        assert(client.request("PING") == "OK PONG");
+        assert(client.request("ROOM " + room).compare(0, 3 + room.size(), "OK " + room) == 0);
+        assert(client.request("NOPE").compare(0, 4, "ERR ") == 0);
+        assert(client.request("PING") == "OK PONG");
+    }
+    cout << "✓ Requests answered in order on one connection\n";
+
+    const int CLIENTS = 8;
+    vector<thread> clients;
+    vector<int> answered(CLIENTS, 0);
+    for (int c = 0; c < CLIENTS; c++) {
+        clients.emplace_back([&, c]() {
+            BookingClient client(SOCKET_PATH);
+            for (int i = 0; i < 50; i++) {
+                if (client.request(i % 2 ? "PING" : "ROOM " + room).compare(0, 2, "OK") == 0) answered[c]++;
+            }
+        });
+    }
+    for (auto& t : clients) t.join();
+    for (int count : answered) assert(count == 50);
+    cout << "✓ " << CLIENTS << " clients served at once\n";
+
+    service.stop();
+    loop.join();
+    ServiceStats stats = service.getStats();
+    assert(stats.connections >= CLIENTS + 1);
+    assert(stats.requests >= CLIENTS * 50 + 4);
+    bool caught = false;
+    try {
+        BookingClient late(SOCKET_PATH);
+    } catch (const SystemException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Stops cleanly and removes its socket\n";
+
+    cout << "Socket Service Tests: PASSED\n\n";
+}
+
+void benchmarkService() {
+    cout << "Benchmarking Booking Service...\n";
+
+    Database db;
+    BookingService service(db, SOCKET_PATH);
+    thread loop([&]() { service.run(); });
+    this_thread::sleep_for(chrono::milliseconds(100));
+
+    LoadReport report = runLoadGenerator(SOCKET_PATH, 8, 300);
+    service.stop();
+    loop.join();
+
+    assert(report.requests == 8 * 300);
+    assert(report.errors == 0);
+    cout << "✓ " << report.clients << " clients, " << report.requests << " requests\n";
+    cout << "  Throughput:  " << static_cast<long long>(report.requestsPerSecond) << " requests/s\n";
+    cout << "  Latency p50: " << report.p50Micros << " us\n";
+    cout << "  Latency p99: " << report.p99Micros << " us\n";
+    cout << "Booking Service Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     BOOKING SERVICE TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testProtocol();
+        testSocketService();
+        benchmarkService();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,161 @@
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+
+using namespace std;
+
+static void removeDataFiles() {
+    const char* files[] = {"data/rooms.dat", "data/customers.dat", "data/reservations.dat",
+                           "data/employees.dat", "data/bills.dat"};
+    for (const char* file : files) remove(file);
+}
+
+// Recounts everything the slow way, as showDashboard used to
+static DashboardStats recount(Database& db) {
+    DashboardStats stats;
+    stats.totalRooms = db.getRoomCount();
+    for (int number = 101; number < 101 + db.getRoomCount(); number++) {
+        Room* room = db.findRoom(number);
+        if (!room) continue;
+        if (room->getStatus() == AVAILABLE) stats.availableRooms++;
+        if (room->getStatus() == OCCUPIED) stats.occupiedRooms++;
+        if (room->getStatus() == RESERVED) stats.reservedRooms++;
+        if (room->getStatus() == MAINTENANCE) stats.maintenanceRooms++;
+    }
+    stats.activeReservations = static_cast<int>(db.findActiveReservations().size());
+    stats.todayCheckIns = static_cast<int>(db.findTodayCheckIns().size());
+    stats.todayCheckOuts = static_cast<int>(db.findTodayCheckOuts().size());
+    return stats;
+}
+
+static void assertMatches(Database& db) {
+    DashboardStats fast = db.getDashboardStats();
+    DashboardStats slow = recount(db);
+    assert(fast.totalRooms == slow.totalRooms);
+    assert(fast.availableRooms == slow.availableRooms);
+    assert(fast.occupiedRooms == slow.occupiedRooms);
+    assert(fast.reservedRooms == slow.reservedRooms);
+    assert(fast.maintenanceRooms == slow.maintenanceRooms);
+    assert(fast.activeReservations == slow.activeReservations);
+    assert(fast.todayCheckIns == slow.todayCheckIns);
+    assert(fast.todayCheckOuts == slow.todayCheckOuts);
+}
+
+void testCountersFollowTransitions() {
+    cout << "Testing Dashboard Counters...\n";
+
+    Database db;
+    assertMatches(db);
+    cout << "✓ Sample data counters passed\n";
+
+    int today = Utils::getTodayEpochDay();
+    int roomA = db.addRoom(STANDARD, 110.0, 2);
+    int roomB = db.addRoom(DELUXE, 210.0, 3);
+    int roomC = db.addRoom(SUITE, 400.0, 4);
+    assertMatches(db);
+
+    int arriving = db.makeReservation(1001, roomA, Calendar::fromEpochDay(today),
+                                      Calendar::fromEpochDay(today + 2), 2);
+    int staying = db.makeReservation(1002, roomB, Calendar::fromEpochDay(today - 1),
+                                     Calendar::fromEpochDay(today + 1), 2);
+    int leaving = db.makeReservation(1003, roomC, Calendar::fromEpochDay(today - 3),
+                                     Calendar::fromEpochDay(today), 2);
+    assertMatches(db);
+    assert(db.getDashboardStats().todayCheckIns >= 1);
+    cout << "✓ New reservations counted\n";
+
+    assert(db.checkIn(staying));
+    assert(db.checkIn(leaving));
+    assertMatches(db);
+    assert(db.getDashboardStats().todayCheckOuts >= 1);
+    assert(db.checkOut(leaving));
+    assert(db.checkIn(arriving));
+    assertMatches(db);
+    cout << "✓ Check-in and check-out counted\n";
+
+    assert(db.changeReservationDates(arriving, Calendar::fromEpochDay(today),
+                                     Calendar::fromEpochDay(today + 4)));
+    assert(!db.cancelReservation(staying));
+    db.updateRoomStatus(roomC, MAINTENANCE);
+    assertMatches(db);
+    cout << "✓ Date changes and room status counted\n";
+
+    try {
+        db.changeReservationDates(arriving, Calendar::fromEpochDay(today + 4),
+                                  Calendar::fromEpochDay(today));
+        cout << "✗ Should have thrown exception for reversed dates\n";
+        assert(false);
+    } catch (const ValidationException&) {
+        assertMatches(db);
+        cout << "✓ Failed date change leaves counters intact\n";
+    }
+
+    Database reloaded;
+    assertMatches(reloaded);
+    cout << "✓ Counters rebuilt on load\n";
+
+    cout << "Dashboard Counter Tests: PASSED\n\n";
+}
+
+void benchmarkDashboard() {
+    cout << "Benchmarking Dashboard Refresh...\n";
+
+    const int RENDERS = 2000;
+    const int ROOMS = 300;
+    Database db;
+    int today = Utils::getTodayEpochDay();
+    for (int i = 0; i < ROOMS; i++) {
+        int room = db.addRoom(STANDARD, 100.0 + i % 50, 2);
+        db.makeReservation(1001, room, Calendar::fromEpochDay(today - i % 7),
+                           Calendar::fromEpochDay(today + 1 + i % 5), 2);
+    }
+    long long checksum = 0;
+
+    auto start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < RENDERS; i++) {
+        checksum += db.getRoomCount() + static_cast<int>(db.findTodayCheckIns().size()) +
+                    static_cast<int>(db.findActiveReservations().size());
+    }
+    auto scan = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < RENDERS; i++) {
+        DashboardStats stats = db.getDashboardStats();
+        checksum += stats.totalRooms + stats.todayCheckIns + stats.activeReservations;
+    }
+    auto counters = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    cout << "✓ " << RENDERS << " refreshes over " << db.getReservationCount() << " reservations\n";
+    cout << "  table scans: " << scan.count() << " us\n";
+    cout << "  counters:    " << counters.count() << " us\n";
+    cout << "  (checksum " << checksum << ")\n";
+
+    cout << "Dashboard Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     DASHBOARD STATISTICS TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        removeDataFiles();
+        testCountersFollowTransitions();
+        benchmarkDashboard();
+        removeDataFiles();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
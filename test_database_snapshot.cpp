@@ -0,0 +1,186 @@
+#include "Database.h"
+#include "DatabaseSnapshot.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+
+using namespace std;
+
+static long long microsSince(chrono::high_resolution_clock::time_point start) {
+    return chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - start).count();
+}
+
+static long long percentile(vector<long long> samples, double p) {
+    if (samples.empty()) return 0;
+    sort(samples.begin(), samples.end());
+    return samples[min(samples.size() - 1, static_cast<size_t>(p * samples.size()))];
+}
+
+void testSnapshot() {
+    cout << "Testing Database Snapshots...\n";
+
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    int room = db.addRoom(SUITE, 290.0, 2);
+
+    shared_ptr<const DatabaseSnapshot> before = db.snapshot();
+    size_t reservations = before->reservations->size();
+    int id = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                Calendar::fromEpochDay(today + 3), 2);
+    db.checkIn(id);
+    int bill = db.createBill(id);
+    db.addBillItem(bill, "Room Service", 45.0);
+
+    assert(before->reservations->size() == reservations);
+    auto inBefore = find_if(before->rooms->begin(), before->rooms->end(),
+                            [room](const Room& r) { return r.getRoomNumber() == room; });
+    assert(inBefore != before->rooms->end() && inBefore->getStatus() == AVAILABLE);
+    cout << "✓ A snapshot keeps its view while writers carry on\n";
+
+    shared_ptr<const DatabaseSnapshot> after = db.snapshot();
+    assert(after->reservations->size() == reservations + 1);
+    assert(after->rooms != before->rooms && after->bills != before->bills);
+    assert(after->employees == before->employees);
+    assert(after->customers == before->customers);
+
+    shared_ptr<const DatabaseSnapshot> again = db.snapshot();
+    assert(again->rooms == after->rooms && again->reservations == after->reservations);
+    assert(again->bills == after->bills && again->kpiCube == after->kpiCube);
+    cout << "✓ Unwritten tables are shared between snapshots, written ones copied\n";
+
+    weak_ptr<const vector<Reservation>> oldReservations = before->reservations;
+    before.reset();
+    assert(oldReservations.expired());
+    cout << "✓ Old versions are freed with their last snapshot\n";
+
+    CustomerReport report = after->getCustomerReport(5);
+    assert(report.totalCustomers == static_cast<int>(after->customers->size()));
+    assert(report.checkedInGuests >= 1);
+    assert(after->getOccupancyRate().size() == PRESIDENTIAL);
+    db.checkOut(id);
+
+    cout << "Database Snapshot Tests: PASSED\n\n";
+}
+
+void testReportsDuringWrites() {
+    cout << "Testing Reports During Writes...\n";
+
+    const int STAYS = 20;
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    int room = db.addRoom(DELUXE, 175.0, 2);
+
+    atomic<bool> writing(true);
+    atomic<int> inconsistent(0), reports(0);
+    thread reporter([&]() {
+        while (writing) {
+            shared_ptr<const DatabaseSnapshot> view = db.snapshot();
+            // A checked-in stay and its occupied room are written under one lock,
+            // so a snapshot sees both or neither
+            int checkedIn = 0, occupied = 0;
+            for (const auto& reservation : *view->reservations) {
+                if (reservation.getRoomNumber() == room && reservation.getStatus() == CHECKED_IN) checkedIn++;
+            }
+            for (const auto& r : *view->rooms) {
+                if (r.getRoomNumber() == room && r.getStatus() == OCCUPIED) occupied++;
+            }
+            if (checkedIn != occupied) inconsistent++;
+            view->getCustomerReport(10);
+            reports++;
+        }
+    });
+
+    for (int stay = 0; stay < STAYS; stay++) {
+        int id = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                    Calendar::fromEpochDay(today + 1), 2);
+        db.checkIn(id);
+        db.addBillItem(db.createBill(id), "Minibar", 12.0);
+        db.checkOut(id);
+    }
+    writing = false;
+    reporter.join();
+
+    assert(inconsistent == 0);
+    cout << "✓ " << STAYS << " stays written alongside " << reports << " consistent reports\n";
+    cout << "Reports During Writes Tests: PASSED\n\n";
+}
+
+void benchmarkSnapshots() {
+    cout << "Benchmarking Reports Against Writers...\n";
+
+    const int STAYS = 40;
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    int room = db.addRoom(STANDARD, 120.0, 2);
+
+    // Writer latency of check-in and adding a charge, with or without a
+    // reporter running exports and the customer report next to it
+    auto run = [&](bool withReports, vector<long long>& reportMicros) {
+        atomic<bool> writing(true);
+        thread reporter([&]() {
+            while (withReports && writing) {
+                auto start = chrono::high_resolution_clock::now();
+                db.exportReservations(EXPORT_CSV);
+                db.getCustomerReport(10);
+                db.getOccupancyReport(Calendar::fromEpochDay(today - 30), Calendar::fromEpochDay(today));
+                reportMicros.push_back(microsSince(start));
+            }
+        });
+
+        vector<long long> writeMicros;
+        for (int stay = 0; stay < STAYS; stay++) {
+            int id = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                        Calendar::fromEpochDay(today + 1), 2);
+            auto start = chrono::high_resolution_clock::now();
+            db.checkIn(id);
+            writeMicros.push_back(microsSince(start));
+            int bill = db.createBill(id);
+            start = chrono::high_resolution_clock::now();
+            db.addBillItem(bill, "Room Service", 25.0);
+            writeMicros.push_back(microsSince(start));
+            db.checkOut(id);
+        }
+        writing = false;
+        reporter.join();
+        return writeMicros;
+    };
+
+    vector<long long> reportMicros, unused;
+    vector<long long> quiet = run(false, unused);
+    vector<long long> loaded = run(true, reportMicros);
+
+    cout << "✓ " << STAYS << " stays over " << db.getReservationCount() << " reservations, "
+         << reportMicros.size() << " reports alongside\n";
+    cout << "  Hardware threads:             " << thread::hardware_concurrency() << "\n";
+    cout << "  Report p50:                   " << percentile(reportMicros, 0.50) << " us\n";
+    cout << "  Writer p50/p99, no reports:   " << percentile(quiet, 0.50) << " / "
+         << percentile(quiet, 0.99) << " us\n";
+    cout << "  Writer p50/p99, with reports: " << percentile(loaded, 0.50) << " / "
+         << percentile(loaded, 0.99) << " us\n";
+    cout << "Reports Against Writers Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     DATABASE SNAPSHOT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testSnapshot();
+        testReportsDuringWrites();
+        benchmarkSnapshots();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
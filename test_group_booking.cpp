@@ -0,0 +1,264 @@
+#include "Database.h"
+#include "RoomBlock.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <set>
+
+using namespace std;
+
+// Rooms of one type free on every night of the stay, cheapest first
+static vector<RoomStayCost> freeRooms(Database& db, RoomType type, time_t checkIn, time_t checkOut, int guests) {
+    vector<RoomStayCost> result;
+    for (const auto& room : db.findCheapestRooms(checkIn, checkOut, guests, db.getRoomCount())) {
+        if (room.type == type) result.push_back(room);
+    }
+    return result;
+}
+
+static bool contains(const vector<RoomStayCost>& rooms, int roomNumber) {
+    for (const auto& room : rooms) {
+        if (room.roomNumber == roomNumber) return true;
+    }
+    return false;
+}
+
+void testGroupReservation() {
+    cout << "Testing Group Reservations...\n";
+
+    int today = Utils::getTodayEpochDay();
+    time_t checkIn = Calendar::fromEpochDay(today + 330);
+    time_t checkOut = Calendar::fromEpochDay(today + 333);
+    Database db;
+    for (int i = 0; i < 3; i++) db.addRoom(PRESIDENTIAL, 900.0 + i, 2);
+
+    vector<RoomStayCost> presidential = freeRooms(db, PRESIDENTIAL, checkIn, checkOut, 2);
+    int reservationCount = db.getReservationCount();
+    int reservedRooms = db.getDashboardStats().reservedRooms;
+    assert(presidential.size() >= 3);
+
+    // One line that cannot be filled fails the whole group
+    bool caught = false;
+    try {
+        db.makeGroupReservation(1001, {{STANDARD, 1, 1}, {PRESIDENTIAL, static_cast<int>(presidential.size()) + 1, 2}},
+                                checkIn, checkOut);
+    } catch (const RoomException&) {
+        caught = true;
+    }
+    assert(caught);
+    assert(db.getReservationCount() == reservationCount);
+    assert(db.getDashboardStats().reservedRooms == reservedRooms);
+    cout << "✓ A group that does not fit books nothing\n";
+
+    vector<int> ids = db.makeGroupReservation(1001, {{PRESIDENTIAL, 2, 2}, {STANDARD, 1, 1}},
+                                              checkIn, checkOut, "Wedding party");
+    assert(ids.size() == 3);
+    assert(db.getReservationCount() == reservationCount + 3);
+    set<int> roomsUsed;
+    for (size_t i = 0; i < ids.size(); i++) {
+        Reservation* reservation = db.findReservation(ids[i]);
+        assert(reservation && reservation->getStatus() == CONFIRMED);
+        assert(reservation->getSpecialRequests() == "Wedding party");
+        RoomType expected = i < 2 ? PRESIDENTIAL : STANDARD;
+        assert(db.findRoom(reservation->getRoomNumber())->getType() == expected);
+        roomsUsed.insert(reservation->getRoomNumber());
+    }
+    assert(roomsUsed.size() == 3);
+    cout << "✓ Every room of the group is booked, each in its own room\n";
+
+    // The two cheapest presidential rooms went to the group
+    assert(db.findReservation(ids[0])->getRoomNumber() == presidential[0].roomNumber);
+    assert(db.findReservation(ids[1])->getRoomNumber() == presidential[1].roomNumber);
+    assert(freeRooms(db, PRESIDENTIAL, checkIn, checkOut, 2).size() == presidential.size() - 2);
+    cout << "✓ Cheapest free rooms chosen and no longer free\n";
+
+    caught = false;
+    try {
+        db.makeGroupReservation(1001, {{SUITE, 0, 2}}, checkIn, checkOut);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Empty request lines rejected\n";
+
+    // A room the group also has for later nights stays booked when one stay goes
+    time_t laterIn = Calendar::fromEpochDay(today + 336);
+    time_t laterOut = Calendar::fromEpochDay(today + 338);
+    int shared = db.findReservation(ids[0])->getRoomNumber();
+    int laterRooms = static_cast<int>(freeRooms(db, PRESIDENTIAL, laterIn, laterOut, 2).size());
+    vector<int> later = db.makeGroupReservation(1001, {{PRESIDENTIAL, laterRooms, 2}}, laterIn, laterOut);
+    assert(db.cancelReservation(ids[0]));
+    assert(db.getRoom(shared)->getStatus() != AVAILABLE);
+    db.updateRoomStatus(shared, AVAILABLE);
+    caught = false;
+    try {
+        db.makeReservation(1001, shared, Calendar::fromEpochDay(today + 337), Calendar::fromEpochDay(today + 339), 1);
+    } catch (const RoomException&) {
+        caught = true;
+    }
+    assert(caught);
+    int rebooked = db.makeReservation(1001, shared, checkIn, checkOut, 1);
+    cout << "✓ Cancelling one stay keeps the room's other nights booked\n";
+
+    // Checking out does the same, and a room with a guest in it shows occupied
+    int inHouse = db.addRoom(PRESIDENTIAL, 905.0, 2);
+    int stay = db.makeReservation(1001, inHouse, Calendar::fromEpochDay(today), Calendar::fromEpochDay(today + 2), 1);
+    assert(db.checkIn(stay));
+    time_t nextIn = Calendar::fromEpochDay(today + 2);
+    time_t nextOut = Calendar::fromEpochDay(today + 4);
+    int nextRooms = static_cast<int>(freeRooms(db, PRESIDENTIAL, nextIn, nextOut, 2).size());
+    vector<int> next = db.makeGroupReservation(1001, {{PRESIDENTIAL, nextRooms, 2}}, nextIn, nextOut);
+    assert(db.getRoom(inHouse)->getStatus() == OCCUPIED);
+    assert(db.checkOut(stay));
+    assert(db.getRoom(inHouse)->getStatus() == RESERVED);
+    for (int id : next) db.cancelReservation(id);
+    assert(db.getRoom(inHouse)->getStatus() == AVAILABLE);
+    cout << "✓ Checking out frees the room only when nothing else is booked\n";
+
+    for (int id : ids) db.cancelReservation(id);
+    for (int id : later) db.cancelReservation(id);
+    db.cancelReservation(rebooked);
+    cout << "Group Reservation Tests: PASSED\n\n";
+}
+
+void testRoomBlocks() {
+    cout << "Testing Room Blocks...\n";
+
+    int today = Utils::getTodayEpochDay();
+    time_t checkIn = Calendar::fromEpochDay(today + 340);
+    time_t checkOut = Calendar::fromEpochDay(today + 342);
+    int blockId, expiredId, firstPick;
+    {
+        Database db;
+        db.addRoom(SUITE, 400.0, 2);
+        db.addRoom(SUITE, 401.0, 2);
+        blockId = db.createRoomBlock(1001, "Dental Conference", {{SUITE, 2, 2}}, checkIn, checkOut,
+                                     Calendar::fromEpochDay(today + 300));
+        RoomBlock* block = db.findBlock(blockId);
+        assert(block && block->getStatus() == BLOCK_OPEN && block->getHeldCount() == 2);
+
+        // Held rooms are taken for the block's nights only
+        vector<RoomStayCost> during = freeRooms(db, SUITE, checkIn, checkOut, 2);
+        vector<RoomStayCost> after = freeRooms(db, SUITE, checkOut, Calendar::fromEpochDay(today + 344), 2);
+        for (const auto& room : block->getRooms()) {
+            assert(room.rate > 0);
+            assert(!contains(during, room.roomNumber));
+            assert(contains(after, room.roomNumber) || !db.findRoom(room.roomNumber)->isAvailable());
+        }
+        bool caught = false;
+        try {
+            db.makeReservation(1001, block->getRooms()[0].roomNumber, checkIn, checkOut, 2);
+        } catch (const RoomException&) {
+            caught = true;
+        }
+        assert(caught);
+        cout << "✓ Held rooms cannot be sold to anyone else\n";
+
+        firstPick = db.pickUpFromBlock(blockId, 1001, SUITE, 2);
+        Reservation* picked = db.findReservation(firstPick);
+        assert(picked && picked->getRawCheckIn() == checkIn && picked->getRawCheckOut() == checkOut);
+        assert(picked->getRoomRate() == db.findBlock(blockId)->getRooms()[0].rate);
+        assert(db.findBlock(blockId)->getPickedUpCount() == 1 && db.findBlock(blockId)->getStatus() == BLOCK_OPEN);
+        db.pickUpFromBlock(blockId, 1001, SUITE, 1);
+        assert(db.findBlock(blockId)->getStatus() == BLOCK_COMPLETED);
+        caught = false;
+        try {
+            db.pickUpFromBlock(blockId, 1001, SUITE, 1);
+        } catch (const ValidationException&) {
+            caught = true;
+        }
+        assert(caught);
+        cout << "✓ Guests pick up held rooms at the block rate\n";
+
+        // A block whose release date has passed gives its rooms back
+        expiredId = db.createRoomBlock(1001, "Late Tour", {{SUITE, 1, 1}}, Calendar::fromEpochDay(today + 345),
+                                       Calendar::fromEpochDay(today + 347), Calendar::fromEpochDay(today - 1));
+        int heldRoom = db.findBlock(expiredId)->getRooms()[0].roomNumber;
+        assert(db.releaseExpiredBlocks() >= 1);
+        assert(db.findBlock(expiredId)->getStatus() == BLOCK_RELEASED);
+        assert(contains(freeRooms(db, SUITE, Calendar::fromEpochDay(today + 345),
+                                  Calendar::fromEpochDay(today + 347), 1), heldRoom));
+        cout << "✓ Rooms still held after the release date go back on sale\n";
+
+        caught = false;
+        try {
+            db.createRoomBlock(1001, "Backwards", {{SUITE, 1, 1}}, checkIn, checkOut,
+                               Calendar::fromEpochDay(today + 341));
+        } catch (const ValidationException&) {
+            caught = true;
+        }
+        assert(caught);
+        cout << "✓ Release date after arrival rejected\n";
+    }
+    {
+        Database db;
+        RoomBlock* block = db.findBlock(blockId);
+        assert(block && block->getStatus() == BLOCK_COMPLETED && block->getPickedUpCount() == 2);
+        assert(block->getRooms()[0].reservationId == firstPick);
+        assert(db.findBlock(expiredId)->getStatus() == BLOCK_RELEASED);
+        for (const auto& room : block->getRooms()) db.cancelReservation(room.reservationId);
+    }
+    cout << "✓ Blocks survive a reload\n";
+
+    cout << "Room Block Tests: PASSED\n\n";
+}
+
+void benchmarkGroupBooking() {
+    cout << "Benchmarking Group Booking...\n";
+
+    const int ROOMS = 100;
+    int today = Utils::getTodayEpochDay();
+    time_t checkIn = Calendar::fromEpochDay(today + 350);
+    time_t checkOut = Calendar::fromEpochDay(today + 353);
+    Database db;
+
+    // Rooms from earlier runs are freed again at the end, so this only grows once
+    vector<int> open;
+    for (const auto& room : freeRooms(db, STANDARD, checkIn, checkOut, 2)) {
+        if (db.findRoom(room.roomNumber)->isAvailable()) open.push_back(room.roomNumber);
+    }
+    while (static_cast<int>(open.size()) < ROOMS) open.push_back(db.addRoom(STANDARD, 120.0, 2));
+
+    auto start = chrono::high_resolution_clock::now();
+    vector<int> single;
+    for (int i = 0; i < ROOMS; i++) {
+        single.push_back(db.makeReservation(1001, open[i], checkIn, checkOut, 2));
+    }
+    auto oneByOne = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+    for (int id : single) db.cancelReservation(id);
+
+    start = chrono::high_resolution_clock::now();
+    vector<int> group = db.makeGroupReservation(1001, {{STANDARD, ROOMS, 2}}, checkIn, checkOut);
+    auto together = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+    assert(static_cast<int>(group.size()) == ROOMS);
+    for (int id : group) db.cancelReservation(id);
+
+    cout << "✓ " << ROOMS << " rooms, " << db.getReservationCount() << " reservations on file\n";
+    cout << "  One makeReservation per room: " << oneByOne.count() << " us\n";
+    cout << "  One group booking:            " << together.count() << " us\n";
+    cout << "Group Booking Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     GROUP BOOKING TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testGroupReservation();
+        testRoomBlocks();
+        benchmarkGroupBooking();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,258 @@
+#include "KpiCube.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+
+using namespace std;
+
+static bool near(double a, double b) {
+    return fabs(a - b) < 1e-6 * max(1.0, fabs(b));
+}
+
+// Writes paid bills in the bills.dat record layout with chosen payment days,
+// then reads them back
+struct BillSpec {
+    int billId;
+    int reservationId;
+    int paidDay;
+    double room, food, service;
+};
+
+static vector<Bill> paidBills(const vector<BillSpec>& specs) {
+    {
+        ofstream file("test_kpi_cube.dat");
+        for (const auto& spec : specs) {
+            // Noon UTC, so the local payment day is the same day in any zone
+            time_t paidAt = Calendar::fromEpochDay(spec.paidDay) + 12 * 3600;
+            file << spec.billId << "|" << spec.reservationId << "|0|0|1|Cash|" << paidAt << "\n3\n"
+                 << "Room Charge (1 nights)|" << spec.room << "|1\n"
+                 << "Food - Coffee|" << spec.food << "|1\n"
+                 << "Service - Laundry|" << spec.service << "|1\n";
+        }
+    }
+    ifstream file("test_kpi_cube.dat");
+    vector<Bill> bills(specs.size());
+    for (auto& bill : bills) {
+        bill.loadFromFile(file);
+    }
+    remove("test_kpi_cube.dat");
+    return bills;
+}
+
+static Reservation stay(int id, int roomNumber, int checkInDay, int nights, double rate) {
+    return Reservation(id, 1001, roomNumber, Calendar::fromEpochDay(checkInDay),
+                       Calendar::fromEpochDay(checkInDay + nights), 2, rate);
+}
+
+void testCube() {
+    cout << "Testing KPI Cube...\n";
+
+    const int jan31 = Calendar::daysFromCivil(2025, 1, 31);
+    KpiCube cube;
+    cube.trackRoom(STANDARD, 1);
+    cube.trackRoom(STANDARD, 1);
+    cube.trackRoom(SUITE, 1);
+    assert(cube.getInventory(STANDARD) == 2);
+
+    // Stay over the month boundary: nights Jan 31, Feb 1, Feb 2
+    Reservation a = stay(10001, 101, jan31, 3, 100.0);
+    Reservation b = stay(10002, 301, jan31 + 1, 1, 400.0);
+    cube.trackStay(a, STANDARD, 1);
+    cube.trackStay(b, SUITE, 1);
+
+    KpiSlice january = cube.getPeriod(jan31 - 30, jan31);
+    assert(january.rooms[STANDARD].roomNightsSold == 1);
+    assert(january.rooms[STANDARD].roomNightsAvailable == 62);
+    KpiSlice feb1 = cube.getDay(jan31 + 1);
+    assert(feb1.allRooms().roomNightsSold == 2);
+    assert(near(feb1.allRooms().roomRevenue, 500.0));
+    assert(near(cube.getPeriod(jan31, jan31 + 2).rooms[STANDARD].adr(), 100.0));
+    cout << "✓ Room-nights and ADR by stay date\n";
+
+    // A cancellation is a -1 of the old state and a +1 of the new one
+    cube.trackStay(b, SUITE, -1);
+    b.cancel();
+    cube.trackStay(b, SUITE, 1);
+    assert(cube.getDay(jan31 + 1).rooms[SUITE].roomNightsSold == 0);
+    cout << "✓ Cancelled stays drop out\n";
+
+    vector<Bill> bills = paidBills({
+        {5001, 10001, jan31, 300.0, 20.0, 10.0},
+        {5002, 10002, jan31 + 1, 400.0, 0.5, 0.5},
+    });
+    cube.postCharges(bills[0], STANDARD, 1);
+    assert(near(cube.getOpenCharges(STANDARD, REVENUE_FOOD), 20.0));
+    cube.postCharges(bills[0], STANDARD, -1);
+    assert(near(cube.getOpenCharges(), 0.0));
+    cube.recordPayment(bills[0], STANDARD);
+    cube.recordPayment(bills[1], SUITE);
+    cout << "✓ Open charges are cleared on payment\n";
+
+    KpiSlice all = cube.getAllTime();
+    assert(all.payments == 2);
+    assert(near(all.totalRevenue(), bills[0].calculateTotal() + bills[1].calculateTotal()));
+    assert(near(all.typeRevenue(SUITE), bills[1].calculateTotal()));
+    assert(near(cube.getDay(jan31).revenue[STANDARD][REVENUE_FOOD], 20.0));
+    cout << "✓ Revenue split by day, room type and category\n";
+
+    vector<KpiBucket> months = cube.rollUp(jan31 - 30, jan31 + 40, KPI_MONTH);
+    assert(months.size() == 3);
+    assert(months[1].firstDay == jan31 + 1 && months[1].lastDay == jan31 + 28);
+    assert(months[0].slice.payments == 1 && months[1].slice.payments == 1);
+    assert(months[2].slice.payments == 0);
+
+    vector<KpiBucket> weeks = cube.rollUp(jan31 - 30, jan31 + 40, KPI_WEEK);
+    for (size_t i = 1; i < weeks.size(); i++) {
+        assert(Calendar::weekday(weeks[i].firstDay) == 1);   // Monday
+    }
+    int weekPayments = 0;
+    for (const auto& week : weeks) weekPayments += week.slice.payments;
+    assert(weekPayments == 2);
+    assert(cube.rollUp(jan31 - 30, jan31 + 40, KPI_YEAR).size() == 1);
+    cout << "✓ Week, month and year roll-ups passed\n";
+
+    cout << "KPI Cube Tests: PASSED\n\n";
+}
+
+void testRollUpMatchesDays() {
+    cout << "Testing Roll-ups Against Day Sums...\n";
+
+    const int base = Calendar::daysFromCivil(2023, 11, 17);
+    const int DAYS = 800;
+    KpiCube cube;
+    for (int r = 0; r < 20; r++) cube.trackRoom(static_cast<RoomType>(STANDARD + r % 4), 1);
+
+    unsigned seed = 99;
+    vector<BillSpec> specs;
+    for (int i = 0; i < 3000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        int day = base + static_cast<int>((seed >> 8) % DAYS);
+        int nights = 1 + static_cast<int>((seed >> 4) % 6);
+        RoomType type = static_cast<RoomType>(STANDARD + (seed >> 20) % 4);
+        cube.trackStay(stay(10001 + i, 101, day, nights, 80.0 + i % 50), type, 1);
+        if (i % 3 == 0) specs.push_back({5001 + i, 10001 + i, day + nights, 100.0, 10.0, 5.0});
+    }
+    vector<Bill> bills = paidBills(specs);
+    for (size_t i = 0; i < bills.size(); i++) {
+        cube.recordPayment(bills[i], STANDARD + static_cast<int>(i % 4));
+    }
+
+    for (KpiGrain grain : {KPI_WEEK, KPI_MONTH, KPI_YEAR}) {
+        KpiSlice total;
+        for (const auto& bucket : cube.rollUp(base - 5, base + DAYS + 10, grain)) {
+            KpiSlice days;
+            for (int d = bucket.firstDay; d <= bucket.lastDay; d++) days += cube.getDay(d);
+            assert(near(bucket.slice.totalRevenue(), days.totalRevenue()));
+            assert(bucket.slice.allRooms().roomNightsSold == days.allRooms().roomNightsSold);
+            assert(bucket.slice.allRooms().roomNightsAvailable == days.allRooms().roomNightsAvailable);
+            total += bucket.slice;
+        }
+        assert(near(total.totalRevenue(), cube.getAllTime().totalRevenue()));
+        assert(total.payments == static_cast<int>(bills.size()));
+    }
+    cout << "✓ Every bucket equals the sum of its days\n";
+
+    cout << "Roll-up Tests: PASSED\n\n";
+}
+
+void benchmarkMonthlyReport() {
+    cout << "Benchmarking 36-Month Report...\n";
+
+    const int ROOMS = 200;
+    const int YEARS = 3;
+    const int base = Calendar::daysFromCivil(2022, 1, 1);
+    const int DAYS = YEARS * 365;
+
+    vector<RoomType> typeByRoom(ROOMS);
+    KpiCube cube;
+    for (int r = 0; r < ROOMS; r++) {
+        typeByRoom[r] = static_cast<RoomType>(STANDARD + r % 4);
+        cube.trackRoom(typeByRoom[r], 1);
+    }
+
+    // Back-to-back stays in every room, a paid bill for every third one
+    vector<Reservation> reservations;
+    vector<int> roomOf;
+    vector<BillSpec> specs;
+    unsigned seed = 4242;
+    for (int r = 0; r < ROOMS; r++) {
+        for (int day = base; day < base + DAYS;) {
+            seed = seed * 1103515245u + 12345u;
+            int nights = 1 + static_cast<int>((seed >> 8) % 5);
+            int id = 10001 + static_cast<int>(reservations.size());
+            reservations.push_back(stay(id, 101 + r, day, nights, 100.0));
+            roomOf.push_back(r);
+            if (id % 3 == 0) specs.push_back({id, id, day + nights, 100.0 * nights, 15.0, 5.0});
+            day += nights + static_cast<int>((seed >> 16) % 2);
+        }
+    }
+    for (size_t i = 0; i < reservations.size(); i++) {
+        cube.trackStay(reservations[i], typeByRoom[roomOf[i]], 1);
+    }
+    vector<Bill> bills = paidBills(specs);
+    for (const auto& bill : bills) {
+        cube.recordPayment(bill, typeByRoom[roomOf[bill.getReservationId() - 10001]]);
+    }
+
+    // Rescanning bills and reservations once per month, as a report would
+    // without the cube
+    auto start = chrono::high_resolution_clock::now();
+    double scanRevenue = 0.0;
+    long long scanNights = 0;
+    for (int month = KpiCube::monthIndex(base); month < KpiCube::monthIndex(base) + YEARS * 12; month++) {
+        int first = KpiCube::monthStart(month), last = KpiCube::monthStart(month + 1) - 1;
+        for (const auto& bill : bills) {
+            int day = Utils::localEpochDay(bill.getRawPaymentDate());
+            if (day >= first && day <= last) scanRevenue += bill.calculateTotal();
+        }
+        for (const auto& reservation : reservations) {
+            int in = Utils::toEpochDay(reservation.getRawCheckIn());
+            int out = Utils::toEpochDay(reservation.getRawCheckOut());
+            scanNights += max(0, min(out, last + 1) - max(in, first));
+        }
+    }
+    auto scan = chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    double cubeRevenue = 0.0;
+    long long cubeNights = 0;
+    for (const auto& bucket : cube.rollUp(base, KpiCube::monthStart(KpiCube::monthIndex(base) + YEARS * 12) - 1,
+                                          KPI_MONTH)) {
+        cubeRevenue += bucket.slice.totalRevenue();
+        cubeNights += bucket.slice.allRooms().roomNightsSold;
+    }
+    auto rollUp = chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - start);
+
+    assert(near(cubeRevenue, scanRevenue));
+    assert(cubeNights == scanNights);
+
+    cout << "✓ " << reservations.size() << " stays, " << bills.size() << " bills: roll-up matches a rescan\n";
+    cout << "  rescan per month: " << scan.count() << " us\n";
+    cout << "  cube roll-up:     " << rollUp.count() << " us\n";
+
+    cout << "Monthly Report Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     KPI CUBE TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testCube();
+        testRollUpMatchesDays();
+        benchmarkMonthlyReport();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,189 @@
+// Debug calls are compiled out of this file, whatever the runtime level
+#define HOTEL_LOG_MIN_LEVEL 2
+
+#include "Logger.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <cstdio>
+#include <thread>
+#include <chrono>
+
+using namespace std;
+
+static const string TEST_LOG = "logs/test_logger.log";
+
+static vector<string> readLog() {
+    Logger::flush();
+    ifstream file(TEST_LOG);
+    vector<string> lines;
+    string line;
+    while (getline(file, line)) lines.push_back(line);
+    return lines;
+}
+
+static bool contains(const string& line, const string& text) {
+    return line.find(text) != string::npos;
+}
+
+void testLogger() {
+    cout << "Testing Logger...\n";
+
+    Utils::createDirectory("logs");
+    remove(TEST_LOG.c_str());
+    Logger::open(TEST_LOG);
+    assert(Logger::getPath() == TEST_LOG);
+
+    // Arguments keep their types until the flusher formats them
+    Logger::setLevel(LOG_LEVEL_DEBUG);
+    HLOG_INFO("values int={} uint={} money={} flag={} text={} type={}", -42, 7u, 19.5, true,
+              string("suite"), SUITE);
+    HLOG_WARNING("unfilled {} {}", 1);
+    HLOG_DEBUG("compiled out {}", 1);
+    vector<string> lines = readLog();
+    assert(lines.size() == 2);
+    assert(contains(lines[0], " INFO    [t"));
+    assert(contains(lines[0], "values int=-42 uint=7 money=19.50 flag=true text=suite type=3"));
+    assert(contains(lines[1], "WARNING") && contains(lines[1], "unfilled 1 {}"));
+    cout << "✓ Deferred formatting of numbers, flags, text and enums\n";
+
+    // Runtime level; audit records are always kept
+    Logger::setLevel(LOG_LEVEL_ERROR);
+    HLOG_INFO("filtered");
+    HLOG_ERROR("kept error");
+    HLOG_AUDIT("kept audit");
+    lines = readLog();
+    assert(lines.size() == 4);
+    assert(contains(lines[2], "ERROR") && contains(lines[3], "AUDIT"));
+    cout << "✓ Levels filtered at compile time and at run time\n";
+
+    // Long strings are cut to the record's text space
+    Logger::setLevel(LOG_LEVEL_INFO);
+    HLOG_INFO("long={} after={}", string(500, 'x'), "end");
+    lines = readLog();
+    assert(contains(lines[4], "long=" + string(LogRecord::TEXT_BYTES, 'x') + " after="));
+    cout << "✓ Oversized strings truncated\n";
+
+    // Lines from many threads are each in order and none is lost unseen
+    const int THREADS = 4;
+    const int PER_THREAD = 3000;
+    long long droppedBefore = Logger::getDropped();
+    vector<thread> workers;
+    for (int t = 0; t < THREADS; t++) {
+        workers.emplace_back([t]() {
+            for (int i = 0; i < PER_THREAD; i++) {
+                HLOG_INFO("worker={} seq={}", t, i);
+                if (i % 500 == 0) this_thread::sleep_for(chrono::milliseconds(25));
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    lines = readLog();
+    long long dropped = Logger::getDropped() - droppedBefore;
+    vector<int> last(THREADS, -1);
+    int seen = 0;
+    for (const auto& line : lines) {
+        size_t at = line.find("worker=");
+        if (at == string::npos) continue;
+        int worker = 0, seq = 0;
+        sscanf(line.c_str() + at, "worker=%d seq=%d", &worker, &seq);
+        assert(seq > last[worker]);
+        last[worker] = seq;
+        seen++;
+    }
+    assert(seen + dropped == THREADS * PER_THREAD);
+    cout << "✓ " << THREADS << " threads, " << seen << " lines in order, " << dropped << " dropped and counted\n";
+
+    // Database operations and exceptions reach the log
+    {
+        Database db;
+        int room = db.addRoom(STANDARD, 105.0, 2);
+        db.updateRoomStatus(room, MAINTENANCE);
+        ExceptionHandler::logException(RoomNotFoundException(room + 1000));
+        lines = readLog();
+        bool added = false, status = false, failed = false;
+        for (const auto& line : lines) {
+            added = added || contains(line, "room.add room=" + to_string(room) + " type=1 price=105.00");
+            status = status || contains(line, "room.status room=" + to_string(room) + " status=4");
+            failed = failed || (contains(line, "ERROR") && contains(line, "exception code="));
+        }
+        assert(added && status && failed);
+    }
+    cout << "✓ Database operations and exceptions logged\n";
+
+    cout << "Logger Tests: PASSED\n\n";
+}
+
+void benchmarkLogger() {
+    cout << "Benchmarking Logger...\n";
+
+    const int BURST = 1000;         // Under one ring, so nothing is dropped
+    const int BURSTS = 200;
+    Logger::setLevel(LOG_LEVEL_INFO);
+    double loggedNanos = 0.0;
+    for (int b = 0; b < BURSTS; b++) {
+        auto start = chrono::high_resolution_clock::now();
+        for (int i = 0; i < BURST; i++) {
+            HLOG_INFO("bench.record reservation={} room={} total={} method={}", 10000 + i, 101 + i % 50,
+                      i * 1.25, "Card");
+        }
+        loggedNanos += chrono::duration<double, nano>(chrono::high_resolution_clock::now() - start).count();
+        Logger::flush();
+    }
+
+    Logger::setLevel(LOG_LEVEL_ERROR);
+    auto start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < BURST * BURSTS; i++) {
+        HLOG_INFO("bench.record reservation={} room={} total={} method={}", 10000 + i, 101 + i % 50,
+                  i * 1.25, "Card");
+    }
+    double filteredNanos = chrono::duration<double, nano>(chrono::high_resolution_clock::now() - start).count();
+
+    // Room status changes in one batch, so the files do not dominate
+    const int CHANGES = 20000;
+    Database db;
+    int room = db.addRoom(DELUXE, 150.0, 2);
+    auto changeRooms = [&](LogLevel level) {
+        Logger::setLevel(level);
+        db.beginBatch();
+        auto begin = chrono::high_resolution_clock::now();
+        for (int i = 0; i < CHANGES; i++) {
+            db.updateRoomStatus(room, i % 2 ? MAINTENANCE : AVAILABLE);
+            if (i % BURST == BURST - 1) Logger::flush();
+        }
+        double nanos = chrono::duration<double, nano>(chrono::high_resolution_clock::now() - begin).count();
+        db.commitBatch();
+        return nanos / CHANGES;
+    };
+    double quiet = changeRooms(LOG_LEVEL_ERROR);
+    double logged = changeRooms(LOG_LEVEL_INFO);
+    Logger::flush();
+
+    cout << "✓ " << BURST * BURSTS << " records, " << Logger::getWritten() << " lines written so far\n";
+    cout << "  Hot path, logged:      " << loggedNanos / (BURST * BURSTS) << " ns per call\n";
+    cout << "  Hot path, filtered:    " << filteredNanos / (BURST * BURSTS) << " ns per call\n";
+    cout << "  updateRoomStatus:      " << quiet << " ns quiet, " << logged << " ns logged (flushes included)\n";
+    cout << "Logger Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     LOGGER TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testLogger();
+        benchmarkLogger();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
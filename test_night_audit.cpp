@@ -0,0 +1,161 @@
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include <chrono>
+
+using namespace std;
+
+// Each test starts with tonight as the business day
+static void resetBusinessDay() {
+    remove("data/business_day.dat");
+}
+
+static int countRoomCharges(const Bill& bill) {
+    int count = 0;
+    for (const auto& item : bill.getItems()) {
+        if (item.getDescription() == "Room Charge") count++;
+    }
+    return count;
+}
+
+static int checkedInStay(Database& db, RoomType type, double price, int today) {
+    int room = db.addRoom(type, price, 2);
+    int reservation = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                         Calendar::fromEpochDay(today + 2), 2);
+    db.checkIn(reservation);
+    return reservation;
+}
+
+void testNightAudit() {
+    cout << "Testing Night Audit...\n";
+
+    int today = Utils::getTodayEpochDay();
+    resetBusinessDay();
+    int billed, unbilled, arriving, prepaid;
+    double billedRate, unbilledRate;
+    {
+        Database db;
+        assert(db.getBusinessDay() == today);
+
+        billed = checkedInStay(db, DELUXE, 180.0, today);
+        int bill = db.createBill(billed);
+        db.addBillItem(bill, "Minibar", 12.0);
+        unbilled = checkedInStay(db, SUITE, 260.0, today);
+        prepaid = checkedInStay(db, STANDARD, 120.0, today);
+        int prepaidBill = db.createBill(prepaid);
+        db.addBillItem(prepaidBill, "Room Charge", 240.0);
+        db.processPayment(prepaidBill, "Card");
+        double prepaidTotal = db.getBillForReservation(prepaid)->calculateTotal();
+        int room = db.addRoom(STANDARD, 95.0, 2);
+        arriving = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                      Calendar::fromEpochDay(today + 1), 1);
+        billedRate = db.getReservation(billed)->getRoomRate();
+        unbilledRate = db.getReservation(unbilled)->getRoomRate();
+        double openBefore = db.getKpiCube().getOpenCharges();
+
+        NightAuditReport audit = db.runNightAudit();
+        assert(audit.businessDay == today);
+        assert(audit.chargesPosted >= 2 && audit.billsOpened >= 1);
+        assert(audit.roomCharges >= billedRate + unbilledRate - 0.005);
+        assert(audit.tax > 0.0);
+        assert(db.getBusinessDay() == today + 1);
+
+        optional<Bill> billedBill = db.getBillForReservation(billed);
+        assert(billedBill && billedBill->getBillId() == bill);
+        assert(countRoomCharges(*billedBill) == 1 && billedBill->getItems().size() == 2);
+        assert(billedBill->getItems()[1].getAmount() == billedRate);
+        optional<Bill> openedBill = db.getBillForReservation(unbilled);
+        assert(openedBill && countRoomCharges(*openedBill) == 1);
+        assert(!db.getBillForReservation(arriving));
+        optional<Bill> prepaidAfter = db.getBillForReservation(prepaid);
+        assert(audit.staysSettled >= 1 && countRoomCharges(*prepaidAfter) == 1);
+        assert(prepaidAfter->calculateTotal() == prepaidTotal);
+        assert(db.getKpiCube().getOpenCharges() - openBefore >= billedRate + unbilledRate - 0.005);
+        cout << "✓ In-house stays charged one night, bills opened where missing\n";
+        cout << "✓ Arrivals not yet checked in and paid bills are left alone\n";
+
+        bool caught = false;
+        try {
+            db.runNightAudit();
+        } catch (const ValidationException&) {
+            caught = true;
+        }
+        assert(caught && db.getBusinessDay() == today + 1);
+        cout << "✓ A business day is audited only once\n";
+    }
+
+    // The charges and the business day come back from the files
+    {
+        Database db;
+        assert(db.getBusinessDay() == today + 1);
+        assert(countRoomCharges(*db.getBillForReservation(billed)) == 1);
+        assert(countRoomCharges(*db.getBillForReservation(unbilled)) == 1);
+        cout << "✓ Business day and postings persist\n";
+    }
+
+    cout << "Night Audit Tests: PASSED\n\n";
+}
+
+void benchmarkNightAudit() {
+    cout << "Benchmarking Night Audit...\n";
+
+    const int ROOMS = 2000;
+    int today = Utils::getTodayEpochDay();
+    resetBusinessDay();
+    Database db;
+    vector<int> stays;
+    db.beginBatch();
+    for (int i = 0; i < ROOMS; i++) {
+        stays.push_back(checkedInStay(db, static_cast<RoomType>(STANDARD + i % 4), 100.0 + i % 50, today));
+    }
+    db.commitBatch();
+
+    // The same postings one addBillItem at a time, written once at the end
+    auto start = chrono::high_resolution_clock::now();
+    db.beginBatch();
+    for (int reservation : stays) {
+        optional<Bill> bill = db.getBillForReservation(reservation);
+        int billId = bill ? bill->getBillId() : db.createBill(reservation);
+        db.addBillItem(billId, "Room Charge", db.getReservation(reservation)->getRoomRate());
+    }
+    db.commitBatch();
+    long long manualMillis = chrono::duration_cast<chrono::milliseconds>(
+        chrono::high_resolution_clock::now() - start).count();
+
+    NightAuditReport audit = db.runNightAudit();
+    assert(audit.chargesPosted >= ROOMS);
+    OccupancySummary rooms = audit.kpis.allRooms();
+
+    cout << "✓ " << ROOMS << " in-house stays over " << db.getReservationCount() << " reservations, "
+         << db.getBillCount() << " bills\n";
+    cout << "  Hardware threads:        " << thread::hardware_concurrency() << "\n";
+    cout << "  One item at a time:      " << manualMillis << " ms\n";
+    cout << "  Night audit:             " << static_cast<long long>(audit.seconds * 1000) << " ms, "
+         << audit.chargesPosted << " charges, " << Utils::formatCurrency(audit.roomCharges) << "\n";
+    cout << "  Day KPIs:                " << rooms.roomNightsSold << " room-nights sold of "
+         << rooms.roomNightsAvailable << "\n";
+    cout << "Night Audit Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     NIGHT AUDIT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testNightAudit();
+        benchmarkNightAudit();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,174 @@
+#include "OccupancyAnalytics.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+#include <thread>
+
+using namespace std;
+
+static bool near(double a, double b) {
+    return fabs(a - b) < 1e-6 * max(1.0, fabs(b));
+}
+
+static Reservation stay(int id, int roomNumber, int checkInDay, int nights, double rate) {
+    return Reservation(id, 1001, roomNumber, Calendar::fromEpochDay(checkInDay),
+                       Calendar::fromEpochDay(checkInDay + nights), 2, rate);
+}
+
+// One room-night at a time, the obvious way
+static OccupancySummary naiveNight(const vector<Room>& rooms, const vector<Reservation>& reservations,
+                                   RoomType type, int day) {
+    OccupancySummary summary;
+    for (const auto& room : rooms) {
+        if (room.getType() != type) continue;
+        summary.roomNightsAvailable++;
+        for (const auto& reservation : reservations) {
+            if (reservation.getRoomNumber() != room.getRoomNumber() ||
+                reservation.getStatus() == CANCELLED) continue;
+            if (Utils::toEpochDay(reservation.getRawCheckIn()) <= day &&
+                day < Utils::toEpochDay(reservation.getRawCheckOut())) {
+                summary.roomNightsSold++;
+                summary.roomRevenue += reservation.getRoomRate();
+            }
+        }
+    }
+    return summary;
+}
+
+void testSmallHotel() {
+    cout << "Testing Occupancy Calculation...\n";
+
+    const int base = Calendar::daysFromCivil(2025, 3, 1);
+    vector<Room> rooms = {
+        Room(101, STANDARD, 100.0, 2), Room(102, STANDARD, 120.0, 2),
+        Room(201, DELUXE, 200.0, 3), Room(301, SUITE, 400.0, 4)
+    };
+    vector<Reservation> reservations = {
+        stay(10001, 101, base, 3, 100.0),
+        stay(10002, 102, base + 1, 1, 120.0),
+        stay(10003, 201, base - 2, 4, 200.0),     // Starts before the range
+        stay(10004, 301, base + 5, 10, 400.0),    // Ends after the range
+        stay(10005, 101, base + 4, 2, 90.0)
+    };
+    Reservation cancelled = stay(10006, 102, base + 3, 2, 120.0);
+    cancelled.cancel();
+    reservations.push_back(cancelled);
+
+    OccupancyReport report = OccupancyAnalytics::compute(rooms, reservations, base, base + 6, 3);
+    assert(report.getDayCount() == 7);
+    assert(report.getInventory(STANDARD) == 2);
+
+    OccupancySummary standard = report.getType(STANDARD);
+    assert(standard.roomNightsAvailable == 14);
+    assert(standard.roomNightsSold == 6);
+    assert(near(standard.roomRevenue, 3 * 100.0 + 120.0 + 2 * 90.0));
+    assert(near(standard.occupancyRate(), 100.0 * 6 / 14));
+    assert(near(standard.adr(), 600.0 / 6));
+    assert(near(standard.revPar(), 600.0 / 14));
+    cout << "✓ Standard rooms: nights, ADR and RevPAR passed\n";
+
+    assert(report.getType(DELUXE).roomNightsSold == 2);
+    assert(report.getType(SUITE).roomNightsSold == 2);
+    assert(report.getType(PRESIDENTIAL).roomNightsAvailable == 0);
+    assert(report.getType(PRESIDENTIAL).occupancyRate() == 0.0);
+    cout << "✓ Stays are clipped to the range\n";
+
+    for (int day = base; day <= base + 6; day++) {
+        for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+            RoomType type = static_cast<RoomType>(t);
+            OccupancySummary fast = report.getNight(type, day);
+            OccupancySummary slow = naiveNight(rooms, reservations, type, day);
+            assert(fast.roomNightsSold == slow.roomNightsSold);
+            assert(near(fast.roomRevenue, slow.roomRevenue));
+        }
+    }
+    cout << "✓ Every night matches the room-by-room count\n";
+
+    OccupancyReport empty = OccupancyAnalytics::compute(rooms, reservations, base, base - 1);
+    assert(empty.getDayCount() == 0 && empty.getTotal().roomNightsSold == 0);
+    cout << "✓ Empty range passed\n";
+
+    cout << "Occupancy Calculation Tests: PASSED\n\n";
+}
+
+void benchmarkLargeProperty() {
+    cout << "Benchmarking 1,000 Rooms x 5 Years...\n";
+
+    const int ROOMS = 1000;
+    const int DAYS = 5 * 365;
+    const int base = Calendar::daysFromCivil(2021, 1, 1);
+    const RoomType types[] = {STANDARD, STANDARD, DELUXE, SUITE, PRESIDENTIAL};
+
+    vector<Room> rooms;
+    for (int r = 0; r < ROOMS; r++) {
+        RoomType type = types[r % 5];
+        rooms.emplace_back(101 + r, type, 100.0 * type, 2);
+    }
+
+    // Back-to-back stays of 1-5 nights with 0-2 night gaps
+    vector<Reservation> reservations;
+    unsigned seed = 12345;
+    auto next = [&seed](int range) {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<int>((seed >> 16) % range);
+    };
+    int id = 10001;
+    for (int r = 0; r < ROOMS; r++) {
+        for (int day = base + next(3); day < base + DAYS; ) {
+            int nights = 1 + next(5);
+            reservations.push_back(stay(id++, 101 + r, day, nights, 80.0 + next(200)));
+            day += nights + next(3);
+        }
+    }
+
+    OccupancyReport single = OccupancyAnalytics::compute(rooms, reservations, base, base + DAYS - 1, 1);
+    auto start = chrono::high_resolution_clock::now();
+    single = OccupancyAnalytics::compute(rooms, reservations, base, base + DAYS - 1, 1);
+    auto oneThread = chrono::duration_cast<chrono::milliseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    OccupancyReport parallel = OccupancyAnalytics::compute(rooms, reservations, base, base + DAYS - 1, 8);
+    auto eightThreads = chrono::duration_cast<chrono::milliseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    OccupancySummary a = single.getTotal();
+    OccupancySummary b = parallel.getTotal();
+    assert(a.roomNightsSold == b.roomNightsSold);
+    assert(near(a.roomRevenue, b.roomRevenue));
+    for (int day = base; day < base + DAYS; day += 97) {
+        assert(single.getNight(day).roomNightsSold == parallel.getNight(day).roomNightsSold);
+    }
+    assert(eightThreads.count() < 1000);
+
+    cout << "✓ " << reservations.size() << " reservations, " << a.roomNightsSold << " room-nights\n";
+    cout << "  occupancy " << fixed << setprecision(1) << b.occupancyRate() << "%, ADR "
+         << Utils::formatCurrency(b.adr()) << ", RevPAR " << Utils::formatCurrency(b.revPar()) << "\n";
+    cout << "  1 thread:    " << oneThread.count() << " ms\n";
+    cout << "  8 threads:   " << eightThreads.count() << " ms ("
+         << max(1u, thread::hardware_concurrency()) << " hardware threads)\n";
+
+    cout << "Large Property Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     OCCUPANCY ANALYTICS TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testSmallHotel();
+        benchmarkLargeProperty();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,223 @@
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+
+struct HammerResult {
+    int commits = 0;
+    int refusals = 0;
+    int overlaps = 0;
+    int failures = 0;
+    long long millis = 0;
+};
+
+// Threads book the given rooms for the same nights, round-robin or each its
+// own, hold each booking briefly and cancel it. A room has one holder at a
+// time; a second thread succeeding while the first holds it is an overlap.
+static HammerResult hammer(Database& db, const vector<int>& rooms, int threads, int attempts,
+                           bool ownRoom = false) {
+    int today = Utils::getTodayEpochDay();
+    time_t checkIn = Calendar::fromEpochDay(today + 300);
+    time_t checkOut = Calendar::fromEpochDay(today + 302);
+    vector<atomic<bool>> held(rooms.size());
+    for (auto& h : held) h = false;
+    atomic<int> commits(0), refusals(0), overlaps(0), failures(0);
+
+    auto start = chrono::high_resolution_clock::now();
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            for (int i = 0; i < attempts; i++) {
+                size_t slot = (ownRoom ? t : t + i) % rooms.size();
+                try {
+                    int id = db.makeReservation(1001, rooms[slot], checkIn, checkOut, 2);
+                    commits++;
+                    if (held[slot].exchange(true)) overlaps++;
+                    this_thread::yield();
+                    held[slot] = false;
+                    db.cancelReservation(id);
+                } catch (const RoomException&) {
+                    refusals++;
+                } catch (const HotelException&) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    HammerResult result;
+    result.commits = commits;
+    result.refusals = refusals;
+    result.overlaps = overlaps;
+    result.failures = failures;
+    result.millis = chrono::duration_cast<chrono::milliseconds>(chrono::high_resolution_clock::now() - start).count();
+    return result;
+}
+
+void testOptimisticBooking() {
+    cout << "Testing Optimistic Booking...\n";
+
+    const int THREADS = 8;
+    const int ATTEMPTS = 40;
+    Database db;
+    vector<int> rooms;
+    for (int i = 0; i < 3; i++) rooms.push_back(db.addRoom(SUITE, 260.0, 2));
+    int before = db.getReservationCount();
+
+    // A checker looks for two live bookings of one room in every snapshot
+    atomic<bool> running(true);
+    atomic<int> doubleBooked(0), checks(0);
+    thread checker([&]() {
+        while (running) {
+            shared_ptr<const DatabaseSnapshot> view = db.snapshot();
+            vector<int> live(rooms.size(), 0);
+            for (const auto& reservation : *view->reservations) {
+                if (reservation.getStatus() != CONFIRMED && reservation.getStatus() != CHECKED_IN) continue;
+                for (size_t r = 0; r < rooms.size(); r++) {
+                    if (reservation.getRoomNumber() == rooms[r]) live[r]++;
+                }
+            }
+            for (int count : live) {
+                if (count > 1) doubleBooked++;
+            }
+            checks++;
+        }
+    });
+
+    HammerResult result = hammer(db, rooms, THREADS, ATTEMPTS);
+    running = false;
+    checker.join();
+
+    assert(result.failures == 0);
+    assert(result.overlaps == 0 && doubleBooked == 0);
+    assert(result.commits > 0);
+    assert(result.commits + result.refusals == THREADS * ATTEMPTS);
+    assert(db.getReservationCount() == before + result.commits);
+    cout << "✓ " << THREADS << " threads, " << result.commits << " bookings on " << rooms.size()
+         << " rooms, " << result.refusals << " refused\n";
+    cout << "✓ No room booked twice (" << checks << " snapshot checks)\n";
+
+    // Once a room is booked, the next booking of it is refused
+    int today = Utils::getTodayEpochDay();
+    int winner = db.makeReservation(1001, rooms[0], Calendar::fromEpochDay(today + 300),
+                                    Calendar::fromEpochDay(today + 302), 2);
+    bool refused = false;
+    try {
+        db.makeReservation(1001, rooms[0], Calendar::fromEpochDay(today + 300),
+                           Calendar::fromEpochDay(today + 302), 2);
+    } catch (const RoomException&) {
+        refused = true;
+    }
+    assert(refused);
+    db.cancelReservation(winner);
+    cout << "✓ A taken room is refused, not booked again\n";
+
+    // A room whose status says free is still refused for nights a stay has
+    int first = db.makeReservation(1001, rooms[1], Calendar::fromEpochDay(today + 310),
+                                   Calendar::fromEpochDay(today + 313), 2);
+    db.updateRoomStatus(rooms[1], AVAILABLE);
+    refused = false;
+    try {
+        db.makeReservation(1001, rooms[1], Calendar::fromEpochDay(today + 312),
+                           Calendar::fromEpochDay(today + 314), 2);
+    } catch (const RoomException&) {
+        refused = true;
+    }
+    assert(refused);
+    int adjacent = db.makeReservation(1001, rooms[1], Calendar::fromEpochDay(today + 313),
+                                      Calendar::fromEpochDay(today + 315), 2);
+    db.cancelReservation(first);
+    db.cancelReservation(adjacent);
+    cout << "✓ Overlapping nights refused whatever the room's status\n";
+
+    // Threads race for overlapping nights while the status keeps saying free
+    atomic<int> staggered(0);
+    vector<thread> racers;
+    for (int t = 0; t < THREADS; t++) {
+        racers.emplace_back([&, t]() {
+            for (int i = 0; i < 10; i++) {
+                int night = today + 320 + (t + i) % 4;
+                try {
+                    db.makeReservation(1001, rooms[2], Calendar::fromEpochDay(night),
+                                       Calendar::fromEpochDay(night + 2), 2);
+                    staggered++;
+                } catch (const RoomException&) {
+                }
+                db.updateRoomStatus(rooms[2], AVAILABLE);
+            }
+        });
+    }
+    for (auto& racer : racers) racer.join();
+    vector<Reservation> stays;
+    for (const auto& reservation : *db.snapshot()->reservations) {
+        if (reservation.getRoomNumber() == rooms[2] && reservation.getStatus() == CONFIRMED) {
+            stays.push_back(reservation);
+        }
+    }
+    assert(staggered > 0 && static_cast<int>(stays.size()) == staggered);
+    for (size_t a = 0; a < stays.size(); a++) {
+        for (size_t b = a + 1; b < stays.size(); b++) {
+            assert(stays[a].getRawCheckOut() <= stays[b].getRawCheckIn() ||
+                   stays[b].getRawCheckOut() <= stays[a].getRawCheckIn());
+        }
+    }
+    for (const auto& stay : stays) db.cancelReservation(stay.getReservationId());
+    cout << "✓ " << staggered << " of " << THREADS * 10 << " racing bookings for overlapping nights made, none overlap\n";
+
+    cout << "Optimistic Booking Tests: PASSED\n\n";
+}
+
+void benchmarkOptimisticBooking() {
+    cout << "Benchmarking Optimistic Booking...\n";
+
+    const int THREADS = 8;
+    const int ATTEMPTS = 30;
+    Database db;
+    vector<int> shared, separate;
+    for (int i = 0; i < 2; i++) shared.push_back(db.addRoom(DELUXE, 190.0, 2));
+    for (int i = 0; i < THREADS; i++) separate.push_back(db.addRoom(DELUXE, 190.0, 2));
+
+    long long retriesBefore = db.getBookingRetries();
+    HammerResult contended = hammer(db, shared, THREADS, ATTEMPTS);
+    long long contendedRetries = db.getBookingRetries() - retriesBefore;
+    HammerResult spread = hammer(db, separate, THREADS, ATTEMPTS, true);
+    assert(contended.overlaps == 0 && spread.overlaps == 0);
+    assert(spread.commits == THREADS * ATTEMPTS);
+
+    auto rate = [](const HammerResult& result) {
+        return result.millis > 0 ? result.commits * 1000LL / result.millis : 0LL;
+    };
+    cout << "✓ " << THREADS << " threads x " << ATTEMPTS << " attempts over "
+         << db.getReservationCount() << " reservations\n";
+    cout << "  Hardware threads:      " << thread::hardware_concurrency() << "\n";
+    cout << "  2 shared rooms:        " << contended.commits << " commits, " << contended.refusals
+         << " refused, " << contendedRetries << " retries, " << rate(contended) << " commits/s\n";
+    cout << "  One room per thread:   " << spread.commits << " commits, " << rate(spread) << " commits/s\n";
+    cout << "Optimistic Booking Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     OPTIMISTIC BOOKING TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testOptimisticBooking();
+        benchmarkOptimisticBooking();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
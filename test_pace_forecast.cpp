@@ -0,0 +1,233 @@
+#include "PaceForecast.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+#include <random>
+
+using namespace std;
+
+static bool near(double a, double b) {
+    return fabs(a - b) < 1e-9 * max(1.0, fabs(b));
+}
+
+// Booked at midday so the local booking day is the same in any time zone
+static Reservation booking(int id, int roomNumber, int checkInDay, int nights, int bookedDay) {
+    Reservation reservation(id, 1001, roomNumber, Calendar::fromEpochDay(checkInDay),
+                            Calendar::fromEpochDay(checkInDay + nights), 2, 100.0);
+    reservation.setBookingDate(Calendar::fromEpochDay(bookedDay) + 12 * 3600);
+    return reservation;
+}
+
+// Scans every reservation for one cell of the booking curve
+static int naiveOnTheBooks(const vector<Room>& rooms, const vector<Reservation>& reservations,
+                           RoomType type, int day, int lead) {
+    int count = 0;
+    for (const auto& reservation : reservations) {
+        if (reservation.getStatus() == CANCELLED) continue;
+        bool matches = false;
+        for (const auto& room : rooms) {
+            if (room.getRoomNumber() == reservation.getRoomNumber()) matches = room.getType() == type;
+        }
+        if (!matches) continue;
+        if (Utils::toEpochDay(reservation.getRawCheckIn()) > day ||
+            day >= Utils::toEpochDay(reservation.getRawCheckOut())) continue;
+        int bookedLead = day - Utils::localEpochDay(reservation.getRawBookingDate());
+        bookedLead = min(max(bookedLead, 0), PaceForecast::MAX_LEAD);
+        if (bookedLead >= lead) count++;
+    }
+    return count;
+}
+
+void testBookingCurves() {
+    cout << "Testing Booking Curves...\n";
+
+    const int today = Calendar::daysFromCivil(2025, 6, 1);
+    vector<Room> rooms;
+    for (int i = 0; i < 20; i++) {
+        rooms.emplace_back(101 + i, static_cast<RoomType>(STANDARD + i % 4), 100.0, 2);
+    }
+
+    mt19937 rng(7);
+    vector<Reservation> reservations;
+    for (int i = 0; i < 600; i++) {
+        int checkIn = today - 400 + static_cast<int>(rng() % 480);
+        int nights = 1 + rng() % 6;
+        int lead = static_cast<int>(rng() % 420) - 10;   // Includes clipped and walk-in leads
+        reservations.push_back(booking(10001 + i, 101 + rng() % 20, checkIn, nights, checkIn - lead));
+        if (i % 9 == 0) reservations.back().cancel();
+    }
+
+    PaceForecast pace(rooms, reservations, today, 60);
+    for (int i = 0; i < 3000; i++) {
+        RoomType type = static_cast<RoomType>(STANDARD + rng() % 4);
+        int day = today - 378 + static_cast<int>(rng() % 438);
+        int lead = rng() % (PaceForecast::MAX_LEAD + 1);
+        assert(pace.getOnTheBooks(type, day, lead) == naiveOnTheBooks(rooms, reservations, type, day, lead));
+    }
+    assert(pace.getInventory(STANDARD) == 5);
+    assert(pace.getOnTheBooks(STANDARD, pace.getLastDay() + 1, 0) == 0);
+    cout << "✓ Curves match a scan of every reservation, cancellations excluded\n";
+
+    // Folding bookings in one by one gives the same matrix as a rebuild
+    vector<Reservation> firstHalf(reservations.begin(), reservations.begin() + 300);
+    PaceForecast incremental(rooms, firstHalf, today, 60);
+    for (size_t i = 300; i < reservations.size(); i++) {
+        int roomNumber = reservations[i].getRoomNumber();
+        incremental.addBooking(reservations[i], rooms[roomNumber - 101].getType());
+    }
+    for (int t = STANDARD; t <= PRESIDENTIAL; t++) {
+        RoomType type = static_cast<RoomType>(t);
+        for (int day = today - 378; day <= pace.getLastDay(); day++) {
+            for (int lead = 0; lead <= PaceForecast::MAX_LEAD; lead++) {
+                assert(incremental.getOnTheBooks(type, day, lead) == pace.getOnTheBooks(type, day, lead));
+            }
+        }
+    }
+    cout << "✓ addBooking matches a full rebuild\n";
+
+    cout << "Booking Curve Tests: PASSED\n\n";
+}
+
+void testPickupForecast() {
+    cout << "Testing Pickup Forecast...\n";
+
+    const int today = Calendar::daysFromCivil(2025, 6, 1);
+    const int night = today + 10;
+    const int lastYear = night - PaceForecast::YEAR_OFFSET;
+    vector<Room> rooms = { Room(101, STANDARD, 100.0, 2), Room(102, STANDARD, 100.0, 2) };
+
+    vector<Reservation> reservations = {
+        booking(10001, 101, lastYear, 1, lastYear - 20),            // On the books by lead 10
+        booking(10002, 102, lastYear, 1, lastYear - 3),             // Picked up inside lead 10
+        booking(10003, 101, lastYear + 7, 1, lastYear + 7 - 5),     // Picked up inside lead 10
+        booking(10004, 101, night - 1, 1, today - 20)               // Neighbouring night, not counted
+    };
+    PaceForecast pace(rooms, reservations, today, 30);
+
+    PaceNight forecast = pace.getNight(STANDARD, night);
+    assert(forecast.inventory == 2);
+    assert(forecast.onTheBooks == 0);
+    assert(forecast.sameTimeLastYear == 1);
+    assert(forecast.lastYearFinal == 2);
+    // Five reference weeks picked up 1, 1, 0, 0, 0 room-nights
+    assert(near(forecast.forecast, 2.0 / 5));
+    cout << "✓ Pickup averaged over the reference weeks\n";
+
+    Reservation current = booking(10005, 101, night, 1, today - 20);
+    pace.addBooking(current, STANDARD);
+    pace.addBooking(booking(10006, 102, night, 1, today), STANDARD);
+    forecast = pace.getNight(STANDARD, night);
+    assert(forecast.onTheBooks == 2);
+    assert(near(forecast.forecast, 2.0));      // Capped at the inventory
+    assert(near(forecast.forecastOccupancy(), 100.0));
+
+    PaceNight neighbour = pace.getNight(STANDARD, night - 1);
+    assert(neighbour.onTheBooks == 1 && near(neighbour.forecast, 1.0));   // No pickup last year
+    PaceNight history = pace.getNight(STANDARD, lastYear);
+    assert(near(history.forecast, history.onTheBooks));
+    cout << "✓ Forecast is capped at inventory, past nights keep their actuals\n";
+
+    PaceNight period = pace.getPeriod(night - 1, night);
+    assert(period.inventory == 4 && period.onTheBooks == 3);
+    cout << "✓ Periods sum nights across room types\n";
+
+    cout << "Pickup Forecast Tests: PASSED\n\n";
+}
+
+void benchmarkForecast() {
+    cout << "Benchmarking Pace Forecast...\n";
+
+    const int today = Calendar::daysFromCivil(2025, 6, 1);
+    const int HORIZON = 365;
+    const int ROOMS = 300;
+    vector<Room> rooms;
+    for (int i = 0; i < ROOMS; i++) {
+        rooms.emplace_back(101 + i, static_cast<RoomType>(STANDARD + i % 4), 100.0, 2);
+    }
+
+    // Two years of back-to-back stays plus a year of future bookings made so far
+    mt19937 rng(11);
+    vector<Reservation> reservations;
+    int id = 10001;
+    for (int r = 0; r < ROOMS; r++) {
+        for (int day = today - 730 + static_cast<int>(rng() % 4); day < today + HORIZON; ) {
+            int nights = 1 + rng() % 5;
+            int bookedDay = day - static_cast<int>(rng() % 150);
+            if (bookedDay <= today) {
+                reservations.push_back(booking(id++, 101 + r, day, nights, bookedDay));
+            }
+            day += nights + rng() % 3;
+        }
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    PaceForecast pace(rooms, reservations, today, HORIZON);
+    auto built = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    double forecast = 0.0;
+    for (int day = today; day < today + HORIZON; day++) {
+        forecast += pace.getNight(day).forecast;
+    }
+    auto projected = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+    assert(forecast > 0.0 && forecast <= static_cast<double>(ROOMS) * HORIZON);
+
+    // The obvious way: scan every reservation for each night's OTB and STLY
+    const int NAIVE_NIGHTS = 30;
+    start = chrono::high_resolution_clock::now();
+    for (int day = today; day < today + NAIVE_NIGHTS; day++) {
+        int onTheBooks = 0, lastYear = 0;
+        for (const auto& reservation : reservations) {
+            int in = Utils::toEpochDay(reservation.getRawCheckIn());
+            int out = Utils::toEpochDay(reservation.getRawCheckOut());
+            int bookedDay = Utils::localEpochDay(reservation.getRawBookingDate());
+            if (in <= day && day < out) onTheBooks++;
+            int reference = day - PaceForecast::YEAR_OFFSET;
+            if (in <= reference && reference < out && bookedDay <= today - PaceForecast::YEAR_OFFSET) lastYear++;
+        }
+        assert(onTheBooks == pace.getNight(day).onTheBooks);
+        assert(lastYear == pace.getNight(day).sameTimeLastYear);
+    }
+    auto scanned = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < 1000; i++) {
+        pace.addBooking(booking(id++, 101 + i % ROOMS, today + 100 + i % 200, 3, today), STANDARD);
+    }
+    auto added = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    cout << "✓ " << reservations.size() << " reservations, " << ROOMS << " rooms, "
+         << HORIZON << "-night horizon\n";
+    cout << "  Build booking curves:       " << built.count() / 1000.0 << " ms\n";
+    cout << "  Forecast " << HORIZON << " nights:       " << projected.count() / 1000.0 << " ms\n";
+    cout << "  Scan per night (" << NAIVE_NIGHTS << " nights): " << scanned.count() / 1000.0 << " ms\n";
+    cout << "  1000 x addBooking:          " << added.count() / 1000.0 << " ms\n";
+    cout << "Pace Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     PACE FORECAST TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testBookingCurves();
+        testPickupForecast();
+        benchmarkForecast();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,128 @@
+#include "RoomPopularity.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+static Reservation stay(int id, int roomNumber, int checkInDay, int nights, double rate) {
+    return Reservation(id, 1001, roomNumber, Calendar::fromEpochDay(checkInDay),
+                       Calendar::fromEpochDay(checkInDay + nights), 2, rate);
+}
+
+void testCounters() {
+    cout << "Testing Popularity Counters...\n";
+
+    const int base = Calendar::daysFromCivil(2025, 5, 1);
+    vector<Room> rooms = {
+        Room(101, STANDARD, 100.0, 2), Room(102, STANDARD, 100.0, 2),
+        Room(201, DELUXE, 200.0, 3), Room(301, SUITE, 400.0, 4)
+    };
+    RoomPopularity popularity;
+
+    Reservation a = stay(10001, 101, base, 2, 100.0);
+    Reservation b = stay(10002, 201, base, 5, 200.0);
+    Reservation c = stay(10003, 101, base + 3, 1, 100.0);
+    Reservation d = stay(10004, 301, base, 1, 400.0);
+    for (const auto* r : {&a, &b, &c, &d}) popularity.track(*r, 1);
+
+    assert(popularity.getUsage(101).bookings == 2);
+    assert(popularity.getUsage(101).roomNights == 3);
+    assert(popularity.getUsage(201).revenue == 1000.0);
+    cout << "✓ Bookings, nights and revenue counted\n";
+
+    vector<RoomPopularityEntry> top = popularity.topRooms(rooms, 2);
+    assert(top.size() == 2);
+    assert(top[0].roomNumber == 201 && top[1].roomNumber == 101);
+    assert(popularity.topRooms(rooms, 1, BY_BOOKINGS)[0].roomNumber == 101);
+    assert(popularity.topRooms(rooms, 1, BY_REVENUE)[0].roomNumber == 201);
+    cout << "✓ Ranking by each metric passed\n";
+
+    // A cancellation is a -1 of the old state and a +1 of the new one
+    popularity.track(b, -1);
+    b.cancel();
+    popularity.track(b, 1);
+    assert(popularity.getUsage(201).bookings == 0);
+    top = popularity.topRooms(rooms, 10);
+    assert(top.size() == rooms.size());
+    assert(top[0].roomNumber == 101 && top[1].roomNumber == 301);
+    cout << "✓ Cancellation removes the booking\n";
+
+    vector<RoomPopularityEntry> byType = popularity.usageByType(rooms);
+    assert(byType[STANDARD - 1].usage.roomNights == 3);
+    assert(byType[DELUXE - 1].usage.roomNights == 0);
+    cout << "✓ Per-type usage passed\n";
+
+    vector<Reservation> reservations = {a, b, c, d};
+    vector<RoomPopularityEntry> window =
+        RoomPopularity::topRoomsInWindow(rooms, reservations, base + 1, base + 3, 2);
+    assert(window[0].roomNumber == 101);
+    assert(window[0].usage.roomNights == 2 && window[0].usage.bookings == 2);
+    assert(window[1].usage.roomNights == 0);
+    cout << "✓ Windowed ranking counts only nights inside the window\n";
+
+    cout << "Popularity Counter Tests: PASSED\n\n";
+}
+
+void benchmarkTopK() {
+    cout << "Benchmarking Top-K Selection...\n";
+
+    const int ROOMS = 200000;
+    const int K = 10;
+    vector<RoomPopularityEntry> entries;
+    unsigned seed = 777;
+    for (int r = 0; r < ROOMS; r++) {
+        seed = seed * 1103515245u + 12345u;
+        RoomUsage usage;
+        usage.roomNights = static_cast<int>((seed >> 8) % 5000);
+        entries.push_back({101 + r, STANDARD, usage});
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    vector<RoomPopularityEntry> sorted = entries;
+    sort(sorted.begin(), sorted.end(), [](const RoomPopularityEntry& a, const RoomPopularityEntry& b) {
+        return a.usage.roomNights != b.usage.roomNights ? a.usage.roomNights > b.usage.roomNights
+                                                        : a.roomNumber < b.roomNumber;
+    });
+    sorted.resize(K);
+    auto fullSort = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    vector<RoomPopularityEntry> top = RoomPopularity::selectTop(entries, K, BY_ROOM_NIGHTS);
+    auto heap = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    assert(top.size() == static_cast<size_t>(K));
+    for (int i = 0; i < K; i++) {
+        assert(top[i].roomNumber == sorted[i].roomNumber);
+    }
+
+    cout << "✓ Top " << K << " of " << ROOMS << " rooms matches a full sort\n";
+    cout << "  full sort:        " << fullSort.count() << " us\n";
+    cout << "  bounded min-heap: " << heap.count() << " us\n";
+
+    cout << "Top-K Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     ROOM POPULARITY TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testCounters();
+        benchmarkTopK();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
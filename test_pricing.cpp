@@ -0,0 +1,225 @@
+#include "Database.h"
+#include "PricingEngine.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+
+using namespace std;
+
+static bool near(double a, double b) {
+    return fabs(a - b) < 1e-9 * max(1.0, fabs(b));
+}
+
+// Walks the rule set for every night, the way it would be done without tables
+static double naiveTotal(const PricingRules& rules, double price, const vector<int>& soldByNight,
+                         int inventory, CustomerTier tier) {
+    double total = 0.0;
+    for (int sold : soldByNight) {
+        double occupancy = static_cast<double>(sold) / inventory;
+        double multiplier = 1.0, best = -1.0;
+        for (const auto& band : rules.bands) {
+            if (band.minOccupancy <= occupancy + 1e-12 && band.minOccupancy > best) {
+                best = band.minOccupancy;
+                multiplier = band.multiplier;
+            }
+        }
+        total += price * multiplier;
+    }
+    double stay = 0.0;
+    int reached = 0;
+    for (const auto& tier : rules.stayDiscounts) {
+        if (tier.minNights <= static_cast<int>(soldByNight.size()) && tier.minNights > reached) {
+            reached = tier.minNights;
+            stay = tier.discount;
+        }
+    }
+    return total * (1.0 - stay) * (1.0 - rules.tierDiscount[tier]);
+}
+
+void testLookupTables() {
+    cout << "Testing Pricing Tables...\n";
+
+    PricingEngine engine;
+    assert(near(engine.getMultiplier(0, 10), 0.90));
+    assert(near(engine.getMultiplier(3, 10), 0.90));
+    assert(near(engine.getMultiplier(4, 10), 1.00));
+    assert(near(engine.getMultiplier(7, 10), 1.10));
+    assert(near(engine.getMultiplier(9, 10), 1.25));
+    assert(near(engine.getMultiplier(19, 20), 1.40));
+    assert(near(engine.getMultiplier(12, 10), 1.40));   // Overbooked
+    cout << "✓ Occupancy bands\n";
+
+    assert(near(engine.getStayDiscount(6), 0.0));
+    assert(near(engine.getStayDiscount(7), HotelConstants::WEEKLY_DISCOUNT));
+    assert(near(engine.getStayDiscount(29), HotelConstants::WEEKLY_DISCOUNT));
+    assert(near(engine.getStayDiscount(30), HotelConstants::MONTHLY_DISCOUNT));
+    assert(near(engine.getStayDiscount(90), HotelConstants::MONTHLY_DISCOUNT));
+    cout << "✓ Length-of-stay discounts\n";
+
+    Customer guest(1001, "Ann Lee", "ann@example.com", "5551234567", "1 Main St", "ID1");
+    assert(engine.tierOf(guest, false) == TIER_STANDARD);
+    assert(engine.tierOf(guest, true) == TIER_CORPORATE);
+    for (int i = 0; i < HotelConstants::LOYALTY_MIN_VISITS; i++) guest.addVisit(100.0);
+    assert(engine.tierOf(guest, false) == TIER_LOYALTY);
+    assert(near(engine.getCustomerDiscount(TIER_LOYALTY), HotelConstants::LOYALTY_DISCOUNT));
+    assert(near(engine.getCustomerDiscount(TIER_CORPORATE), HotelConstants::CORPORATE_DISCOUNT));
+    cout << "✓ Customer tiers\n";
+
+    PricingRules bad = PricingRules::defaults();
+    bad.stayDiscounts.push_back({14, 1.5});
+    bool caught = false;
+    try {
+        PricingEngine rejected(bad);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Invalid rules are rejected\n";
+
+    cout << "Pricing Table Tests: PASSED\n\n";
+}
+
+void testQuotes() {
+    cout << "Testing Rate Quotes...\n";
+
+    PricingEngine engine;
+    Room room(101, DELUXE, 200.0, 3);
+    // 7 nights: 2 quiet, 3 normal, 2 nearly full out of 10 rooms
+    vector<int> sold = {1, 2, 5, 5, 6, 9, 10};
+    RateQuote quote = engine.quote(room, sold, 10, TIER_CORPORATE);
+
+    double occupancy = 200.0 * (0.9 + 0.9 + 1.0 + 1.0 + 1.0 + 1.25 + 1.4);
+    assert(quote.nights == 7);
+    assert(near(quote.baseTotal, 1400.0));
+    assert(near(quote.occupancyTotal, occupancy));
+    assert(near(quote.stayDiscount, occupancy * HotelConstants::WEEKLY_DISCOUNT));
+    assert(near(quote.total, occupancy * (1 - HotelConstants::WEEKLY_DISCOUNT) *
+                                         (1 - HotelConstants::CORPORATE_DISCOUNT)));
+    assert(near(quote.total, quote.occupancyTotal - quote.stayDiscount - quote.customerDiscount));
+    assert(near(quote.averageRate(), quote.total / 7));
+    cout << "✓ Quote breakdown\n";
+
+    // Every room of a type against the rule walk
+    vector<Room> rooms;
+    vector<const Room*> pointers;
+    for (int i = 0; i < 50; i++) rooms.emplace_back(201 + i, SUITE, 350.0 + i * 7.5, 4);
+    for (const auto& r : rooms) pointers.push_back(&r);
+    vector<int> month(31);
+    for (int i = 0; i < 31; i++) month[i] = (i * 7) % 51;
+    vector<RateQuote> quotes = engine.quoteRooms(pointers, month, 50, TIER_LOYALTY);
+    for (size_t i = 0; i < rooms.size(); i++) {
+        assert(quotes[i].roomNumber == rooms[i].getRoomNumber());
+        assert(near(quotes[i].total, naiveTotal(engine.getRules(), rooms[i].getPricePerNight(),
+                                                month, 50, TIER_LOYALTY)));
+    }
+    cout << "✓ Table quotes match the rule walk\n";
+
+    cout << "Rate Quote Tests: PASSED\n\n";
+}
+
+void testDatabasePricing() {
+    cout << "Testing Database Pricing...\n";
+
+    Database db;
+    int today = Utils::getTodayEpochDay();
+    time_t checkIn = Calendar::fromEpochDay(today + 400);
+    time_t checkOut = Calendar::fromEpochDay(today + 403);
+
+    int roomNumber = db.addRoom(PRESIDENTIAL, 1000.0, 6);
+    RateQuote before = db.quoteStay(roomNumber, checkIn, checkOut, 1001);
+    assert(before.nights == 3);
+
+    // Fill the other presidential rooms for those nights
+    vector<RateQuote> suites = db.quoteRoomType(PRESIDENTIAL, checkIn, checkOut, 1001);
+    for (const auto& suite : suites) {
+        if (suite.roomNumber == roomNumber) continue;
+        Room* other = db.findRoom(suite.roomNumber);
+        if (other && other->isAvailable()) {
+            db.makeReservation(1001, suite.roomNumber, checkIn, checkOut, 1);
+        }
+    }
+    RateQuote after = db.quoteStay(roomNumber, checkIn, checkOut, 1001);
+    assert(after.total >= before.total);
+
+    int reservationId = db.makeReservation(1001, roomNumber, checkIn, checkOut, 2);
+    Reservation* reservation = db.findReservation(reservationId);
+    assert(near(reservation->getRoomRate(), round(after.averageRate() * 100.0) / 100.0));
+    cout << "✓ Bookings are priced from the quote, occupancy raises it\n";
+
+    bool caught = false;
+    try {
+        db.quoteStay(roomNumber, checkOut, checkIn, 1001);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Reversed dates are rejected\n";
+
+    cout << "Database Pricing Tests: PASSED\n\n";
+}
+
+void benchmarkQuotes() {
+    cout << "Benchmarking Rate Quotes...\n";
+
+    const int ROOMS = 1000;
+    const int NIGHTS = 30;
+    const int ROUNDS = 200;
+    PricingEngine engine;
+    vector<Room> rooms;
+    vector<const Room*> pointers;
+    for (int i = 0; i < ROOMS; i++) rooms.emplace_back(101 + i, STANDARD, 100.0 + i % 100, 2);
+    for (const auto& r : rooms) pointers.push_back(&r);
+    vector<int> sold(NIGHTS);
+    for (int i = 0; i < NIGHTS; i++) sold[i] = (i * 97) % (ROOMS + 1);
+
+    auto start = chrono::high_resolution_clock::now();
+    double walked = 0.0;
+    for (int round = 0; round < ROUNDS; round++) {
+        for (const auto& room : rooms) {
+            walked += naiveTotal(engine.getRules(), room.getPricePerNight(), sold, ROOMS, TIER_STANDARD);
+        }
+    }
+    auto naive = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    double tabled = 0.0;
+    for (int round = 0; round < ROUNDS; round++) {
+        for (const auto& quote : engine.quoteRooms(pointers, sold, ROOMS, TIER_STANDARD)) {
+            tabled += quote.total;
+        }
+    }
+    auto compiled = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    assert(near(walked, tabled));
+    cout << "✓ " << NIGHTS << "-night stay over " << ROOMS << " rooms of a type\n";
+    cout << "  Rule walk per room:  " << naive.count() / ROUNDS << " us per quote\n";
+    cout << "  Compiled tables:     " << compiled.count() / ROUNDS << " us per quote\n";
+    cout << "Pricing Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     PRICING ENGINE TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testLookupTables();
+        testQuotes();
+        testDatabasePricing();
+        benchmarkQuotes();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
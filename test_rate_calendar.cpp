@@ -0,0 +1,242 @@
+#include "Database.h"
+#include "RateCalendar.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+#include <random>
+
+using namespace std;
+
+static bool near(double a, double b) {
+    return fabs(a - b) < 1e-9 * max(1.0, fabs(b));
+}
+
+// One night at a time, the obvious way
+static double naiveStayCost(const RateCalendar& calendar, const Room& room, int checkInDay, int checkOutDay) {
+    double total = 0.0;
+    for (int day = checkInDay; day < checkOutDay; day++) {
+        total += calendar.getNightlyRate(room, day);
+    }
+    return total;
+}
+
+void testRangeSums() {
+    cout << "Testing Rate Calendar Sums...\n";
+
+    const int first = Calendar::daysFromCivil(2025, 1, 1);
+    RateCalendar calendar(first, 365);
+    Room standard(101, STANDARD, 100.0, 2);
+    Room suite(301, SUITE, 400.0, 4);
+
+    assert(near(calendar.stayCost(standard, first + 10, first + 13), 300.0));
+    calendar.setTypeFactor(STANDARD, first + 11, first + 12, 1.5);
+    assert(near(calendar.stayCost(standard, first + 10, first + 13), 100.0 + 150.0 + 150.0));
+    assert(near(calendar.getTypeFactor(STANDARD, first + 12), 1.5));
+    assert(near(calendar.getTypeFactor(SUITE, first + 12), 1.0));
+    cout << "✓ Seasonal factor applies to the nights it covers\n";
+
+    // Nights outside the horizon fall back to the base price
+    assert(near(calendar.stayCost(suite, first - 2, first + 1), 1200.0));
+    assert(near(calendar.stayCost(suite, first + 364, first + 366), 800.0));
+    cout << "✓ Nights outside the horizon use the base price\n";
+
+    mt19937 rng(3);
+    for (int i = 0; i < 200; i++) {
+        RoomType type = static_cast<RoomType>(STANDARD + rng() % 4);
+        int from = first - 20 + static_cast<int>(rng() % 400);
+        int to = from + static_cast<int>(rng() % 60);
+        calendar.setTypeFactor(type, from, to, 0.5 + (rng() % 100) / 50.0);
+    }
+    calendar.setRoomRate(suite, first + 100, first + 130, 999.0);
+    for (int i = 0; i < 2000; i++) {
+        const Room& room = (i % 2) ? suite : standard;
+        int checkIn = first - 30 + static_cast<int>(rng() % 420);
+        int checkOut = checkIn + 1 + static_cast<int>(rng() % 45);
+        assert(near(calendar.stayCost(room, checkIn, checkOut), naiveStayCost(calendar, room, checkIn, checkOut)));
+    }
+    cout << "✓ Prefix sums match the night-by-night total\n";
+
+    // A room's own prices replace only their nights; the rest keep
+    // following later seasonal factors and base price changes
+    assert(calendar.hasRoomRates(301));
+    assert(near(calendar.getNightlyRate(suite, first + 110), 999.0));
+    calendar.setTypeFactor(SUITE, first + 110, first + 110, 0.5);
+    calendar.setTypeFactor(SUITE, first + 200, first + 200, 3.0);
+    assert(near(calendar.getNightlyRate(suite, first + 110), 999.0));
+    assert(near(calendar.getNightlyRate(suite, first + 200), 1200.0));
+    suite.setPrice(500.0);
+    assert(near(calendar.getNightlyRate(suite, first + 200), 1500.0));
+    assert(near(calendar.stayCost(suite, first + 129, first + 132),
+                999.0 * 2 + 500.0 * calendar.getTypeFactor(SUITE, first + 131)));
+    for (int i = 0; i < 200; i++) {
+        int checkIn = first + 90 + static_cast<int>(rng() % 120);
+        int checkOut = checkIn + 1 + static_cast<int>(rng() % 30);
+        assert(near(calendar.stayCost(suite, checkIn, checkOut), naiveStayCost(calendar, suite, checkIn, checkOut)));
+    }
+    calendar.clearRoomRates(301);
+    assert(near(calendar.getNightlyRate(suite, first + 110), 250.0));
+    cout << "✓ Room rates override their nights only\n";
+
+    bool caught = false;
+    try {
+        calendar.setTypeFactor(DELUXE, first + 5, first + 4, 1.2);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    caught = false;
+    try {
+        calendar.setRoomRate(standard, first, first + 3, 0.0);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Invalid rates are rejected\n";
+
+    cout << "Rate Calendar Tests: PASSED\n\n";
+}
+
+static double totalFor(const vector<RoomStayCost>& rooms, int roomNumber) {
+    for (const auto& room : rooms) {
+        if (room.roomNumber == roomNumber) return room.total;
+    }
+    return -1.0;
+}
+
+void testDatabaseRates() {
+    cout << "Testing Database Rates...\n";
+
+    int today = Utils::getTodayEpochDay();
+    time_t checkIn = Calendar::fromEpochDay(today + 200);
+    time_t checkOut = Calendar::fromEpochDay(today + 204);
+    int cheapRoom, bookedRoom;
+    {
+        Database db;
+        cheapRoom = db.addRoom(STANDARD, 51.0, 2);
+        bookedRoom = db.addRoom(STANDARD, 50.0, 2);
+        db.makeReservation(1001, bookedRoom, checkIn, checkOut, 2);
+
+        // The booked room is cheaper, but not free for those nights
+        vector<RoomStayCost> cheapest = db.findCheapestRooms(checkIn, checkOut, 2, db.getRoomCount());
+        assert(!cheapest.empty() && cheapest[0].total <= 204.0);
+        for (size_t i = 1; i < cheapest.size(); i++) assert(cheapest[i - 1].total <= cheapest[i].total);
+        assert(near(totalFor(cheapest, cheapRoom), 204.0));
+        assert(totalFor(cheapest, bookedRoom) < 0);
+        assert(db.findCheapestRooms(checkIn, checkOut, 2, 1).size() == 1);
+        cout << "✓ Cheapest rooms skip booked rooms and come sorted\n";
+
+        RateQuote base = db.quoteStay(cheapRoom, checkIn, checkOut, 1001);
+        db.setSeasonalRate(STANDARD, Calendar::fromEpochDay(today + 202), Calendar::fromEpochDay(today + 210), 2.0);
+        RateQuote peak = db.quoteStay(cheapRoom, checkIn, checkOut, 1001);
+        assert(near(peak.baseTotal, 51.0 * 6));
+        assert(near(peak.occupancyTotal, base.occupancyTotal * 1.5));
+        cout << "✓ Quotes follow the seasonal factor\n";
+
+        db.setRoomRate(cheapRoom, checkIn, checkOut, 40.0);
+        assert(near(totalFor(db.findCheapestRooms(checkIn, checkOut, 2, db.getRoomCount()), cheapRoom), 40.0 * 4));
+
+        // Nights without a room rate follow a new base price at once
+        time_t later = Calendar::fromEpochDay(today + 206);
+        db.modifyRoom(cheapRoom, 60.0, {});
+        assert(near(totalFor(db.findCheapestRooms(checkIn, later, 2, db.getRoomCount()), cheapRoom),
+                    40.0 * 5 + 60.0 * 2.0 * 1));
+        cout << "✓ Room rates keep the seasonal factor and base price for other nights\n";
+    }
+    {
+        // Rates are saved and replayed on load
+        Database db;
+        const RateCalendar& calendar = db.getRateCalendar();
+        Room* room = db.findRoom(cheapRoom);
+        assert(near(calendar.getNightlyRate(*room, today + 201), 40.0));
+        assert(near(calendar.getTypeFactor(STANDARD, today + 205), 2.0));
+        db.clearRoomRates(cheapRoom);
+        db.clearSeasonalRates(STANDARD);
+        assert(!db.getRateCalendar().hasRoomRates(cheapRoom));
+        assert(near(db.getRateCalendar().getTypeFactor(STANDARD, today + 205), 1.0));
+    }
+    cout << "✓ Rates survive a reload and can be cleared\n";
+
+    cout << "Database Rate Tests: PASSED\n\n";
+}
+
+void benchmarkCheapestRoom() {
+    cout << "Benchmarking Cheapest Room Search...\n";
+
+    const int ROOMS = 1000;
+    const int NIGHTS = 30;
+    const int SEARCHES = 200;
+    const int first = Calendar::daysFromCivil(2025, 1, 1);
+    RateCalendar calendar(first, 425);
+    mt19937 rng(5);
+    vector<Room> rooms;
+    for (int i = 0; i < ROOMS; i++) {
+        rooms.emplace_back(101 + i, static_cast<RoomType>(STANDARD + i % 4), 80.0 + rng() % 400, 2);
+    }
+    for (int i = 0; i < 120; i++) {
+        int from = first + static_cast<int>(rng() % 400);
+        calendar.setTypeFactor(static_cast<RoomType>(STANDARD + rng() % 4), from, from + 20, 0.7 + (rng() % 10) / 10.0);
+    }
+    for (int i = 0; i < ROOMS; i += 10) {
+        int from = first + static_cast<int>(rng() % 400);
+        calendar.setRoomRate(rooms[i], from, from + 14, 60.0 + rng() % 300);
+    }
+
+    auto cheapest = [&](auto cost, int checkIn) {
+        int best = 0;
+        double bestTotal = cost(rooms[0], checkIn, checkIn + NIGHTS);
+        for (int i = 1; i < ROOMS; i++) {
+            double total = cost(rooms[i], checkIn, checkIn + NIGHTS);
+            if (total < bestTotal) { bestTotal = total; best = i; }
+        }
+        return best;
+    };
+
+    auto start = chrono::high_resolution_clock::now();
+    long long naiveSum = 0;
+    for (int s = 0; s < SEARCHES; s++) {
+        naiveSum += cheapest([&](const Room& room, int in, int out) {
+            return naiveStayCost(calendar, room, in, out);
+        }, first + s);
+    }
+    auto perNight = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    long long prefixSum = 0;
+    for (int s = 0; s < SEARCHES; s++) {
+        prefixSum += cheapest([&](const Room& room, int in, int out) {
+            return calendar.stayCost(room, in, out);
+        }, first + s);
+    }
+    auto ranged = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    assert(naiveSum == prefixSum);
+    cout << "✓ " << NIGHTS << "-night stay, cheapest of " << ROOMS << " rooms\n";
+    cout << "  Night-by-night totals: " << perNight.count() / SEARCHES << " us per search\n";
+    cout << "  Prefix-sum totals:     " << ranged.count() / SEARCHES << " us per search\n";
+    cout << "Rate Calendar Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     RATE CALENDAR TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testRangeSums();
+        testDatabaseRates();
+        benchmarkCheapestRoom();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,199 @@
+#include "Database.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+
+using namespace std;
+
+static string readAll(const string& path) {
+    ifstream file(path, ios::binary);
+    stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+static size_t countLines(const string& path) {
+    ifstream file(path, ios::binary);
+    size_t lines = 0;
+    string line;
+    while (getline(file, line)) lines++;
+    return lines;
+}
+
+static long long fileSize(const string& path) {
+    ifstream file(path, ios::binary | ios::ate);
+    return file.is_open() ? static_cast<long long>(file.tellg()) : -1;
+}
+
+void testCells() {
+    cout << "Testing Report Writer Cells...\n";
+
+    {
+        ReportWriter writer("test_report.csv", EXPORT_CSV);
+        writer.header({"name", "note", "amount", "count"});
+        writer.cell("Smith, John");
+        writer.cell("said \"hi\"");
+        writer.cell(1234.5);
+        writer.cell(7);
+        writer.endRow();
+        writer.cell("plain");
+        writer.cell("");
+        writer.cell(-0.004);
+        writer.cell(1234567890123LL);
+        writer.endRow();
+        ExportResult result = writer.close();
+        assert(result.rows == 2);
+        assert(result.path == "test_report.csv");
+    }
+    assert(readAll("test_report.csv") ==
+           "name,note,amount,count\n"
+           "\"Smith, John\",\"said \"\"hi\"\"\",1234.50,7\n"
+           "plain,,-0.00,1234567890123\n");
+    cout << "✓ CSV quoting and number formatting passed\n";
+
+    {
+        ReportWriter writer("test_report.tsv", EXPORT_TSV);
+        writer.header({"a", "b"});
+        writer.cell("Smith, John");
+        writer.cell("tab\there");
+        writer.endRow();
+        writer.close();
+    }
+    assert(readAll("test_report.tsv") == "a\tb\nSmith, John\t\"tab\there\"\n");
+    cout << "✓ TSV only quotes tabs, quotes and newlines\n";
+
+    bool caught = false;
+    try {
+        ReportWriter writer("no_such_directory/report.csv", EXPORT_CSV);
+    } catch (const FileWriteException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Unwritable path throws FileWriteException\n";
+
+    remove("test_report.csv");
+    remove("test_report.tsv");
+    cout << "Report Writer Cell Tests: PASSED\n\n";
+}
+
+void testStreaming() {
+    cout << "Testing Streaming Writes...\n";
+
+    const int ROWS = 200000;
+    {
+        ReportWriter writer("test_stream.csv", EXPORT_CSV);
+        writer.header({"id", "value"});
+        bool flushedEarly = false;
+        for (int i = 0; i < ROWS; i++) {
+            writer.cell(i);
+            writer.cell(i * 0.5);
+            writer.endRow();
+            if (i == ROWS / 2) flushedEarly = fileSize("test_stream.csv") > 0;
+        }
+        // Data reaches the disk while rows are still being written
+        assert(flushedEarly);
+        assert(writer.close().rows == static_cast<size_t>(ROWS));
+    }
+    assert(countLines("test_stream.csv") == static_cast<size_t>(ROWS) + 1);
+    remove("test_stream.csv");
+    cout << "✓ Buffer is flushed in chunks, no row is lost\n";
+
+    cout << "Streaming Tests: PASSED\n\n";
+}
+
+void testDatabaseExport() {
+    cout << "Testing Database Exports...\n";
+
+    Database db;
+    vector<ExportResult> results = db.exportAll(EXPORT_CSV);
+    assert(results.size() == 10);
+    for (const auto& result : results) {
+        assert(result.path.compare(0, HotelConstants::REPORT_DIR.size(), HotelConstants::REPORT_DIR) == 0);
+        assert(countLines(result.path) == result.rows + 1);
+    }
+    assert(results[0].rows == static_cast<size_t>(db.getRoomCount()));
+    assert(results[2].rows == static_cast<size_t>(db.getReservationCount()));
+    assert(results[6].rows == 365);
+
+    // Passwords are never exported
+    string employees = readAll(results[3].path);
+    assert(employees.find("password") == string::npos);
+    cout << "✓ Every table and report row reaches its file\n";
+
+    cout << "Database Export Tests: PASSED\n\n";
+}
+
+void benchmarkExport() {
+    cout << "Benchmarking Reservation Export...\n";
+
+    const int ROWS = 1000000;
+    const int base = Calendar::daysFromCivil(2025, 1, 1);
+    vector<Reservation> reservations;
+    reservations.reserve(ROWS);
+    for (int i = 0; i < ROWS; i++) {
+        reservations.emplace_back(10001 + i, 1001 + i % 5000, 101 + i % 1000,
+                                  Calendar::fromEpochDay(base + i % 700),
+                                  Calendar::fromEpochDay(base + i % 700 + 1 + i % 6), 2, 120.0);
+    }
+
+    // One ostream << chain per row, like the display functions
+    auto start = chrono::high_resolution_clock::now();
+    {
+        ofstream file("test_export_stream.csv");
+        file << "reservationId,customerId,roomNumber,checkIn,checkOut,guests,rate\n";
+        for (const auto& r : reservations) {
+            file << r.getReservationId() << "," << r.getCustomerId() << "," << r.getRoomNumber() << ","
+                 << r.getCheckInDate() << "," << r.getCheckOutDate() << ","
+                 << r.getNumberOfGuests() << "," << r.getRoomRate() << "\n";
+        }
+    }
+    auto chained = chrono::duration_cast<chrono::milliseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    size_t rows;
+    {
+        ReportWriter writer("test_export_writer.csv", EXPORT_CSV);
+        writer.table(reservations);
+        rows = writer.close().rows;
+    }
+    auto buffered = chrono::duration_cast<chrono::milliseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    assert(rows == static_cast<size_t>(ROWS));
+    long long bytes = fileSize("test_export_writer.csv");
+    cout << "✓ Exported " << ROWS << " reservations (" << bytes / (1024 * 1024) << " MB)\n";
+    cout << "  ostream << per row:  " << chained.count() << " ms\n";
+    cout << "  ReportWriter:        " << buffered.count() << " ms\n";
+
+    remove("test_export_stream.csv");
+    remove("test_export_writer.csv");
+    cout << "Export Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     REPORT EXPORT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testCells();
+        testStreaming();
+        testDatabaseExport();
+        benchmarkExport();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
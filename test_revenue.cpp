@@ -0,0 +1,196 @@
+#include "RevenueLedger.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+
+using namespace std;
+
+static bool near(double a, double b) {
+    return fabs(a - b) < 1e-6;
+}
+
+// Writes a paid bill in the bills.dat record layout with a chosen payment instant
+static Bill paidBill(int billId, time_t paidAt, double room, double food, double service) {
+    {
+        ofstream file("test_revenue.dat");
+        file << billId << "|10001|0|0|1|Cash|" << paidAt << "\n3\n"
+             << "Room Charge (1 nights)|" << room << "|1\n"
+             << "Food - Coffee|" << food << "|1\n"
+             << "Service - Laundry|" << service << "|1\n";
+    }
+    ifstream file("test_revenue.dat");
+    Bill bill;
+    bill.loadFromFile(file);
+    return bill;
+}
+
+void testCategorize() {
+    cout << "Testing Revenue Categories...\n";
+
+    assert(RevenueLedger::categorize("Room Charge") == REVENUE_ROOM);
+    assert(RevenueLedger::categorize("Room Charge (3 nights)") == REVENUE_ROOM);
+    assert(RevenueLedger::categorize("Food - Coffee") == REVENUE_FOOD);
+    assert(RevenueLedger::categorize("Service - Spa") == REVENUE_SERVICE);
+    assert(RevenueLedger::categorize("Minibar") == REVENUE_SERVICE);
+    cout << "✓ Item descriptions categorized\n";
+
+    cout << "Revenue Category Tests: PASSED\n\n";
+}
+
+void testLedger() {
+    cout << "Testing Revenue Ledger...\n";
+
+    time_t now = time(nullptr);
+    int today = Utils::localEpochDay(now);
+    RevenueLedger ledger;
+
+    ledger.recordPayment(paidBill(5001, now, 100.0, 20.0, 5.0));
+    ledger.recordPayment(paidBill(5002, now - 3 * 86400, 200.0, 5.0, 10.0));
+    ledger.recordPayment(paidBill(5003, now - 10 * 86400, 50.0, 10.0, 5.0));
+
+    RevenueTotals day = ledger.getDay(today);
+    assert(near(day.total(), 125.0));
+    assert(near(day.amount[REVENUE_ROOM], 100.0));
+    assert(near(day.amount[REVENUE_FOOD], 20.0));
+    assert(day.payments == 1);
+    cout << "✓ Today's revenue is only today's payments\n";
+
+    assert(near(ledger.getPeriod(today - 6, today).total(), 340.0));
+    assert(near(ledger.getPeriod(today - 30, today).total(), 405.0));
+    assert(near(ledger.getPeriod(today + 1, today + 5).total(), 0.0));
+    assert(near(ledger.getAllTime().total(), 405.0));
+    assert(ledger.getAllTime().payments == 3);
+    cout << "✓ Period and all-time totals passed\n";
+
+    vector<RevenueTotals> series = ledger.getSeries(today, 7);
+    assert(series.size() == 7);
+    assert(near(series[6].total(), 125.0));
+    assert(near(series[3].total(), 215.0));
+    assert(near(series[5].total(), 0.0));
+    cout << "✓ Daily series passed\n";
+
+    // Tax and discount are spread over the categories
+    Bill bill(5004, 10001, 0.10, 0.5);
+    bill.addRoomCharge(100.0, 1);
+    bill.addServiceCharge("Spa", 100.0);
+    bill.processPayment("Card");
+    ledger.recordPayment(bill);
+    RevenueTotals after = ledger.getDay(today);
+    assert(near(after.total() - day.total(), bill.calculateTotal()));
+    assert(near(after.amount[REVENUE_ROOM] - day.amount[REVENUE_ROOM], 55.0));
+    cout << "✓ Categories add up to the bill total\n";
+
+    Bill unpaid(5005, 10001);
+    unpaid.addRoomCharge(100.0, 1);
+    ledger.recordPayment(unpaid);
+    assert(ledger.getAllTime().payments == 4);
+    cout << "✓ Unpaid bills are ignored\n";
+
+    cout << "Revenue Ledger Tests: PASSED\n\n";
+}
+
+void testPaidBillsClosed() {
+    cout << "Testing Paid Bills...\n";
+
+    Database db;
+    int today = Utils::getTodayEpochDay();
+    int room = db.addRoom(STANDARD, 95.0, 2);
+    int reservation = db.makeReservation(1001, room, Calendar::fromEpochDay(today + 30),
+                                         Calendar::fromEpochDay(today + 31), 1);
+    int billId = db.createBill(reservation);
+    db.addBillItem(billId, "Room Service", 40.0);
+    db.processPayment(billId, "Card");
+    double ledger = db.getRevenueLedger().getAllTime().total();
+    double cube = db.getKpiCube().getAllTime().totalRevenue();
+    double open = db.getKpiCube().getOpenCharges();
+
+    bool caught = false;
+    try {
+        db.addBillItem(billId, "Minibar", 12.0);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    assert(db.findBill(billId)->getItems().size() == 1);
+    assert(near(db.getRevenueLedger().getAllTime().total(), ledger));
+    assert(near(db.getKpiCube().getAllTime().totalRevenue(), cube));
+    assert(near(db.getKpiCube().getOpenCharges(), open));
+    cout << "✓ Items refused once paid; ledger and cube unchanged\n";
+
+    cout << "Paid Bill Tests: PASSED\n\n";
+}
+
+void benchmarkTodayRevenue() {
+    cout << "Benchmarking Today's Revenue...\n";
+
+    const int BILLS = 20000;
+    const int QUERIES = 200;
+    time_t now = time(nullptr);
+    int today = Utils::localEpochDay(now);
+    vector<Bill> year;
+    for (int d = 0; d < 365; d++) {
+        year.push_back(paidBill(5001 + d, now - d * 86400, 100.0, 10.0, 5.0));
+    }
+    vector<Bill> bills;
+    RevenueLedger ledger;
+    for (int i = 0; i < BILLS; i++) {
+        bills.push_back(year[i % 365]);
+        ledger.recordPayment(bills.back());
+    }
+    double checksum = 0;
+
+    // Previous approach: walk every bill per query
+    auto start = chrono::high_resolution_clock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        for (const auto& bill : bills) {
+            if (bill.getIsPaid() && Utils::localEpochDay(bill.getRawPaymentDate()) == today) {
+                checksum += bill.calculateTotal();
+            }
+        }
+    }
+    auto scan = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    for (int q = 0; q < QUERIES; q++) {
+        checksum += ledger.getDay(today).total() + ledger.getPeriod(today - 29, today).total();
+    }
+    auto indexed = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    cout << "✓ " << QUERIES << " queries over " << BILLS << " bills\n";
+    cout << "  scan all bills: " << scan.count() << " us\n";
+    cout << "  day ledger:     " << indexed.count() << " us\n";
+    cout << "  (checksum " << checksum << ")\n";
+
+    cout << "Today's Revenue Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     REVENUE LEDGER UNIT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testCategorize();
+        testLedger();
+        testPaidBillsClosed();
+        benchmarkTodayRevenue();
+
+        // Clean up test file
+        remove("test_revenue.dat");
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,278 @@
+#include "Database.h"
+#include "RoomAssigner.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <map>
+#include <algorithm>
+
+using namespace std;
+
+static Reservation stay(int id, int roomNumber, int firstDay, int nights, int guests = 2) {
+    return Reservation(id, 1001, roomNumber, Calendar::fromEpochDay(firstDay),
+                       Calendar::fromEpochDay(firstDay + nights), guests, 100.0);
+}
+
+static const RoomMove* findMove(const AssignmentPlan& plan, int reservationId) {
+    for (const auto& move : plan.moves) {
+        if (move.reservationId == reservationId) return &move;
+    }
+    return nullptr;
+}
+
+// Applies the plan to copies and checks every room still holds one guest a
+// night; orphan nights are counted over stays not over by the plan's first day
+static vector<Reservation> applyAndCheck(const vector<Room>& rooms, vector<Reservation> reservations,
+                                         const AssignmentPlan& plan, int fromDay, int minGap, int& orphanNights) {
+    map<int, const Room*> roomByNumber;
+    for (const auto& room : rooms) roomByNumber[room.getRoomNumber()] = &room;
+
+    for (const auto& move : plan.moves) {
+        for (auto& reservation : reservations) {
+            if (reservation.getReservationId() != move.reservationId) continue;
+            assert(reservation.getRoomNumber() == move.fromRoom);
+            assert(reservation.getStatus() == CONFIRMED && !reservation.isRoomPinned());
+            const Room* from = roomByNumber[move.fromRoom];
+            const Room* to = roomByNumber[move.toRoom];
+            assert(from->getType() == to->getType());
+            assert(to->canAccommodate(reservation.getNumberOfGuests()));
+            assert(to->getStatus() != MAINTENANCE);
+            reservation.setRoomNumber(move.toRoom);
+        }
+    }
+
+    map<int, vector<pair<int, int>>> nightsByRoom;
+    for (const auto& reservation : reservations) {
+        if (reservation.getStatus() != CONFIRMED && reservation.getStatus() != CHECKED_IN) continue;
+        if (Utils::toEpochDay(reservation.getRawCheckOut()) <= fromDay) continue;
+        nightsByRoom[reservation.getRoomNumber()].push_back({Utils::toEpochDay(reservation.getRawCheckIn()),
+                                                             Utils::toEpochDay(reservation.getRawCheckOut())});
+    }
+    orphanNights = 0;
+    for (auto& entry : nightsByRoom) {
+        sort(entry.second.begin(), entry.second.end());
+        for (size_t i = 1; i < entry.second.size(); i++) {
+            int gap = entry.second[i].first - entry.second[i - 1].second;
+            assert(gap >= 0);
+            if (gap > 0 && gap < minGap) orphanNights += gap;
+        }
+    }
+    return reservations;
+}
+
+void testSmallHotel() {
+    cout << "Testing Room Assignment...\n";
+
+    const int d0 = Calendar::daysFromCivil(2025, 6, 1);
+    vector<Room> rooms;
+    rooms.emplace_back(100, STANDARD, 100.0, 4);
+    rooms.back().setStatus(MAINTENANCE);
+    rooms.emplace_back(103, STANDARD, 100.0, 1);
+    rooms.emplace_back(101, STANDARD, 100.0, 2);
+    rooms.emplace_back(102, STANDARD, 100.0, 2);
+
+    vector<Reservation> reservations;
+    reservations.push_back(stay(1, 101, d0, 3));         // In house
+    reservations.back().checkIn();
+    reservations.push_back(stay(2, 101, d0 + 4, 3));     // One idle night either side
+    reservations.push_back(stay(3, 101, d0 + 8, 2));
+    reservations.back().setRoomPinned(true);
+    reservations.push_back(stay(4, 102, d0 + 7, 3));
+    reservations.back().setRoomPinned(true);
+
+    AssignmentPlan plan = RoomAssigner::plan(rooms, reservations, d0, d0 + 30);
+    assert(plan.movable == 1 && plan.fixed == 3 && plan.unplaced == 0);
+    assert(plan.orphanNightsBefore == 2 && plan.orphanNightsAfter == 0);
+    assert(plan.moves.size() == 1);
+    const RoomMove* move = findMove(plan, 2);
+    assert(move && move->fromRoom == 101 && move->toRoom == 102);
+    cout << "✓ Stay moved next to its neighbour, closing both gaps\n";
+    cout << "✓ Checked-in and pinned stays, small and closed rooms left alone\n";
+
+    // Arrivals outside the window are not touched
+    plan = RoomAssigner::plan(rooms, reservations, d0 + 5, d0 + 30);
+    assert(plan.movable == 0 && plan.moves.empty());
+    assert(plan.orphanNightsAfter == plan.orphanNightsBefore);
+    cout << "✓ Only arrivals inside the window move\n";
+
+    // A full house is repaired by moving the stay in the way
+    vector<Room> twoRooms;
+    twoRooms.emplace_back(201, DELUXE, 150.0, 2);
+    twoRooms.emplace_back(202, DELUXE, 150.0, 4);
+    vector<Reservation> tight;
+    tight.push_back(stay(10, 202, d0, 5, 2));
+    tight.push_back(stay(11, 201, d0 + 1, 3, 2));
+    tight.push_back(stay(12, 202, d0 + 5, 2, 4));
+    tight.push_back(stay(13, 201, d0 + 4, 2, 2));
+    plan = RoomAssigner::plan(twoRooms, tight, d0, d0 + 10);
+    int orphans = 0;
+    applyAndCheck(twoRooms, tight, plan, d0, RoomAssigner::DEFAULT_MIN_GAP, orphans);
+    assert(plan.unplaced == 0 && orphans == plan.orphanNightsAfter);
+    cout << "✓ Crowded rooms still end up without overlaps\n";
+
+    cout << "Room Assignment Tests: PASSED\n\n";
+}
+
+// Rooms filled one by one, the way a front desk that never looks back would
+static void randomHotel(int roomCount, int days, unsigned seed, vector<Room>& rooms,
+                        vector<Reservation>& reservations, int firstDay) {
+    mt19937 rng(seed);
+    int nextId = 1;
+    for (int i = 0; i < roomCount; i++) {
+        int capacity = (i % 3 == 0) ? 4 : 2;
+        rooms.emplace_back(101 + i, static_cast<RoomType>(STANDARD + i % 4), 100.0, capacity);
+        int day = firstDay - static_cast<int>(rng() % 3);
+        while (day < firstDay + days) {
+            int nights = 1 + static_cast<int>(rng() % 5);
+            int guests = 1 + static_cast<int>(rng() % capacity);
+            reservations.push_back(stay(nextId++, 101 + i, day, nights, guests));
+            if (day < firstDay) reservations.back().checkIn();
+            else if (rng() % 10 == 0) reservations.back().setRoomPinned(true);
+            else if (rng() % 20 == 0) reservations.back().cancel();
+            day += nights + static_cast<int>(rng() % 4);
+        }
+    }
+}
+
+void testRandomHotels() {
+    cout << "Testing Random Hotels...\n";
+
+    const int d0 = Calendar::daysFromCivil(2025, 3, 1);
+    for (unsigned seed = 1; seed <= 20; seed++) {
+        vector<Room> rooms;
+        vector<Reservation> reservations;
+        randomHotel(40, 45, seed, rooms, reservations, d0);
+        if (seed % 4 == 0) rooms[seed % rooms.size()].setStatus(MAINTENANCE);
+
+        AssignmentPlan plan = RoomAssigner::plan(rooms, reservations, d0, d0 + 30);
+        int before = 0, after = 0;
+        applyAndCheck(rooms, reservations, AssignmentPlan(), d0, RoomAssigner::DEFAULT_MIN_GAP, before);
+        vector<Reservation> moved = applyAndCheck(rooms, reservations, plan, d0, RoomAssigner::DEFAULT_MIN_GAP, after);
+        assert(before == plan.orphanNightsBefore);
+        assert(after == plan.orphanNightsAfter);
+        assert(after <= before);
+
+        for (size_t i = 0; i < reservations.size(); i++) {
+            int first = Utils::toEpochDay(reservations[i].getRawCheckIn());
+            bool movable = reservations[i].getStatus() == CONFIRMED && !reservations[i].isRoomPinned() &&
+                           first >= d0 && first <= d0 + 30;
+            if (!movable) assert(moved[i].getRoomNumber() == reservations[i].getRoomNumber());
+        }
+    }
+    cout << "✓ No double bookings, type or capacity changes across 20 hotels\n";
+    cout << "✓ Orphan nights never go up and only movable stays move\n";
+
+    cout << "Random Hotel Tests: PASSED\n\n";
+}
+
+void testDatabaseAssignments() {
+    cout << "Testing Database Assignments...\n";
+
+    int today = Utils::getTodayEpochDay();
+    int first, second, roomA, roomB;
+    {
+        Database db;
+        roomA = db.addRoom(SUITE, 300.0, 2);
+        roomB = db.addRoom(SUITE, 300.0, 2);
+        first = db.makeReservation(1001, roomA, Calendar::fromEpochDay(today + 300),
+                                   Calendar::fromEpochDay(today + 303), 2);
+        // Booked behind the first stay, one night apart
+        db.updateRoomStatus(roomA, AVAILABLE);
+        second = db.makeReservation(1001, roomA, Calendar::fromEpochDay(today + 304),
+                                    Calendar::fromEpochDay(today + 307), 2);
+
+        AssignmentPlan plan = db.planRoomAssignments(320);
+        assert(plan.orphanNightsAfter < plan.orphanNightsBefore);
+        assert(db.applyRoomAssignments(plan) == static_cast<int>(plan.moves.size()));
+        assert(db.findReservation(first)->getRoomNumber() != db.findReservation(second)->getRoomNumber());
+        // Both rooms of every move show the stays they are left with
+        shared_ptr<const DatabaseSnapshot> view = db.snapshot();
+        for (const auto& move : plan.moves) {
+            for (int roomNumber : {move.fromRoom, move.toRoom}) {
+                RoomStatus expected = AVAILABLE;
+                for (const auto& reservation : *view->reservations) {
+                    if (reservation.getRoomNumber() != roomNumber) continue;
+                    if (reservation.getStatus() == CHECKED_IN) expected = OCCUPIED;
+                    else if (reservation.getStatus() == CONFIRMED && expected == AVAILABLE) expected = RESERVED;
+                }
+                RoomStatus status = db.getRoom(roomNumber)->getStatus();
+                assert(status == expected || status == MAINTENANCE);
+            }
+        }
+        assert(db.planRoomAssignments(320).orphanNightsBefore == plan.orphanNightsAfter);
+        cout << "✓ Planned moves are applied and the gap is gone\n";
+
+        // A stale plan does nothing
+        assert(db.applyRoomAssignments(plan) == 0);
+        cout << "✓ Re-applying an old plan is a no-op\n";
+
+        assert(db.setRoomPinned(second, true));
+        assert(!db.setRoomPinned(-5, true));
+        assert(!findMove(db.planRoomAssignments(320), second));
+    }
+    {
+        Database db;
+        assert(db.findReservation(second)->isRoomPinned());
+        assert(!db.findReservation(first)->isRoomPinned());
+    }
+    cout << "✓ Pinned stays stay put and the pin survives a reload\n";
+
+    bool caught = false;
+    try {
+        Database db;
+        db.planRoomAssignments(0);
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Empty horizon rejected\n";
+
+    cout << "Database Assignment Tests: PASSED\n\n";
+}
+
+void benchmarkAssignment() {
+    cout << "Benchmarking Room Assignment...\n";
+
+    const int ROOMS = 1000;
+    const int DAYS = 90;
+    const int d0 = Calendar::daysFromCivil(2025, 1, 1);
+    vector<Room> rooms;
+    vector<Reservation> reservations;
+    randomHotel(ROOMS, DAYS, 42, rooms, reservations, d0);
+
+    auto start = chrono::high_resolution_clock::now();
+    AssignmentPlan plan = RoomAssigner::plan(rooms, reservations, d0, d0 + DAYS - 1);
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    assert(plan.orphanNightsAfter <= plan.orphanNightsBefore);
+    cout << "✓ " << ROOMS << " rooms, " << DAYS << " days, " << plan.movable << " movable stays\n";
+    cout << "  Orphan nights: " << plan.orphanNightsBefore << " -> " << plan.orphanNightsAfter
+         << " with " << plan.moves.size() << " moves\n";
+    cout << "  Planning time: " << elapsed.count() << " ms\n";
+    cout << "Room Assignment Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     ROOM ASSIGNMENT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testSmallHotel();
+        testRandomHotels();
+        testDatabaseAssignments();
+        benchmarkAssignment();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
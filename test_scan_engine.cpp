@@ -0,0 +1,211 @@
+#include "ScanEngine.h"
+#include "Reservation.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+using namespace std;
+
+// Synthetic fact row for the benchmark; the shape of a reservation scan
+struct StayRow {
+    int roomNumber;
+    int nights;
+    double amount;
+    bool paid;
+};
+
+struct StayTotals {
+    long long nights = 0;
+    double paidAmount = 0.0;
+    double dueAmount = 0.0;
+    int unpaidRows = 0;
+};
+
+static vector<StayRow> makeRows(size_t count) {
+    vector<StayRow> rows(count);
+    unsigned seed = 2024;
+    for (auto& row : rows) {
+        seed = seed * 1103515245u + 12345u;
+        row.roomNumber = 101 + static_cast<int>((seed >> 8) % 1000);
+        row.nights = 1 + static_cast<int>((seed >> 4) % 14);
+        row.amount = row.nights * (80.0 + (seed >> 20) % 400);
+        row.paid = (seed >> 16) % 4 != 0;
+    }
+    return rows;
+}
+
+auto accumulateStay = [](StayTotals& totals, const StayRow& row) {
+    totals.nights += row.nights;
+    if (row.paid) {
+        totals.paidAmount += row.amount;
+    } else {
+        totals.dueAmount += row.amount;
+        totals.unpaidRows++;
+    }
+};
+
+auto mergeStays = [](StayTotals& totals, const StayTotals& partial) {
+    totals.nights += partial.nights;
+    totals.paidAmount += partial.paidAmount;
+    totals.dueAmount += partial.dueAmount;
+    totals.unpaidRows += partial.unpaidRows;
+};
+
+void testThreadPool() {
+    cout << "Testing Thread Pool...\n";
+
+    ThreadPool pool(4);
+    assert(pool.size() == 4);
+
+    vector<future<int>> results;
+    for (int i = 0; i < 20; i++) {
+        results.push_back(pool.submit([i]() { return i * i; }));
+    }
+    for (int i = 0; i < 20; i++) {
+        assert(results[i].get() == i * i);
+    }
+    cout << "✓ Submitted tasks return their results\n";
+
+    const size_t COUNT = 100003;
+    vector<atomic<int>> hits(COUNT);
+    pool.parallelFor(COUNT, 1000, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) hits[i]++;
+    });
+    for (size_t i = 0; i < COUNT; i++) {
+        assert(hits[i] == 1);
+    }
+    cout << "✓ parallelFor visits every index exactly once\n";
+
+    bool caught = false;
+    try {
+        pool.parallelFor(1000, 10, [](size_t begin, size_t) {
+            if (begin == 500) throw ValidationException("bad partition");
+        });
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Exceptions propagate to the caller\n";
+
+    // Every worker blocks in an inner loop; the callers must finish the
+    // inner chunks themselves
+    atomic<int> inner(0);
+    pool.parallelFor(8, 1, [&](size_t, size_t) {
+        pool.parallelFor(100, 10, [&](size_t begin, size_t end) {
+            inner += static_cast<int>(end - begin);
+        });
+    });
+    assert(inner == 800);
+    cout << "✓ Nested parallel loops complete\n";
+
+    // A single worker runs the loop itself, still one chunk at a time
+    ThreadPool single(1);
+    vector<pair<size_t, size_t>> chunks;
+    single.parallelFor(25, 10, [&](size_t begin, size_t end) { chunks.emplace_back(begin, end); });
+    assert(chunks.size() == 3 && chunks[1].first == 10 && chunks[1].second == 20 && chunks[2].second == 25);
+    cout << "✓ Single-worker pool keeps the chunks\n";
+
+    cout << "Thread Pool Tests: PASSED\n\n";
+}
+
+void testScanEngine() {
+    cout << "Testing Scan Engine...\n";
+
+    ThreadPool pool(4);
+    vector<StayRow> rows = makeRows(200000);
+
+    StayTotals serial;
+    for (const auto& row : rows) accumulateStay(serial, row);
+
+    StayTotals parallel = ScanEngine::aggregate(rows, StayTotals(), accumulateStay, mergeStays, pool);
+    assert(parallel.nights == serial.nights);
+    assert(parallel.unpaidRows == serial.unpaidRows);
+    assert(abs(parallel.paidAmount - serial.paidAmount) < 1e-6 * serial.paidAmount);
+    assert(abs(parallel.dueAmount - serial.dueAmount) < 1e-6 * serial.dueAmount);
+    cout << "✓ Partitioned aggregate matches a serial loop\n";
+
+    vector<StayRow*> unpaid = ScanEngine::filter(rows, [](const StayRow& row) { return !row.paid; }, pool);
+    assert(static_cast<int>(unpaid.size()) == serial.unpaidRows);
+    for (size_t i = 1; i < unpaid.size(); i++) {
+        assert(unpaid[i - 1] < unpaid[i]);
+    }
+    const vector<StayRow>& constRows = rows;
+    vector<const StayRow*> longStays =
+        ScanEngine::filter(constRows, [](const StayRow& row) { return row.nights > 10; }, pool);
+    for (const auto* row : longStays) assert(row->nights > 10);
+    cout << "✓ Filter keeps table order\n";
+
+    vector<StayRow> empty;
+    assert(ScanEngine::aggregate(empty, StayTotals(), accumulateStay, mergeStays, pool).nights == 0);
+    assert(ScanEngine::filter(empty, [](const StayRow&) { return true; }, pool).empty());
+    cout << "✓ Empty tables scan to the identity\n";
+
+    const int base = Calendar::daysFromCivil(2025, 3, 1);
+    vector<Reservation> reservations;
+    for (int i = 0; i < 50; i++) {
+        reservations.emplace_back(10001 + i, 1001, 101 + i % 5, Calendar::fromEpochDay(base + i),
+                                  Calendar::fromEpochDay(base + i + 2), 2, 100.0);
+    }
+    time_t from = Calendar::fromEpochDay(base + 10), to = Calendar::fromEpochDay(base + 20);
+    vector<Reservation*> inRange = ScanEngine::filter(reservations, [from, to](const Reservation& r) {
+        return r.getRawCheckIn() >= from && r.getRawCheckOut() <= to;
+    }, pool);
+    assert(inRange.size() == 9);
+    assert(inRange.front()->getReservationId() == 10011);
+    cout << "✓ Reservation date-range filter passed\n";
+
+    cout << "Scan Engine Tests: PASSED\n\n";
+}
+
+void benchmarkScaling() {
+    cout << "Benchmarking Partitioned Scans...\n";
+
+    const size_t ROWS = 4000000;
+    vector<StayRow> rows = makeRows(ROWS);
+
+    auto start = chrono::high_resolution_clock::now();
+    StayTotals serial;
+    for (const auto& row : rows) accumulateStay(serial, row);
+    auto serialTime = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+    cout << "  " << ROWS << " rows, hardware threads: " << thread::hardware_concurrency() << "\n";
+    cout << "  serial loop: " << serialTime.count() << " us\n";
+
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        ThreadPool pool(threads);
+        start = chrono::high_resolution_clock::now();
+        StayTotals totals = ScanEngine::aggregate(rows, StayTotals(), accumulateStay, mergeStays, pool);
+        auto elapsed = chrono::duration_cast<chrono::microseconds>(
+            chrono::high_resolution_clock::now() - start);
+        assert(totals.nights == serial.nights && totals.unpaidRows == serial.unpaidRows);
+        assert(abs(totals.paidAmount + totals.dueAmount - serial.paidAmount - serial.dueAmount) <
+               1e-6 * (serial.paidAmount + serial.dueAmount));
+        cout << "  " << threads << " thread(s): " << elapsed.count() << " us\n";
+    }
+
+    cout << "Scan Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     SCAN ENGINE TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testThreadPool();
+        testScanEngine();
+        benchmarkScaling();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
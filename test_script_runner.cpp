@@ -0,0 +1,159 @@
+#include "ScriptRunner.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <sstream>
+#include <fstream>
+#include <filesystem>
+
+using namespace std;
+
+static string day(int epochDay) {
+    return Utils::formatDate(Calendar::fromEpochDay(epochDay));
+}
+
+static int savedCount(const string& path) {
+    ifstream file(path);
+    int count = 0;
+    file >> count;
+    return count;
+}
+
+static int savedRoomCount() {
+    return savedCount("data/rooms.dat");
+}
+
+// One full stay in a room: book, check in, charge, pay, check out
+static string stay(int room, int today) {
+    return "BOOK 1001 " + to_string(room) + " " + day(today) + " " + day(today + 1) + " 2\n"
+           "CHECKIN $\n"
+           "CHARGE $ 18.50 Minibar\n"
+           "PAY $ Card\n"
+           "CHECKOUT $\n";
+}
+
+void testScriptRunner() {
+    cout << "Testing Script Runner...\n";
+
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    istringstream script(
+        "# New suite, straight into maintenance\n"
+        "ADDROOM 3 320 2\n"
+        "STATUS $ 4\n"
+        "\n"
+        "NOPE\n"
+        "CHECKIN 1\n");
+    ostringstream replies;
+    ScriptRunner runner(db);
+    ScriptReport report = runner.run(script, replies);
+
+    assert(report.commands == 4 && report.errors == 2 && report.batches == 1);
+    int room = stoi(replies.str().substr(3));
+    assert(db.getRoom(room)->getStatus() == MAINTENANCE);
+    assert(replies.str().find("line 5: ERR") != string::npos);
+    assert(replies.str().find("line 6: ERR") != string::npos);
+    cout << "✓ Comments skipped, $ substituted, errors reported by line\n";
+
+    istringstream stays("STATUS " + to_string(room) + " 1\nPRICE " + to_string(room) + " 299.5\n" + stay(room, today));
+    report = runner.run(stays, replies);
+    assert(report.errors == 0 && report.commands == 7);
+    assert(db.getRoom(room)->getPricePerNight() == 299.5);
+    assert(db.getRoom(room)->getStatus() == AVAILABLE);
+    assert(report.timings.size() == 7 && report.timings[2].command == "BOOK");
+    cout << "✓ Room fixes and a full stay run from a script\n";
+
+    // Nothing reaches the files until the batch commits
+    int saved = savedRoomCount();
+    db.beginBatch();
+    db.beginBatch();
+    db.addRoom(STANDARD, 99.0, 1);
+    assert(db.commitBatch() == 0);
+    assert(savedRoomCount() == saved);
+    assert(db.commitBatch() >= 1);
+    assert(savedRoomCount() == saved + 1);
+    bool caught = false;
+    try {
+        db.commitBatch();
+    } catch (const SystemException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Batches defer saves and nest\n";
+
+    // A commit that fails part way keeps the files it did not write marked;
+    // a directory in the customers file's place makes its save throw
+    filesystem::rename("data/customers.dat", "data/customers.dat.keep");
+    filesystem::create_directory("data/customers.dat");
+    db.beginBatch();
+    db.addRoom(STANDARD, 98.0, 1);
+    db.addCustomer("Batch Guest", "batch.guest" + to_string(saved) + "@example.com", "+1-555-0199",
+                   "1 Batch Lane", "ID-" + to_string(saved));
+    caught = false;
+    try {
+        db.commitBatch();
+    } catch (const FileException&) {
+        caught = true;
+    }
+    assert(caught && savedRoomCount() == saved + 2);
+    filesystem::remove("data/customers.dat");
+    filesystem::rename("data/customers.dat.keep", "data/customers.dat");
+    db.beginBatch();
+    assert(db.commitBatch() == 1);
+    assert(savedCount("data/customers.dat") == db.getCustomerCount());
+    cout << "✓ Failed commit leaves unwritten files for the next one\n";
+
+    cout << "Script Runner Tests: PASSED\n\n";
+}
+
+void benchmarkScriptRunner() {
+    cout << "Benchmarking Script Runner...\n";
+
+    const int STAYS = 100;
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    int room = db.addRoom(DELUXE, 150.0, 2);
+    string script;
+    for (int i = 0; i < STAYS; i++) script += stay(room, today);
+
+    auto run = [&](int batchSize) {
+        istringstream in(script);
+        ostringstream replies;
+        ScriptRunner runner(db, batchSize);
+        ScriptReport report = runner.run(in, replies);
+        assert(report.errors == 0);
+        return report;
+    };
+
+    ScriptReport single = run(1);
+    ScriptReport batched = run(ScriptRunner::DEFAULT_BATCH_SIZE);
+    assert(batched.batches == 1);
+    cout << "✓ " << STAYS << " stays, " << single.commands << " commands, over "
+         << db.getReservationCount() << " reservations\n";
+    cout << "  Commit per command: " << static_cast<long long>(single.seconds * 1000) << " ms, "
+         << single.filesWritten << " files written\n";
+    cout << "  One batch:          " << static_cast<long long>(batched.seconds * 1000) << " ms, "
+         << batched.filesWritten << " files written\n";
+    cout << "Script Runner Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     SCRIPT RUNNER TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testScriptRunner();
+        benchmarkScriptRunner();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
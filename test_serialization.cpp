@@ -0,0 +1,378 @@
+#include "Room.h"
+#include "Customer.h"
+#include "Reservation.h"
+#include "Employee.h"
+#include "Bill.h"
+#include "Serialization.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+
+using namespace std;
+
+void testTextRoundTrip() {
+    cout << "Testing Text Round Trip...\n";
+
+    Room room(205, DELUXE, 180.0, 3, {"WiFi", "Sea View, Balcony", "Mini|Bar"});
+    room.setStatus(OCCUPIED);
+    stringstream roomStream;
+    Serialization::writeText(roomStream, room);
+    Room loadedRoom;
+    assert(Serialization::readText(roomStream, loadedRoom));
+    assert(loadedRoom.getRoomNumber() == 205);
+    assert(loadedRoom.getStatus() == OCCUPIED);
+    assert(loadedRoom.getFeatures().size() == 3);
+    assert(loadedRoom.getFeatures()[1] == "Sea View, Balcony");
+    assert(loadedRoom.getFeatures()[2] == "Mini|Bar");
+    cout << "✓ Room with escaped features passed\n";
+
+    Customer customer(1001, "Ann O'Neil", "ann@example.com", "555-123-4567",
+                      "12 Main St | Apt 4", "PASSPORT-77");
+    customer.addVisit(420.5);
+    stringstream customerStream;
+    Serialization::writeText(customerStream, customer);
+    Customer loadedCustomer;
+    assert(Serialization::readText(customerStream, loadedCustomer));
+    assert(loadedCustomer.getName() == "Ann O'Neil");
+    assert(loadedCustomer.getAddress() == "12 Main St | Apt 4");
+    assert(loadedCustomer.getTotalSpent() == 420.5);
+    assert(loadedCustomer.getRegistrationDate() == customer.getRegistrationDate());
+    cout << "✓ Customer passed\n";
+
+    Reservation reservation(10001, 1001, 205, Utils::parseDate("2025-03-10"),
+                            Utils::parseDate("2025-03-14"), 2, 180.0);
+    reservation.setSpecialRequests("Late arrival\nExtra pillows");
+    stringstream reservationStream;
+    Serialization::writeText(reservationStream, reservation);
+    Reservation loadedReservation;
+    assert(Serialization::readText(reservationStream, loadedReservation));
+    assert(loadedReservation.getCheckInDate() == "2025-03-10");
+    assert(loadedReservation.getCheckOutDate() == "2025-03-14");
+    assert(loadedReservation.getTotalAmount() == reservation.getTotalAmount());
+    assert(loadedReservation.getSpecialRequests() == "Late arrival\nExtra pillows");
+    cout << "✓ Reservation with multi-line request passed\n";
+
+    Employee employee(1, "Sam Lee", "Manager", MANAGEMENT, MORNING, 5000.0,
+                      "555-987-6543", "1 Hotel Way", "2024-01-15");
+    employee.setPassword("secret123", "secret123");
+    stringstream employeeStream;
+    Serialization::writeText(employeeStream, employee);
+    Employee loadedEmployee;
+    assert(Serialization::readText(employeeStream, loadedEmployee));
+    assert(loadedEmployee.getDepartment() == MANAGEMENT);
+    assert(loadedEmployee.authenticate("secret123"));
+    cout << "✓ Employee passed\n";
+
+    Serialization::TextReader reader;
+    stringstream bad("abc|1|0|100|2|\n");
+    try {
+        Room badRoom;
+        Serialization::readText(bad, badRoom, reader);
+        cout << "✗ Should have thrown exception for corrupted record\n";
+        assert(false);
+    } catch (const FileCorruptedException&) {
+        cout << "✓ Corrupted record exception caught\n";
+    }
+
+    cout << "Text Round Trip Tests: PASSED\n\n";
+}
+
+void testBillFileRoundTrip() {
+    cout << "Testing Bill File Round Trip...\n";
+
+    Bill bill(5001, 10001, 0.10, 0.1);
+    bill.addRoomCharge(100.0, 3);
+    bill.addFoodCharge("Coffee", 4.0, 2);
+    bill.addItem("Minibar | Champagne", 90.0);
+
+    {
+        ofstream outFile("test_bill.dat");
+        bill.saveToFile(outFile);
+        bill.saveToFile(outFile);
+    }
+
+    ifstream inFile("test_bill.dat");
+    for (int copy = 0; copy < 2; copy++) {
+        Bill loaded;
+        loaded.loadFromFile(inFile);
+        assert(loaded.getBillId() == 5001);
+        assert(loaded.getItems().size() == 3);
+        assert(loaded.getItems()[2].getDescription() == "Minibar | Champagne");
+        assert(loaded.calculateTotal() == bill.calculateTotal());
+    }
+    cout << "✓ Every item survives, including the last one\n";
+
+    cout << "Bill File Round Trip Tests: PASSED\n\n";
+}
+
+// Lines as the first release wrote them
+static const char* LEGACY_ROOMS =
+    "2\n"
+    "101 1 3 100 2 3 WiFi TV AC \n"
+    "103 2 3 200 2 5 WiFi Smart TV AC Mini-bar Jacuzzi \n";
+static const char* LEGACY_CUSTOMERS =
+    "1\n"
+    "1001 John Smith john.smith@email.com +1-555-0101 123 Main Street, New York PASSPORT-XYZ123 1792338037 2 450.5\n";
+static const char* LEGACY_RESERVATIONS =
+    "2\n"
+    "10001 1001 101 1792510837 1792770037 2 100 300 0 1 1 Early check-in requested 1792338037\n"
+    "10002 1001 103 1792597237 1792770037 2 200 400 0 3 2  1792338037\n";
+static const char* LEGACY_BILLS =
+    "2\n"
+    "5001 10001 0.1 0 1 Credit Card 1792338037 2\n"
+    "Room Charge|100|3\n"
+    "Laundry Service|25|1\n"
+    "5002 10002 0.1 0.05 0  0 1\n"
+    "Room Service|25.5|2\n";
+
+static void writeFile(const string& path, const string& text) {
+    ofstream file(path, ios::binary);
+    file << text;
+}
+
+static string readFile(const string& path) {
+    ifstream file(path, ios::binary);
+    stringstream text;
+    text << file.rdbuf();
+    return text.str();
+}
+
+// Sets the process time zone; nullptr goes back to the system's
+static void setTimeZone(const char* zone) {
+#ifdef _WIN32
+    _putenv_s("TZ", zone ? zone : "");
+    _tzset();
+#else
+    if (zone) {
+        setenv("TZ", zone, 1);
+    } else {
+        unsetenv("TZ");
+    }
+    tzset();
+#endif
+}
+
+// Moves into an empty directory of its own for as long as it lives, so a
+// Database opened there reads and writes its own data/ and never the files
+// of the directory the tests were started from
+class ScratchDirectory {
+private:
+    filesystem::path previous;
+    filesystem::path scratch;
+
+public:
+    explicit ScratchDirectory(const string& name)
+        : previous(filesystem::current_path()), scratch(filesystem::temp_directory_path() / name) {
+        filesystem::remove_all(scratch);
+        filesystem::create_directories(scratch / "data");
+        filesystem::current_path(scratch);
+    }
+    ~ScratchDirectory() {
+        filesystem::current_path(previous);
+        filesystem::remove_all(scratch);
+    }
+};
+
+void testLegacyFiles() {
+    cout << "Testing Legacy File Migration...\n";
+
+    // Each entity reads the old space-separated layout
+    writeFile("test_legacy.dat", string(LEGACY_CUSTOMERS).substr(2));
+    {
+        ifstream file("test_legacy.dat");
+        Customer customer;
+        customer.loadLegacyFromFile(file);
+        assert(customer.getCustomerId() == 1001 && customer.getName() == "John Smith");
+        assert(customer.getEmail() == "john.smith@email.com" && customer.getPhone() == "+1-555-0101");
+        assert(customer.getAddress() == "123 Main Street, New York" && customer.getIdProof() == "PASSPORT-XYZ123");
+        assert(customer.getTotalVisits() == 2 && customer.getTotalSpent() == 450.5);
+    }
+    writeFile("test_legacy.dat", string(LEGACY_BILLS).substr(2));
+    {
+        ifstream file("test_legacy.dat");
+        Bill paid, open;
+        paid.loadLegacyFromFile(file);
+        open.loadLegacyFromFile(file);
+        assert(paid.getIsPaid() && paid.getPaymentMethod() == "Credit Card" && paid.getItems().size() == 2);
+        assert(!open.getIsPaid() && open.getPaymentMethod().empty() && open.getDiscount() == 0.05);
+        assert(open.getItems()[0].getDescription() == "Room Service" && open.getItems()[0].getQuantity() == 2);
+    }
+    remove("test_legacy.dat");
+    cout << "✓ Old layouts read, text with spaces recovered around the fixed fields\n";
+
+    // Stay dates were local midnight; east of UTC that is still the day before
+    // in UTC, so each one is moved to its local day
+    const char* zone = getenv("TZ");
+    string previousZone = zone ? zone : "";
+    setTimeZone("JST-9");
+    {
+        tm local = {};
+        local.tm_year = 2026 - 1900;
+        local.tm_mon = 9;
+        local.tm_mday = 20;
+        local.tm_isdst = -1;
+        time_t midnight = mktime(&local);
+        assert(Calendar::toEpochDay(midnight) == Calendar::daysFromCivil(2026, 10, 19));
+        writeFile("test_legacy.dat", "10003 1001 101 " + to_string(midnight) + " " + to_string(midnight + 3 * 86400) +
+                                     " 2 100 300 0 1 1 Late arrival " + to_string(midnight) + "\n");
+        ifstream file("test_legacy.dat");
+        Reservation reservation;
+        reservation.loadLegacyFromFile(file);
+        assert(reservation.getCheckInDate() == "2026-10-20" && reservation.getCheckOutDate() == "2026-10-23");
+        assert(reservation.calculateNights() == 3);
+    }
+    setTimeZone(previousZone.empty() ? nullptr : previousZone.c_str());
+    remove("test_legacy.dat");
+    cout << "✓ Local-midnight stay dates moved to their day east of UTC\n";
+
+    // A data directory from the first release loads and is rewritten once
+    ScratchDirectory scratch("hotel_test_legacy");
+    const vector<string> files = {"data/rooms.dat", "data/customers.dat", "data/reservations.dat",
+                                  "data/bills.dat"};
+    writeFile(files[0], LEGACY_ROOMS);
+    writeFile(files[1], LEGACY_CUSTOMERS);
+    writeFile(files[2], LEGACY_RESERVATIONS);
+    writeFile(files[3], LEGACY_BILLS);
+    {
+        Database db;
+        assert(db.getRoomCount() == 2 && db.getCustomerCount() == 1);
+        assert(db.getReservationCount() == 2 && db.getBillCount() == 2);
+        assert(db.getReservation(10001)->getSpecialRequests() == "Early check-in requested");
+        assert(db.getReservation(10002)->getSpecialRequests().empty());
+        assert(db.findRoom(103)->getPricePerNight() == 200.0);
+    }
+    assert(readFile(files[0]).find("101|1|3|100|2|WiFi,TV,AC") != string::npos);
+    cout << "✓ Legacy data directory loaded and rewritten in the current format\n";
+
+    // A file neither format reads is kept, and never overwritten
+    writeFile(files[0], "2\nnot a room\n");
+    {
+        Database db;
+        assert(db.getRoomCount() == 0 && db.getCustomerCount() == 1);
+        db.saveAllData();
+    }
+    assert(readFile(files[0]) == "2\nnot a room\n");
+    cout << "✓ Unreadable file left untouched\n";
+
+    cout << "Legacy File Migration Tests: PASSED\n\n";
+}
+
+void testBinaryAndCsv() {
+    cout << "Testing Binary and CSV Codecs...\n";
+
+    Room room(301, SUITE, 350.0, 4, {"Jacuzzi", "Kitchen"});
+    string bytes;
+    Serialization::appendBinary(bytes, room);
+    stringstream binaryStream(bytes);
+    Room loadedRoom;
+    assert(Serialization::readBinary(binaryStream, loadedRoom));
+    assert(loadedRoom.getType() == SUITE);
+    assert(loadedRoom.getFeatures()[1] == "Kitchen");
+    cout << "✓ Binary room passed\n";
+
+    string csv;
+    Serialization::appendCsvHeader<Employee>(csv);
+    assert(csv.find("password") == string::npos);
+    assert(csv.rfind("employeeId,name,", 0) == 0);
+
+    csv.clear();
+    Reservation reservation(10002, 1001, 301, Utils::parseDate("2025-12-30"),
+                            Utils::parseDate("2026-01-02"), 2, 350.0);
+    reservation.setSpecialRequests("Cot, \"quiet\" room");
+    Serialization::appendCsv(csv, reservation);
+    assert(csv.find(",2025-12-30,2026-01-02,") != string::npos);
+    assert(csv.find("\"Cot, \"\"quiet\"\" room\"") != string::npos);
+    cout << "✓ CSV header and quoting passed\n";
+
+    cout << "Binary and CSV Codec Tests: PASSED\n\n";
+}
+
+// Previous on-disk layout for reservations, kept as the benchmark baseline
+static void legacySave(ostream& file, const Reservation& r) {
+    file << r.getReservationId() << " " << r.getCustomerId() << " " << r.getRoomNumber() << " "
+         << r.getRawCheckIn() << " " << r.getRawCheckOut() << " " << r.getNumberOfGuests() << " "
+         << r.getRoomRate() << " " << r.getTotalAmount() << " " << r.getPaidAmount() << " "
+         << static_cast<int>(r.getStatus()) << " " << static_cast<int>(r.getPaymentStatus()) << " "
+         << r.getSpecialRequests() << " " << r.getRawCheckIn() << "\n";
+}
+
+static double legacyLoad(istream& file) {
+    int id, customerId, roomNumber, guests, status, paymentStatus;
+    time_t checkIn, checkOut, booked;
+    double rate, total, paid;
+    string requests;
+    file >> id >> customerId >> roomNumber >> checkIn >> checkOut >> guests
+         >> rate >> total >> paid >> status >> paymentStatus >> requests >> booked;
+    return total;
+}
+
+void benchmarkTextCodec() {
+    cout << "Benchmarking Text Codec...\n";
+
+    const int RECORDS = 100000;
+    Reservation reservation(10001, 1001, 205, Utils::parseDate("2025-03-10"),
+                            Utils::parseDate("2025-03-14"), 2, 180.0);
+    reservation.setSpecialRequests("Quiet");
+    double checksum = 0;
+
+    auto start = chrono::high_resolution_clock::now();
+    stringstream legacyStream;
+    for (int i = 0; i < RECORDS; i++) legacySave(legacyStream, reservation);
+    for (int i = 0; i < RECORDS; i++) checksum += legacyLoad(legacyStream);
+    auto legacy = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    string buffer;
+    for (int i = 0; i < RECORDS; i++) Serialization::appendText(buffer, reservation);
+    stringstream schemaStream(buffer);
+    Serialization::TextReader reader;
+    Reservation loaded;
+    for (int i = 0; i < RECORDS; i++) {
+        Serialization::readText(schemaStream, loaded, reader);
+        checksum += loaded.getTotalAmount();
+    }
+    auto schema = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    cout << "✓ " << RECORDS << " reservations saved and loaded\n";
+    cout << "  operator<< / operator>>: " << legacy.count() << " us\n";
+    cout << "  Schema text codec:      " << schema.count() << " us\n";
+    cout << "  (checksum " << checksum << ")\n";
+
+    cout << "Text Codec Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     SERIALIZATION UNIT TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testTextRoundTrip();
+        testBillFileRoundTrip();
+        testLegacyFiles();
+        testBinaryAndCsv();
+        benchmarkTextCodec();
+
+        // Clean up test file
+        remove("test_bill.dat");
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
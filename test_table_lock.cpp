@@ -0,0 +1,198 @@
+#include "TableLock.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <memory>
+
+using namespace std;
+
+static const unsigned FIRST = 1u << 0;
+static const unsigned SECOND = 1u << 1;
+static const unsigned THIRD = 1u << 2;
+
+void testTableLock() {
+    cout << "Testing Table Locks...\n";
+
+    TableLocks locks;
+    {
+        TableLock outer(locks, FIRST, SECOND);
+        TableLock reread(locks, FIRST | SECOND);
+        TableLock deeper(locks, 0, SECOND | THIRD);
+    }
+    cout << "✓ Nested guards pass through tables already held\n";
+
+    bool caught = false;
+    try {
+        TableLock outer(locks, SECOND);
+        TableLock widen(locks, 0, SECOND);
+    } catch (const SystemException&) {
+        caught = true;
+    }
+    assert(caught);
+    caught = false;
+    try {
+        TableLock outer(locks, SECOND);
+        TableLock lower(locks, FIRST);
+    } catch (const SystemException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Upgrades and out-of-order nesting throw instead of deadlocking\n";
+
+    // Readers share a table; a writer waits for them
+    atomic<bool> readerIn(false), writerIn(false);
+    {
+        auto reading = make_unique<TableLock>(locks, FIRST);
+        thread reader([&]() {
+            TableLock alsoReading(locks, FIRST);
+            readerIn = true;
+        });
+        reader.join();
+        assert(readerIn);
+
+        thread writer([&]() {
+            TableLock writing(locks, 0, FIRST);
+            writerIn = true;
+        });
+        this_thread::sleep_for(chrono::milliseconds(50));
+        assert(!writerIn);
+        {
+            // Other tables stay free meanwhile
+            thread other([&]() { TableLock elsewhere(locks, 0, THIRD); });
+            other.join();
+        }
+        reading.reset();
+        writer.join();
+        assert(writerIn);
+    }
+    cout << "✓ Readers share, writers exclude, other tables unaffected\n";
+
+    cout << "Table Lock Tests: PASSED\n\n";
+}
+
+void testConcurrentDatabase() {
+    cout << "Testing Concurrent Database...\n";
+
+    const int WRITERS = 4;
+    const int ROOMS_EACH = 3;
+    const int STAYS_EACH = 6;
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    vector<vector<int>> owned(WRITERS);
+    for (auto& rooms : owned) {
+        for (int i = 0; i < ROOMS_EACH; i++) rooms.push_back(db.addRoom(DELUXE, 180.0, 2));
+    }
+
+    atomic<int> writersLeft(WRITERS);
+    atomic<long long> reads(0);
+    atomic<bool> broken(false);
+    vector<thread> threads;
+    for (int w = 0; w < WRITERS; w++) {
+        threads.emplace_back([&, w]() {
+            for (int stay = 0; stay < STAYS_EACH; stay++) {
+                int room = owned[w][stay % ROOMS_EACH];
+                int id = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                            Calendar::fromEpochDay(today + 2), 2);
+                if (!db.checkIn(id)) broken = true;
+                int bill = db.createBill(id);
+                db.addBillItem(bill, "Room Service", 30.0);
+                db.processPayment(bill, "Card");
+                if (!db.checkOut(id)) broken = true;
+            }
+            writersLeft--;
+        });
+    }
+    for (int r = 0; r < 4; r++) {
+        threads.emplace_back([&, r]() {
+            while (writersLeft > 0) {
+                DashboardStats stats = db.getDashboardStats();
+                if (stats.availableRooms + stats.occupiedRooms + stats.reservedRooms +
+                    stats.maintenanceRooms != stats.totalRooms) broken = true;
+                optional<Room> room = db.getRoom(owned[r][0]);
+                if (!room || room->getType() != DELUXE) broken = true;
+                db.findActiveReservations();
+                db.findCheapestRooms(Calendar::fromEpochDay(today + 1), Calendar::fromEpochDay(today + 3), 2, 5);
+                db.getOccupancyReport(Calendar::fromEpochDay(today - 7), Calendar::fromEpochDay(today));
+                reads++;
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    assert(!broken);
+
+    for (const auto& rooms : owned) {
+        for (int room : rooms) assert(db.getRoom(room)->getStatus() == AVAILABLE);
+    }
+    DashboardStats stats = db.getDashboardStats();
+    int active = 0;
+    for (const auto& reservation : db.findActiveReservations()) {
+        int checkIn = Utils::toEpochDay(reservation.getRawCheckIn());
+        if (checkIn <= today && today < Utils::toEpochDay(reservation.getRawCheckOut())) active++;
+    }
+    assert(stats.activeReservations == active);
+    cout << "✓ " << WRITERS * STAYS_EACH << " full stays booked alongside " << reads << " report reads\n";
+    cout << "✓ Counters agree with a recount afterwards\n";
+
+    cout << "Concurrent Database Tests: PASSED\n\n";
+}
+
+void benchmarkReaders() {
+    cout << "Benchmarking Concurrent Readers...\n";
+
+    const int THREADS = 4;
+    const int READS = 300;
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    mutex global;
+
+    auto run = [&](bool serialize) {
+        auto start = chrono::high_resolution_clock::now();
+        vector<thread> readers;
+        for (int t = 0; t < THREADS; t++) {
+            readers.emplace_back([&]() {
+                for (int i = 0; i < READS; i++) {
+                    unique_lock<mutex> lock(global, defer_lock);
+                    if (serialize) lock.lock();
+                    db.getOccupancyReport(Calendar::fromEpochDay(today - 30), Calendar::fromEpochDay(today));
+                    db.findCheapestRooms(Calendar::fromEpochDay(today + 5), Calendar::fromEpochDay(today + 8), 2, 10);
+                }
+            });
+        }
+        for (auto& reader : readers) reader.join();
+        return chrono::duration_cast<chrono::milliseconds>(chrono::high_resolution_clock::now() - start).count();
+    };
+
+    long long oneAtATime = run(true);
+    long long shared = run(false);
+    cout << "✓ " << THREADS << " threads x " << READS << " report reads over " << db.getRoomCount() << " rooms\n";
+    cout << "  Hardware threads:   " << thread::hardware_concurrency() << "\n";
+    cout << "  One global mutex:   " << oneAtATime << " ms\n";
+    cout << "  Shared table locks: " << shared << " ms\n";
+    cout << "Concurrent Readers Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     TABLE LOCK TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testTableLock();
+        testConcurrentDatabase();
+        benchmarkReaders();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,229 @@
+#include "Scheduler.h"
+#include "Database.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+
+static void runAll(vector<function<void()>>& due) {
+    for (auto& task : due) task();
+    due.clear();
+}
+
+void testTimerWheel() {
+    cout << "Testing Timer Wheel...\n";
+
+    // Deadlines on every level fire on their own tick
+    TimerWheel wheel;
+    vector<unsigned long long> delays = {1, 5, 255, 256, 300, 65535, 65536, 70000, 16777216 + 3};
+    vector<unsigned long long> fired;
+    for (auto delay : delays) {
+        wheel.schedule(delay, [&fired, &wheel]() { fired.push_back(wheel.getTick()); });
+    }
+    assert(wheel.size() == delays.size());
+    vector<function<void()>> due;
+    while (wheel.size() > 0) {
+        wheel.advance(1, due);
+        runAll(due);
+    }
+    assert(fired == delays);
+    cout << "✓ Timers on all four levels fire on their exact tick\n";
+
+    // One large step fires everything it passes, earliest first
+    TimerWheel jump;
+    fired.clear();
+    for (unsigned long long delay : {70000ULL, 10ULL, 600ULL}) {
+        jump.schedule(delay, [&fired, delay]() { fired.push_back(delay); });
+    }
+    jump.advance(100000, due);
+    runAll(due);
+    assert((fired == vector<unsigned long long>{10, 600, 70000}));
+    cout << "✓ A long advance catches up in deadline order\n";
+
+    // Cancelled and fired ids go stale; reused slots get new ids
+    TimerWheel ids;
+    int runs = 0;
+    TimerId first = ids.schedule(3, [&runs]() { runs++; });
+    TimerId second = ids.schedule(3, [&runs]() { runs += 10; });
+    assert(ids.cancel(first) && !ids.cancel(first));
+    TimerId reused = ids.schedule(2, [&runs]() { runs += 100; });
+    assert(reused != first && !ids.isPending(first) && ids.isPending(reused));
+    ids.advance(3, due);
+    runAll(due);
+    assert(runs == 110 && !ids.isPending(second) && ids.size() == 0);
+    cout << "✓ Cancel is exact and stale ids are refused\n";
+
+    // Periodic timers repeat until cancelled
+    TimerWheel periodic;
+    int beats = 0;
+    TimerId beat = periodic.schedule(300, [&beats]() { beats++; }, 300);
+    periodic.advance(3000, due);
+    runAll(due);
+    assert(beats == 10 && periodic.isPending(beat));
+    periodic.cancel(beat);
+    periodic.advance(3000, due);
+    assert(due.empty() && periodic.size() == 0);
+    cout << "✓ Periodic timers re-arm across levels\n";
+
+    bool caught = false;
+    try {
+        periodic.schedule(TimerWheel::MAX_DELAY + 1, []() {});
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    cout << "✓ Delays past the wheel's reach are refused\n";
+
+    // The scheduler thread runs tasks on real time
+    {
+        Scheduler scheduler(chrono::milliseconds(5));
+        atomic<int> once(0), repeated(0);
+        scheduler.after(chrono::milliseconds(20), [&once]() { once++; });
+        TimerId cancelled = scheduler.after(chrono::milliseconds(20), [&once]() { once += 10; });
+        scheduler.cancel(cancelled);
+        TimerId repeating = scheduler.every(chrono::milliseconds(10), [&repeated]() { repeated++; });
+        scheduler.after(chrono::milliseconds(10), []() { throw SystemException("Test", "task failed"); });
+        this_thread::sleep_for(chrono::milliseconds(200));
+        scheduler.cancel(repeating);
+        assert(once == 1);
+        assert(repeated >= 3);
+        assert(scheduler.pending() == 0);
+    }
+    cout << "✓ Scheduler runs one-shot and periodic tasks and survives failures\n";
+
+    // Arrivals left unconfirmed past their day become no-shows
+    int today = Utils::getTodayEpochDay();
+    Database db;
+    int room = db.addRoom(STANDARD, 110.0, 2);
+    int reservation = db.makeReservation(1001, room, Calendar::fromEpochDay(today),
+                                         Calendar::fromEpochDay(today + 2), 1);
+    db.changeReservationDates(reservation, Calendar::fromEpochDay(today - 2), Calendar::fromEpochDay(today));
+    int marked = db.markNoShows();
+    assert(marked >= 1);
+    assert(db.getReservation(reservation)->getStatus() == NO_SHOW);
+    assert(db.getRoom(room)->getStatus() == AVAILABLE);
+    assert(!db.cancelReservation(reservation));
+    assert(db.markNoShows() == 0);
+    cout << "✓ Missed arrivals marked no-show and their rooms freed\n";
+
+    // A room another booking still holds stays reserved, and the nights
+    // the guest never came for go to the waitlist
+    int held = db.addRoom(PRESIDENTIAL, 900.0, 2);
+    int missed = db.makeReservation(1001, held, Calendar::fromEpochDay(today),
+                                    Calendar::fromEpochDay(today + 3), 1);
+    db.changeReservationDates(missed, Calendar::fromEpochDay(today - 1), Calendar::fromEpochDay(today + 3));
+    db.updateRoomStatus(held, AVAILABLE);    // Room moves and waitlist fills leave a room booked twice too
+    db.makeReservation(1001, held, Calendar::fromEpochDay(today + 10), Calendar::fromEpochDay(today + 12), 1);
+    int waiting = db.joinWaitlist(1001, PRESIDENTIAL, 2, Calendar::fromEpochDay(today + 1),
+                                  Calendar::fromEpochDay(today + 3));
+    assert(db.markNoShows() == 1);
+    assert(db.getRoom(held)->getStatus() == RESERVED);
+    const WaitlistRequest* request = db.getWaitlist().find(waiting);
+    assert(request->status == WAITLIST_FILLED);
+    assert(db.getReservation(request->reservationId)->getRoomNumber() == held);
+    cout << "✓ Rooms still booked stay reserved; freed nights offered to the waitlist\n";
+
+    // Front-desk edits take the table locks while the scheduler sweeps
+    int edited = db.makeReservation(1001, room, Calendar::fromEpochDay(today + 5),
+                                    Calendar::fromEpochDay(today + 7), 1);
+    {
+        Scheduler scheduler(chrono::milliseconds(1));
+        TimerId sweep = scheduler.every(chrono::milliseconds(1), [&db]() { db.markNoShows(); });
+        for (int i = 0; i < 50; i++) {
+            assert(db.modifyReservation(edited, 1 + i % 2, "Late arrival " + to_string(i)));
+        }
+        scheduler.cancel(sweep);
+    }
+    optional<Reservation> after = db.getReservation(edited);
+    assert(after->getNumberOfGuests() == 2 && after->getSpecialRequests() == "Late arrival 49");
+    caught = false;
+    try {
+        db.modifyReservation(edited, 3, "");
+    } catch (const ValidationException&) {
+        caught = true;
+    }
+    assert(caught);
+    assert(!db.modifyReservation(-1, 1, ""));
+    cout << "✓ Guests and requests changed through the database, capacity checked\n";
+
+    // Copies read while the scheduler adds bookings, as the menu reads them
+    int booking = db.addRoom(STANDARD, 95.0, 2);
+    int bill = db.createBill(edited);
+    atomic<int> added(0);
+    {
+        Scheduler scheduler(chrono::milliseconds(1));
+        TimerId grow = scheduler.every(chrono::milliseconds(1), [&]() {
+            int night = today + 400 + 2 * added;
+            db.makeReservation(1001, booking, Calendar::fromEpochDay(night), Calendar::fromEpochDay(night + 1), 1);
+            db.updateRoomStatus(booking, AVAILABLE);
+            added++;
+        });
+        size_t seen = 0;
+        while (added < 20) {
+            vector<Reservation> history = db.getReservationsByCustomer(1001);
+            assert(history.size() >= seen);
+            seen = history.size();
+            assert(db.getBill(bill)->getReservationId() == edited);
+            assert(db.getCustomer(1001) && db.getEmployee(201));
+        }
+        scheduler.cancel(grow);
+    }
+    assert(!db.getBill(-1) && !db.getEmployee(-1));
+    cout << "✓ Value getters read safely while the scheduler books\n";
+
+    cout << "Timer Wheel Tests: PASSED\n\n";
+}
+
+void benchmarkTimerWheel() {
+    cout << "Benchmarking Timer Wheel...\n";
+
+    const int TIMERS = 100000;
+    const unsigned long long SPAN = 86400;      // One day of one-second ticks
+    TimerWheel wheel;
+    long long fired = 0;
+    auto start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < TIMERS; i++) {
+        unsigned long long delay = 1 + (static_cast<unsigned long long>(i) * 7919) % SPAN;
+        wheel.schedule(delay, [&fired]() { fired++; }, i % 10 == 0 ? delay : 0);
+    }
+    auto scheduled = chrono::high_resolution_clock::now();
+
+    vector<function<void()>> due;
+    for (unsigned long long t = 0; t < SPAN; t++) {
+        wheel.advance(1, due);
+        runAll(due);
+    }
+    auto ticked = chrono::high_resolution_clock::now();
+    assert(fired >= TIMERS);
+
+    double scheduleMicros = chrono::duration<double, micro>(scheduled - start).count();
+    double tickMicros = chrono::duration<double, micro>(ticked - scheduled).count();
+    cout << "✓ " << TIMERS << " timers over " << SPAN << " ticks, " << fired << " fired, "
+         << wheel.size() << " still pending\n";
+    cout << "  Schedule:       " << scheduleMicros * 1000 / TIMERS << " ns per timer\n";
+    cout << "  Tick and fire:  " << tickMicros * 1000 / SPAN << " ns per tick\n";
+    cout << "Timer Wheel Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     TIMER WHEEL TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testTimerWheel();
+        benchmarkTimerWheel();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
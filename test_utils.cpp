@@ -0,0 +1,165 @@
+#include "Utils.h"
+#include "Calendar.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+
+using namespace std;
+
+void testCivilConversions() {
+    cout << "Testing Civil Date Conversions...\n";
+
+    assert(Calendar::daysFromCivil(1970, 1, 1) == 0);
+    assert(Calendar::daysFromCivil(2024, 2, 29) == 19782);
+    assert(Calendar::daysFromCivil(1969, 12, 31) == -1);
+    cout << "✓ Known epoch days passed\n";
+
+    // Every day over four centuries must survive a round trip
+    int previous = Calendar::daysFromCivil(1900, 1, 1) - 1;
+    for (int year = 1900; year < 2300; year++) {
+        for (int month = 1; month <= 12; month++) {
+            for (int day = 1; day <= Calendar::daysInMonth(year, month); day++) {
+                int days = Calendar::daysFromCivil(year, month, day);
+                assert(days == previous + 1);
+                Calendar::CivilDate date = Calendar::civilFromDays(days);
+                assert(date.year == year && date.month == month && date.day == day);
+                previous = days;
+            }
+        }
+    }
+    cout << "✓ Round trip 1900-2299 passed\n";
+
+    assert(Calendar::weekday(Calendar::daysFromCivil(2024, 7, 4)) == 4);   // Thursday
+    assert(Calendar::weekday(Calendar::daysFromCivil(1969, 12, 28)) == 0); // Sunday
+    cout << "✓ Weekday calculation passed\n";
+
+    cout << "Civil Date Conversion Tests: PASSED\n\n";
+}
+
+void testParseAndFormat() {
+    cout << "Testing Date Parsing and Formatting...\n";
+
+    int day = 0;
+    assert(Calendar::parse("2024-02-29", 10, day));
+    assert(day == 19782);
+    assert(!Calendar::parse("2023-02-29", 10, day));
+    assert(!Calendar::parse("2024-13-01", 10, day));
+    assert(!Calendar::parse("2024-1-01", 9, day));
+    assert(!Calendar::parse("2024/01/01", 10, day));
+    assert(!Calendar::parse("20x4-01-01", 10, day));
+    cout << "✓ Calendar::parse validation passed\n";
+
+    char buffer[Calendar::DATE_LENGTH + 1] = {};
+    Calendar::format(19782, buffer);
+    assert(strcmp(buffer, "2024-02-29") == 0);
+    cout << "✓ Calendar::format passed\n";
+
+    assert(Utils::formatDate(Utils::parseDate("2025-12-31")) == "2025-12-31");
+    assert(Utils::isValidDate("2025-06-30"));
+    assert(!Utils::isValidDate("2025-06-31"));
+    assert(!Utils::isValidDate("2031-01-01"));
+    cout << "✓ Utils round trip passed\n";
+
+    try {
+        Utils::parseDate("not-a-date");
+        cout << "✗ Should have thrown exception for malformed date\n";
+        assert(false);
+    } catch (const InvalidDateException&) {
+        cout << "✓ Malformed date exception caught\n";
+    }
+
+    cout << "Date Parsing and Formatting Tests: PASSED\n\n";
+}
+
+void testDaysBetweenAcrossDst() {
+    cout << "Testing daysBetween Across DST Transitions...\n";
+
+    // US spring-forward and fall-back nights, EU transitions a few weeks later
+    assert(Utils::daysBetween(Utils::parseDate("2024-03-10"), Utils::parseDate("2024-03-11")) == 1);
+    assert(Utils::daysBetween(Utils::parseDate("2024-11-03"), Utils::parseDate("2024-11-04")) == 1);
+    assert(Utils::daysBetween(Utils::parseDate("2024-03-30"), Utils::parseDate("2024-04-02")) == 3);
+    assert(Utils::daysBetween(Utils::parseDate("2024-01-01"), Utils::parseDate("2025-01-01")) == 366);
+    assert(Utils::daysBetween(Utils::parseDate("2025-01-01"), Utils::parseDate("2024-12-25")) == -7);
+    cout << "✓ Night counts are exact across DST changes\n";
+
+    cout << "daysBetween DST Tests: PASSED\n\n";
+}
+
+// Previous implementation, kept here only as the benchmark baseline
+static time_t legacyParseDate(const string& dateStr) {
+    tm tm = {};
+    stringstream ss(dateStr);
+    string token;
+    getline(ss, token, '-');
+    tm.tm_year = stoi(token) - 1900;
+    getline(ss, token, '-');
+    tm.tm_mon = stoi(token) - 1;
+    getline(ss, token, '-');
+    tm.tm_mday = stoi(token);
+    return mktime(&tm);
+}
+
+static string legacyFormatDate(time_t time) {
+    tm* tm = localtime(&time);
+    char buffer[11];
+    strftime(buffer, sizeof(buffer), "%Y-%m-%d", tm);
+    return string(buffer);
+}
+
+void benchmarkDateFunctions() {
+    cout << "Benchmarking Date Functions...\n";
+
+    const int ITERATIONS = 200000;
+    const string sample = "2024-07-15";
+    long long checksum = 0;
+
+    auto start = chrono::high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        time_t t = legacyParseDate(sample);
+        checksum += legacyFormatDate(t + i % 30 * 86400).size();
+    }
+    auto legacy = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    char buffer[Calendar::DATE_LENGTH];
+    for (int i = 0; i < ITERATIONS; i++) {
+        int day = 0;
+        Calendar::parse(sample.data(), sample.size(), day);
+        Calendar::format(day + i % 30, buffer);
+        checksum += buffer[9];
+    }
+    auto kernel = chrono::duration_cast<chrono::microseconds>(
+        chrono::high_resolution_clock::now() - start);
+
+    cout << "✓ " << ITERATIONS << " parse+format pairs\n";
+    cout << "  stringstream/mktime/localtime: " << legacy.count() << " us\n";
+    cout << "  Calendar kernel:               " << kernel.count() << " us\n";
+    cout << "  (checksum " << checksum << ")\n";
+
+    cout << "Date Function Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     UTILS DATE FUNCTION TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testCivilConversions();
+        testParseAndFormat();
+        testDaysBetweenAcrossDst();
+        benchmarkDateFunctions();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,238 @@
+#include "Database.h"
+#include "Waitlist.h"
+#include "Exceptions.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <random>
+
+using namespace std;
+
+static WaitlistRequest request(int id, RoomType type, int guests, int firstDay, int nights) {
+    WaitlistRequest result;
+    result.requestId = id;
+    result.customerId = 1001;
+    result.type = type;
+    result.guests = guests;
+    result.checkInDate = Calendar::fromEpochDay(firstDay);
+    result.checkOutDate = Calendar::fromEpochDay(firstDay + nights);
+    return result;
+}
+
+// Every waiting request checked against the same rules as the index
+static int naiveMatch(const Waitlist& waitlist, RoomType type, int capacity, int freeFrom, int freeTo,
+                      int firstDay, int endDay) {
+    firstDay = max(firstDay, freeFrom);
+    endDay = min(endDay, freeTo);
+    int best = 0, bestShared = 0, bestNights = 0;
+    for (const auto& request : waitlist.getRequests()) {
+        if (request.status != WAITLIST_WAITING || request.type != type || request.guests > capacity) continue;
+        int checkIn = Utils::toEpochDay(request.checkInDate);
+        int checkOut = Utils::toEpochDay(request.checkOutDate);
+        if (checkIn < freeFrom || checkOut > freeTo) continue;
+        int shared = min(checkOut, endDay) - max(checkIn, firstDay);
+        int nights = checkOut - checkIn;
+        if (shared <= 0) continue;
+        if (best == 0 || shared > bestShared || (shared == bestShared && nights > bestNights)) {
+            best = request.requestId;
+            bestShared = shared;
+            bestNights = nights;
+        }
+    }
+    return best;
+}
+
+void testMatching() {
+    cout << "Testing Waitlist Matching...\n";
+
+    const int d0 = Calendar::daysFromCivil(2025, 9, 1);
+    Waitlist waitlist;
+    waitlist.add(request(1, SUITE, 2, d0 + 1, 2));
+    waitlist.add(request(2, SUITE, 2, d0, 5));
+    waitlist.add(request(3, SUITE, 4, d0, 5));       // Too many guests for the room
+    waitlist.add(request(4, DELUXE, 2, d0, 5));      // Wrong type
+    waitlist.add(request(5, SUITE, 2, d0, 5));       // Same fit as 2, queued later
+    waitlist.add(request(6, SUITE, 1, d0 + 3, 4));   // Runs into the next stay
+
+    assert(waitlist.match(SUITE, 2, d0, d0 + 6, d0, d0 + 5) == 2);
+    assert(waitlist.markFilled(2, 10001));
+    assert(waitlist.find(2)->status == WAITLIST_FILLED && waitlist.find(2)->reservationId == 10001);
+    assert(waitlist.match(SUITE, 2, d0, d0 + 6, d0, d0 + 5) == 5);
+    assert(waitlist.withdraw(5));
+    assert(!waitlist.withdraw(5));
+    assert(waitlist.match(SUITE, 2, d0, d0 + 6, d0, d0 + 5) == 1);
+    assert(waitlist.match(SUITE, 2, d0, d0 + 7, d0, d0 + 5) == 6);
+    assert(waitlist.match(SUITE, 4, d0, d0 + 6, d0, d0 + 5) == 3);
+    assert(waitlist.match(SUITE, 2, d0 + 10, d0 + 20, d0 + 10, d0 + 12) == 0);
+    cout << "✓ Most freed nights, then longest stay, then first queued\n";
+    cout << "✓ Capacity, type and the next stay respected\n";
+
+    assert(waitlist.getWaitingCount() == 4);
+    assert(waitlist.expire(d0 + 1) == 2);
+    assert(waitlist.find(3)->status == WAITLIST_EXPIRED);
+    assert(waitlist.getWaitingCount() == 2);
+    cout << "✓ Requests whose arrival passed expire\n";
+
+    mt19937 rng(11);
+    Waitlist random;
+    for (int id = 1; id <= 3000; id++) {
+        random.add(request(id, static_cast<RoomType>(STANDARD + rng() % 4), 1 + static_cast<int>(rng() % 4),
+                           d0 + static_cast<int>(rng() % 120), 1 + static_cast<int>(rng() % 14)));
+        if (rng() % 5 == 0) random.withdraw(1 + static_cast<int>(rng() % id));
+    }
+    for (int i = 0; i < 2000; i++) {
+        RoomType type = static_cast<RoomType>(STANDARD + rng() % 4);
+        int capacity = 1 + static_cast<int>(rng() % 4);
+        int firstDay = d0 + static_cast<int>(rng() % 120);
+        int endDay = firstDay + 1 + static_cast<int>(rng() % 10);
+        int freeFrom = firstDay - static_cast<int>(rng() % 5);
+        int freeTo = endDay + static_cast<int>(rng() % 5);
+        int expected = naiveMatch(random, type, capacity, freeFrom, freeTo, firstDay, endDay);
+        assert(random.match(type, capacity, freeFrom, freeTo, firstDay, endDay) == expected);
+    }
+    cout << "✓ Index agrees with a full scan on 2000 random rooms\n";
+
+    cout << "Waitlist Matching Tests: PASSED\n\n";
+}
+
+void testDatabaseWaitlist() {
+    cout << "Testing Database Waitlist...\n";
+
+    int today = Utils::getTodayEpochDay();
+    int shortStay, longStay, family, early;
+    {
+        Database db;
+        int room = db.addRoom(SUITE, 350.0, 2);
+        int booked = db.makeReservation(1001, room, Calendar::fromEpochDay(today + 320),
+                                        Calendar::fromEpochDay(today + 325), 2);
+        shortStay = db.joinWaitlist(1001, SUITE, 2, Calendar::fromEpochDay(today + 321), Calendar::fromEpochDay(today + 323));
+        longStay = db.joinWaitlist(1001, SUITE, 2, Calendar::fromEpochDay(today + 320), Calendar::fromEpochDay(today + 325));
+        family = db.joinWaitlist(1001, SUITE, 4, Calendar::fromEpochDay(today + 320), Calendar::fromEpochDay(today + 325));
+        int reservationCount = db.getReservationCount();
+
+        assert(db.cancelReservation(booked));
+        const WaitlistRequest* filled = db.getWaitlist().find(longStay);
+        assert(filled->status == WAITLIST_FILLED);
+        Reservation* rebooked = db.findReservation(filled->reservationId);
+        assert(rebooked && rebooked->getRoomNumber() == room && rebooked->getStatus() == CONFIRMED);
+        assert(Utils::toEpochDay(rebooked->getRawCheckIn()) == today + 320);
+        assert(db.findRoom(room)->getStatus() == RESERVED);
+        assert(db.getReservationCount() == reservationCount + 1);
+        assert(db.getWaitlist().find(shortStay)->status == WAITLIST_WAITING);
+        assert(db.getWaitlist().find(family)->status == WAITLIST_WAITING);
+        cout << "✓ A cancellation books the best waiting request into the room\n";
+
+        // Leaving early frees the nights that were left
+        int tonight = db.addRoom(DELUXE, 220.0, 2);
+        int stay = db.makeReservation(1001, tonight, Calendar::fromEpochDay(today), Calendar::fromEpochDay(today + 3), 2);
+        early = db.joinWaitlist(1001, DELUXE, 1, Calendar::fromEpochDay(today + 1), Calendar::fromEpochDay(today + 3));
+        assert(db.checkIn(stay));
+        assert(db.checkOut(stay));
+        const WaitlistRequest* picked = db.getWaitlist().find(early);
+        assert(picked->status == WAITLIST_FILLED);
+        assert(db.findReservation(picked->reservationId)->getRoomNumber() == tonight);
+        cout << "✓ An early check-out fills the remaining nights\n";
+
+        // Nights another stay still has are not offered
+        int twice = db.addRoom(SUITE, 360.0, 2);
+        int firstStay = db.makeReservation(1001, twice, Calendar::fromEpochDay(today + 360),
+                                           Calendar::fromEpochDay(today + 362), 2);
+        db.updateRoomStatus(twice, AVAILABLE);
+        int secondStay = db.makeReservation(1001, twice, Calendar::fromEpochDay(today + 362),
+                                            Calendar::fromEpochDay(today + 364), 2);
+        int across = db.joinWaitlist(1001, SUITE, 2, Calendar::fromEpochDay(today + 361), Calendar::fromEpochDay(today + 363));
+        assert(db.cancelReservation(firstStay));
+        assert(db.getWaitlist().find(across)->status == WAITLIST_WAITING);
+        assert(db.findRoom(twice)->getStatus() == RESERVED);
+        assert(db.withdrawFromWaitlist(across));
+        db.cancelReservation(secondStay);
+        cout << "✓ Freed nights offered only up to the room's next stay\n";
+
+        bool caught = false;
+        try {
+            db.joinWaitlist(1001, SUITE, 2, Calendar::fromEpochDay(today - 2), Calendar::fromEpochDay(today + 1));
+        } catch (const ValidationException&) {
+            caught = true;
+        }
+        assert(caught);
+        cout << "✓ Past arrivals rejected\n";
+
+        db.cancelReservation(filled->reservationId);    // Goes to the next in line
+        db.cancelReservation(picked->reservationId);
+    }
+    {
+        Database db;
+        assert(db.getWaitlist().find(longStay)->status == WAITLIST_FILLED);
+        assert(db.getWaitlist().find(shortStay)->status == WAITLIST_FILLED);
+        assert(db.getWaitlist().find(family)->status == WAITLIST_WAITING);
+        assert(db.withdrawFromWaitlist(family));
+        db.cancelReservation(db.getWaitlist().find(shortStay)->reservationId);
+    }
+    cout << "✓ The waitlist survives a reload\n";
+
+    cout << "Database Waitlist Tests: PASSED\n\n";
+}
+
+void benchmarkMatching() {
+    cout << "Benchmarking Waitlist Matching...\n";
+
+    const int WAITING = 5000;
+    const int MATCHES = 20000;
+    const int d0 = Calendar::daysFromCivil(2025, 1, 1);
+    mt19937 rng(17);
+    Waitlist waitlist;
+    for (int id = 1; id <= WAITING; id++) {
+        waitlist.add(request(id, static_cast<RoomType>(STANDARD + rng() % 4), 1 + static_cast<int>(rng() % 4),
+                             d0 + static_cast<int>(rng() % 365), 1 + static_cast<int>(rng() % 7)));
+    }
+    struct Freed { RoomType type; int capacity, freeFrom, freeTo, firstDay, endDay; };
+    vector<Freed> freed;
+    for (int i = 0; i < MATCHES; i++) {
+        int firstDay = d0 + static_cast<int>(rng() % 365);
+        int endDay = firstDay + 1 + static_cast<int>(rng() % 7);
+        freed.push_back({static_cast<RoomType>(STANDARD + rng() % 4), 2 + static_cast<int>(rng() % 3),
+                         firstDay - static_cast<int>(rng() % 4), endDay + static_cast<int>(rng() % 4), firstDay, endDay});
+    }
+
+    auto start = chrono::high_resolution_clock::now();
+    long long scanned = 0;
+    for (const auto& f : freed) {
+        scanned += naiveMatch(waitlist, f.type, f.capacity, f.freeFrom, f.freeTo, f.firstDay, f.endDay);
+    }
+    auto scan = chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - start);
+
+    start = chrono::high_resolution_clock::now();
+    long long indexed = 0;
+    for (const auto& f : freed) {
+        indexed += waitlist.match(f.type, f.capacity, f.freeFrom, f.freeTo, f.firstDay, f.endDay);
+    }
+    auto lookup = chrono::duration_cast<chrono::microseconds>(chrono::high_resolution_clock::now() - start);
+
+    assert(scanned == indexed);
+    assert(lookup.count() < MATCHES * 1000LL);
+    cout << "✓ " << WAITING << " waiting requests, " << MATCHES << " freed rooms\n";
+    cout << "  Full scan: " << scan.count() * 1000 / MATCHES << " ns per match\n";
+    cout << "  Indexed:   " << lookup.count() * 1000 / MATCHES << " ns per match\n";
+    cout << "Waitlist Benchmark: DONE\n\n";
+}
+
+int main() {
+    cout << "========================================\n";
+    cout << "     WAITLIST TESTS\n";
+    cout << "========================================\n\n";
+
+    try {
+        testMatching();
+        testDatabaseWaitlist();
+        benchmarkMatching();
+
+        cout << "========================================\n";
+        cout << "     ALL TESTS PASSED SUCCESSFULLY!\n";
+        cout << "========================================\n";
+        return 0;
+
+    } catch (const exception& e) {
+        cout << "\n✗ TEST FAILED: " << e.what() << "\n";
+        return 1;
+    }
+}